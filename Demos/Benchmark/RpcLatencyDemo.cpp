@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <future>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/all.hpp"
+
+using namespace SilKit::Services::Rpc;
+using namespace std::chrono_literals;
+
+void PrintUsage(const std::string& executableName)
+{
+    std::cout << "Usage:" << std::endl
+              << executableName << " [callCount]"
+              << " [messageSizeInBytes]"
+              << " [registryURi]" << std::endl
+              << "If no arguments are given, default values will be used." << std::endl
+              << "\t--help\tshow this message." << std::endl
+              << "\t--isServer\tThis process is the server counterpart of the latency measurement" << std::endl
+              << "\t--registry-uri\tThe URI of the registry to connect to. Default: silkit://localhost:8500"
+              << std::endl
+              << "\t--message-size\tSets the size of the call arguments and results to BYTES. Default: 1000"
+              << std::endl
+              << "\t--call-count\tSets the number of calls to NUM. Default: 10000" << std::endl
+              << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: "
+                 "empty"
+              << std::endl;
+}
+
+struct BenchmarkConfig
+{
+    uint32_t callCount = 10000;
+    uint32_t messageSizeInBytes = 1000;
+    bool isServer = false;
+    std::string registryUri = "silkit://localhost:8500";
+    std::string silKitConfigPath = "";
+};
+
+bool Parse(int argc, char** argv, BenchmarkConfig& config)
+{
+    // skip argv[0] and collect all arguments
+    std::vector<std::string> args;
+    std::copy((argv + 1), (argv + argc), std::back_inserter(args));
+
+    auto asNum = [](const auto& str) { return static_cast<uint32_t>(std::stoul(str)); };
+    auto asStr = [](auto& a) { return std::string{a}; };
+
+    // test and remove the flag from args, returns true if flag was present
+    auto consumeFlag = [&args](const auto& namedOption) {
+        auto it = std::find(args.begin(), args.end(), namedOption);
+        if (it != args.end())
+        {
+            args.erase(it);
+            return true;
+        }
+        return false;
+    };
+
+    if (consumeFlag("--help"))
+    {
+        PrintUsage(argv[0]);
+        return false;
+    }
+
+    if (consumeFlag("--isServer"))
+    {
+        config.isServer = true;
+    }
+
+    // Consume a named option and return its argument, or throw if an invalid argument is given.
+    auto getArg = [&args](const auto& name) {
+        auto argIt = std::find(args.begin(), args.end(), name);
+        if (argIt == args.end())
+        {
+            return std::string{}; //the argument is not even mentioned
+        }
+        auto valIt = argIt + 1;
+        if (valIt == args.end())
+        {
+            throw std::runtime_error{std::string{"Option \""} + name + "\" is missing an argument!"};
+        }
+        // remove consumed args
+        auto result = *valIt;
+        args.erase(valIt);
+        args.erase(argIt);
+        return result;
+    };
+    auto parseOptional = [&getArg](const auto& argName, auto& outputValue, auto conversionFunc) {
+        auto arg = getArg(argName);
+        if (!arg.empty())
+        {
+            using OutputT = std::remove_reference_t<decltype(outputValue)>;
+            outputValue = OutputT{conversionFunc(arg)};
+        }
+    };
+
+    try
+    {
+        // Parse and consume the optional named arguments
+        parseOptional("--registry-uri", config.registryUri, asStr);
+        parseOptional("--message-size", config.messageSizeInBytes, asNum);
+        parseOptional("--call-count", config.callCount, asNum);
+        parseOptional("--configuration", config.silKitConfigPath, asStr);
+
+        //check unknown long options
+        for (const auto& arg : args)
+        {
+            if (arg.find_first_of("--") == 0)
+            {
+                std::cout << "Error: unknown argument \"" << arg << "\"" << std::endl;
+                PrintUsage(argv[0]);
+                return false;
+            }
+        }
+        // Handle positional arguments, if any:
+        if (args.size() > 3)
+        {
+            std::cout << "Error: Too many arguments!" << std::endl;
+            PrintUsage(argv[0]);
+            return false;
+        }
+
+        switch (args.size())
+        {
+        case 3:
+            config.registryUri = args.at(2);
+            // [[fallthrough]]
+        case 2:
+            config.messageSizeInBytes = asNum(args.at(1));
+            // [[fallthrough]]
+        case 1:
+            config.callCount = asNum(args.at(0));
+            break;
+        default:
+            break;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << "Error parsing arguments: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (config.callCount < 1)
+    {
+        std::cout << "Invalid argument: The call count must be at least 1." << std::endl;
+        return false;
+    }
+    if (config.messageSizeInBytes < 1)
+    {
+        std::cout << "Invalid argument: The message payload size must be at least 1 byte." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void PrintParameters(const BenchmarkConfig& benchmark)
+{
+#ifndef NDEBUG
+    std::cout << "WARNING: The rpc latency demo is executed in a DEBUG build configuration." << std::endl
+              << "For more reliable timings, please use a RELEASE build configuration" << std::endl
+              << "of the SIL Kit library and the rpc latency demo." << std::endl;
+    std::this_thread::sleep_for(2s);
+#endif
+
+    std::cout << std::endl
+              << "This rpc latency demo measures the call rate and round trip times of RPC calls." << std::endl
+              << "An RPC client performs <N> calls with <B> bytes of arguments and results, one after another."
+              << std::endl
+              << "Note that both participants must use the same parameters for a valid measurement " << std::endl
+              << "and one participant must use the --isServer flag." << std::endl
+              << std::endl
+              << "Running simulations with the following parameters:" << std::endl
+              << std::endl
+              << std::left << std::setw(38) << "- Is Server: " << (benchmark.isServer ? "True" : "False")
+              << std::endl
+              << std::left << std::setw(38) << "- Total call count: " << benchmark.callCount << std::endl
+              << std::left << std::setw(38) << "- Message size (bytes): " << benchmark.messageSizeInBytes << std::endl
+              << std::left << std::setw(38) << "- Registry URI: " << benchmark.registryUri << std::endl
+              << std::left << std::setw(38) << "- Configuration: " << benchmark.silKitConfigPath << std::endl
+              << std::endl;
+}
+
+/**************************************************************************************************
+ * Main Function
+ **************************************************************************************************/
+int main(int argc, char** argv)
+{
+    std::cout.precision(3);
+    BenchmarkConfig benchmark;
+    if (!Parse(argc, argv, benchmark))
+    {
+        return -1;
+    }
+
+    PrintParameters(benchmark);
+
+    try
+    {
+        std::shared_ptr<SilKit::Config::IParticipantConfiguration> config;
+        if (benchmark.silKitConfigPath == "")
+        {
+            config = SilKit::Config::ParticipantConfigurationFromString("{}");
+        }
+        else
+        {
+            config = SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+        }
+
+        const std::string participantName = benchmark.isServer ? "RpcServer" : "RpcClient";
+        auto participant = SilKit::CreateParticipant(config, participantName, benchmark.registryUri);
+
+        const RpcSpec rpcSpec{"RpcLatency", "application/octet-stream"};
+        const std::vector<uint8_t> data(benchmark.messageSizeInBytes, '*');
+
+        if (benchmark.isServer)
+        {
+            uint32_t callCount{0};
+            std::promise<void> allCallsReceived;
+            participant->CreateRpcServer("RpcServer1", rpcSpec,
+                                         [&data, &benchmark, &callCount, &allCallsReceived](IRpcServer* server,
+                                                                                            const RpcCallEvent& event) {
+                server->SubmitResult(event.callHandle, data);
+                // Calls without arguments only check that the server is reachable
+                if (!event.argumentData.empty() && ++callCount == benchmark.callCount)
+                {
+                    allCallsReceived.set_value();
+                }
+            });
+
+            allCallsReceived.get_future().wait();
+            // Give the last result time to leave before the participant disconnects
+            std::this_thread::sleep_for(1s);
+            std::cout << "Server done." << std::endl;
+            return 0;
+        }
+
+        std::vector<std::chrono::nanoseconds> measuredRoundtrips;
+        measuredRoundtrips.reserve(benchmark.callCount);
+
+        int reachabilityCheck{0};
+        std::atomic<bool> serverReachable{false};
+        std::promise<void> allCallsDone;
+        std::chrono::steady_clock::time_point callTime;
+
+        auto* client = participant->CreateRpcClient(
+            "RpcClient1", rpcSpec,
+            [&data, &benchmark, &reachabilityCheck, &serverReachable, &allCallsDone, &callTime,
+             &measuredRoundtrips](IRpcClient* rpcClient, const RpcCallResultEvent& event) {
+            if (event.userContext == &reachabilityCheck)
+            {
+                serverReachable = serverReachable || event.callStatus == RpcCallStatus::Success;
+                return;
+            }
+            if (event.callStatus != RpcCallStatus::Success)
+            {
+                std::cerr << "Call failed, retrying" << std::endl;
+            }
+            else
+            {
+                measuredRoundtrips.push_back(std::chrono::steady_clock::now() - callTime);
+                if (measuredRoundtrips.size() == benchmark.callCount)
+                {
+                    allCallsDone.set_value();
+                    return;
+                }
+            }
+
+            callTime = std::chrono::steady_clock::now();
+            rpcClient->Call(data);
+        });
+
+        while (!serverReachable)
+        {
+            client->Call({}, &reachabilityCheck);
+            std::this_thread::sleep_for(100ms);
+        }
+
+        // -----------------------------------
+        // Runtime measurement: each call is made by the result handler of the previous one
+
+        const auto startTimestamp = std::chrono::steady_clock::now();
+        callTime = startTimestamp;
+        client->Call(data);
+        allCallsDone.get_future().wait();
+        const auto duration = std::chrono::steady_clock::now() - startTimestamp;
+
+        // -----------------------------------
+        // Calculation of KPIs
+
+        std::sort(measuredRoundtrips.begin(), measuredRoundtrips.end());
+        const auto percentile = [&measuredRoundtrips](double p) {
+            const auto index = static_cast<size_t>(std::ceil(p * measuredRoundtrips.size())) - 1;
+            return measuredRoundtrips.at(std::min(index, measuredRoundtrips.size() - 1)).count() / 1.e3;
+        };
+
+        const auto durationSeconds = std::chrono::duration<double>{duration}.count();
+        const auto callRate = measuredRoundtrips.size() / durationSeconds;
+        const auto meanRoundtrip =
+            std::accumulate(measuredRoundtrips.begin(), measuredRoundtrips.end(), std::chrono::nanoseconds{0}).count()
+            / 1.e3 / measuredRoundtrips.size();
+
+        // Stream helper to combine value and unit to use it with std::setw as a whole
+        auto withUnit = [](double value, const char* unit) {
+            std::ostringstream out;
+            out.precision(3);
+            out << value << " " << unit;
+            return out.str();
+        };
+
+        std::cout << std::endl << "Result of the simulation run:" << std::endl << std::endl;
+        std::cout << std::setw(38) << "- Realtime duration (runtime): " << std::setw(6)
+                  << withUnit(durationSeconds, "s") << std::endl
+                  << std::setw(38) << "- Call rate: " << std::setw(6) << withUnit(callRate, "calls/s") << std::endl
+                  << std::setw(38) << "- Round trip time (mean): " << std::setw(6) << withUnit(meanRoundtrip, "us")
+                  << std::endl
+                  << std::setw(38) << "- Round trip time (p50): " << std::setw(6) << withUnit(percentile(0.50), "us")
+                  << std::endl
+                  << std::setw(38) << "- Round trip time (p99): " << std::setw(6) << withUnit(percentile(0.99), "us")
+                  << std::endl
+                  << std::endl;
+    }
+    catch (const SilKit::ConfigurationError& error)
+    {
+        std::cerr << "Invalid configuration: " << error.what() << std::endl;
+        std::cout << "Press enter to end the process..." << std::endl;
+        std::cin.ignore();
+        return -2;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "Something went wrong: " << error.what() << std::endl;
+        std::cout << "Press enter to end the process..." << std::endl;
+        std::cin.ignore();
+        return -3;
+    }
+
+    return 0;
+}
@@ -124,4 +124,10 @@ TEST_F(FTest_ServiceDiscoveryPerf, test_discovery_performance_200services)
 {
     ExecuteTest(200, 25s);
 }
+
+// Benchmark for coalesced service announcements, run with --gtest_also_run_disabled_tests
+TEST_F(FTest_ServiceDiscoveryPerf, DISABLED_test_discovery_performance_10000services)
+{
+    ExecuteTest(10000, 300s);
+}
 } // anonymous namespace
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <iomanip>
+#include <iostream>
+
+#include "silkit/services/orchestration/all.hpp"
+
+#include "SimTestHarness.hpp"
+
+#include "GetTestPid.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+auto Now()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now);
+}
+
+class FTest_TimeSyncPerf : public testing::Test
+{
+protected:
+    FTest_TimeSyncPerf() {}
+
+    void ExecuteTest(std::vector<int> numberOfParticipantsList, int numberOfSteps)
+    {
+        for (auto numberOfParticipants : numberOfParticipantsList)
+        {
+            const std::chrono::seconds timeout = 100s;
+            const auto stepSize = 1ms;
+
+            std::vector<std::string> syncParticipantNames;
+            for (auto i = 0; i < numberOfParticipants; i++)
+            {
+                syncParticipantNames.push_back("Participant" + std::to_string(i));
+            }
+
+            auto registryUri = MakeTestRegistryUri();
+            SilKit::Tests::SimTestHarness testHarness(syncParticipantNames, registryUri, true);
+
+            // the wall-clock time is measured between the first and the last step of the first participant
+            std::chrono::nanoseconds firstStepTime{};
+            std::chrono::nanoseconds lastStepTime{};
+
+            for (const auto& participantName : syncParticipantNames)
+            {
+                auto&& participant = testHarness.GetParticipant(participantName);
+                auto* lifecycleService = participant->GetOrCreateLifecycleService();
+                auto* timeSyncService = participant->GetOrCreateTimeSyncService();
+
+                if (participantName == syncParticipantNames.front())
+                {
+                    timeSyncService->SetSimulationStepHandler(
+                        [lifecycleService, numberOfSteps, stepSize, &firstStepTime, &lastStepTime](auto now, auto) {
+                        if (now == 0ns)
+                        {
+                            firstStepTime = Now();
+                        }
+                        if (now == numberOfSteps * stepSize)
+                        {
+                            lastStepTime = Now();
+                            lifecycleService->Stop("Test complete");
+                        }
+                    }, stepSize);
+                }
+                else
+                {
+                    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, stepSize);
+                }
+            }
+
+            ASSERT_TRUE(testHarness.Run(timeout)) << "numberOfParticipants=" << numberOfParticipants;
+
+            std::chrono::duration<double> duration = lastStepTime - firstStepTime;
+            std::cout << std::left << std::setw(22) << numberOfParticipants << " " << std::setw(12)
+                      << duration.count() << " " << numberOfSteps / duration.count() << std::endl;
+        }
+    }
+};
+
+
+TEST_F(FTest_TimeSyncPerf, test_time_sync_performance)
+{
+    // Larger set for production
+    //std::vector<int> numberOfParticipantsList{2, 8, 32, 64, 128};
+    //const int numberOfSteps = 10000;
+
+    // For testing
+    std::vector<int> numberOfParticipantsList{2, 8, 32};
+    const int numberOfSteps = 1000;
+
+    std::cout << std::endl;
+    std::cout << "# " << numberOfSteps << " simulation steps" << std::endl;
+    std::cout << "# NumberOfParticipants Runtime(s)   Steps/s" << std::endl;
+    ExecuteTest(numberOfParticipantsList, numberOfSteps);
+}
+
+} // namespace
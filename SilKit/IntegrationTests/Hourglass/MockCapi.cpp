@@ -820,6 +820,23 @@ extern "C"
         return globalCapi->SilKit_DataPublisher_Publish(self, data);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size,
+                                                           SilKit_DataPublisherLoan** outLoan, uint8_t** outData)
+    {
+        return globalCapi->SilKit_DataPublisher_Loan(self, size, outLoan, outData);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishLoan(SilKit_DataPublisher* self,
+                                                                  SilKit_DataPublisherLoan* loan)
+    {
+        return globalCapi->SilKit_DataPublisher_PublishLoan(self, loan);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisherLoan_Release(SilKit_DataPublisherLoan* loan)
+    {
+        return globalCapi->SilKit_DataPublisherLoan_Release(loan);
+    }
+
     // DataSubscriber
 
     SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
@@ -445,6 +445,14 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Publish,
                 (SilKit_DataPublisher * self, const SilKit_ByteVector* data));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Loan,
+                (SilKit_DataPublisher * self, size_t size, SilKit_DataPublisherLoan** outLoan, uint8_t** outData));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_PublishLoan,
+                (SilKit_DataPublisher * self, SilKit_DataPublisherLoan* loan));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisherLoan_Release, (SilKit_DataPublisherLoan * loan));
+
     // DataSubscriber
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_Create,
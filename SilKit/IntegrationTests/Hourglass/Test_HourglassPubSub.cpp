@@ -178,6 +178,52 @@ TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_Publish)
     publisher.Publish(byteSpan);
 }
 
+TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_Loan_Publish)
+{
+    using testing::_;
+
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    auto* const mockLoan = reinterpret_cast<SilKit_DataPublisherLoan*>(uintptr_t(0x13572468));
+    std::vector<uint8_t> bytes(9);
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_Loan(mockDataPublisher, bytes.size(), _, _))
+        .WillOnce(DoAll(SetArgPointee<2>(mockLoan), SetArgPointee<3>(bytes.data()), Return(SilKit_ReturnCode_SUCCESS)));
+    EXPECT_CALL(capi, SilKit_DataPublisher_PublishLoan(mockDataPublisher, mockLoan));
+    EXPECT_CALL(capi, SilKit_DataPublisherLoan_Release(_)).Times(0);
+
+    auto loan = publisher.Loan(bytes.size());
+    EXPECT_EQ(loan.Data().data(), bytes.data());
+    EXPECT_EQ(loan.Data().size(), bytes.size());
+
+    publisher.PublishLoan(std::move(loan));
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataPublisherLoan_Release)
+{
+    using testing::_;
+
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    auto* const mockLoan = reinterpret_cast<SilKit_DataPublisherLoan*>(uintptr_t(0x13572468));
+    std::vector<uint8_t> bytes(9);
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_Loan(mockDataPublisher, bytes.size(), _, _))
+        .WillOnce(DoAll(SetArgPointee<2>(mockLoan), SetArgPointee<3>(bytes.data()), Return(SilKit_ReturnCode_SUCCESS)));
+    EXPECT_CALL(capi, SilKit_DataPublisher_PublishLoan(_, _)).Times(0);
+    EXPECT_CALL(capi, SilKit_DataPublisherLoan_Release(mockLoan));
+
+    {
+        auto loan = publisher.Loan(bytes.size());
+    }
+}
+
 // DataSubscriber
 
 TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_Create)
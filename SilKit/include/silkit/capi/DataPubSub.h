@@ -54,6 +54,8 @@ typedef struct
 typedef struct SilKit_DataPublisher SilKit_DataPublisher;
 /*! \brief Represents a handle to a data subscriber instance */
 typedef struct SilKit_DataSubscriber SilKit_DataSubscriber;
+/*! \brief Represents a handle to a buffer loaned from a data publisher */
+typedef struct SilKit_DataPublisherLoan SilKit_DataPublisherLoan;
 
 /*! \brief Handler type for incoming data message events on DataSubscribers. 
 * \param context The context that the user provided on registration.
@@ -109,6 +111,45 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Publish(SilKit_DataP
 typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_Publish_t)(SilKit_DataPublisher* self,
                                                                       const SilKit_ByteVector* data);
 
+/*! \brief Loan a buffer for the payload of the next publication of the provided DataPublisher
+*
+* The payload is written directly into the buffer, which is sent without copying it by
+* \ref SilKit_DataPublisher_PublishLoan. A loan which is not published must be released by
+* \ref SilKit_DataPublisherLoan_Release.
+*
+* \param self The DataPublisher that should publish the data.
+* \param size The size of the payload in bytes.
+* \param outLoan Pointer to which the resulting loan reference will be written.
+* \param outData Pointer to which the address of the loaned buffer of \p size bytes will be written.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size,
+                                                                 SilKit_DataPublisherLoan** outLoan,
+                                                                 uint8_t** outData);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_Loan_t)(SilKit_DataPublisher* self, size_t size,
+                                                                   SilKit_DataPublisherLoan** outLoan,
+                                                                   uint8_t** outData);
+
+/*! \brief Publish the payload written into a loaned buffer through the provided DataPublisher
+*
+* The loan is consumed by this call, even if it fails. Neither the loan nor its buffer must be accessed afterwards.
+*
+* \param self The DataPublisher that should publish the data.
+* \param loan The loan obtained from \ref SilKit_DataPublisher_Loan.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishLoan(SilKit_DataPublisher* self,
+                                                                        SilKit_DataPublisherLoan* loan);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_PublishLoan_t)(SilKit_DataPublisher* self,
+                                                                          SilKit_DataPublisherLoan* loan);
+
+/*! \brief Release a loaned buffer without publishing it
+* \param loan The loan obtained from \ref SilKit_DataPublisher_Loan.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisherLoan_Release(SilKit_DataPublisherLoan* loan);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisherLoan_Release_t)(SilKit_DataPublisherLoan* loan);
+
 /*! \brief Sets / overwrites the default handler to be called on data reception.
 * \param self The DataSubscriber for which the handler should be set.
 * \param context A user provided context, that is reobtained on data reception in the dataHandler.
@@ -44,6 +44,13 @@ public:
 
     inline void Publish(Util::Span<const uint8_t> data) override;
 
+    inline auto Loan(size_t size) -> SilKit::Services::PubSub::DataPublisherLoan override;
+
+    inline void PublishLoan(SilKit::Services::PubSub::DataPublisherLoan loan) override;
+
+private:
+    static inline void ReleaseLoan(void* handle);
+
 private:
     SilKit_DataPublisher* _dataPublisher{nullptr};
 };
@@ -93,6 +100,31 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     ThrowOnError(returnCode);
 }
 
+auto DataPublisher::Loan(size_t size) -> SilKit::Services::PubSub::DataPublisherLoan
+{
+    SilKit_DataPublisherLoan* loan{nullptr};
+    uint8_t* data{nullptr};
+
+    const auto returnCode = SilKit_DataPublisher_Loan(_dataPublisher, size, &loan, &data);
+    ThrowOnError(returnCode);
+
+    return SilKit::Services::PubSub::DataPublisherLoan{Util::Span<uint8_t>{data, size}, loan,
+                                                       &DataPublisher::ReleaseLoan};
+}
+
+void DataPublisher::PublishLoan(SilKit::Services::PubSub::DataPublisherLoan loan)
+{
+    const auto returnCode =
+        SilKit_DataPublisher_PublishLoan(_dataPublisher, static_cast<SilKit_DataPublisherLoan*>(loan.ReleaseHandle()));
+    ThrowOnError(returnCode);
+}
+
+void DataPublisher::ReleaseLoan(void* handle)
+{
+    // NB: called from the destructor of the loan, errors cannot be reported
+    (void)SilKit_DataPublisherLoan_Release(static_cast<SilKit_DataPublisherLoan*>(handle));
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
@@ -21,10 +21,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "silkit/util/Span.hpp"
 
+#include "PubSubDatatypes.hpp"
+
 namespace SilKit {
 namespace Services {
 namespace PubSub {
@@ -44,6 +48,35 @@ public:
      * \param data A non-owning reference to an opaque block of raw data
      */
     virtual void Publish(Util::Span<const uint8_t> data) = 0;
+
+    /*! \brief Loan a buffer for the payload of the next publication
+     *
+     * The payload is written directly into the returned buffer, which is sent without
+     * copying it when passed to \ref PublishLoan. This avoids copying large payloads.
+     *
+     * The default implementation loans a separately allocated buffer, which is published
+     * by \ref PublishLoan using \ref Publish(Util::Span<const uint8_t>).
+     *
+     * \param size The size of the payload in bytes
+     */
+    virtual auto Loan(size_t size) -> DataPublisherLoan
+    {
+        auto* buffer = new std::vector<uint8_t>(size);
+        return DataPublisherLoan{*buffer, buffer,
+                                 [](void* handle) { delete static_cast<std::vector<uint8_t>*>(handle); }};
+    }
+
+    /*! \brief Publish the payload written into a loaned buffer
+     *
+     * The loaned buffer must not be accessed afterwards.
+     *
+     * \param loan A loan obtained from \ref Loan
+     */
+    virtual void PublishLoan(DataPublisherLoan loan)
+    {
+        // the loan releases its buffer when it goes out of scope
+        Publish(loan.Data());
+    }
 };
 
 } // namespace PubSub
@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstdint>
 #include <chrono>
 #include <functional>
+#include <utility>
 
 #include "fwd_decl.hpp"
 
@@ -46,6 +47,83 @@ struct DataMessageEvent
 using DataMessageHandler = std::function<void(SilKit::Services::PubSub::IDataSubscriber* subscriber,
                                               const DataMessageEvent& dataMessageEvent)>;
 
+/*! \brief A buffer loaned from a DataPublisher, see \ref IDataPublisher::Loan
+ *
+ * The payload is written directly into the buffer returned by \ref Data(), which is then sent without copying it.
+ * A loan which is destroyed without being published is returned to the DataPublisher. Loans can only be moved.
+ */
+class DataPublisherLoan
+{
+public:
+    //! Called with the handle if the loan is destroyed without being published
+    using ReleaseFunction = void (*)(void* handle);
+
+public:
+    DataPublisherLoan() = default;
+    //! Used by implementations of \ref IDataPublisher::Loan
+    DataPublisherLoan(Util::Span<uint8_t> data, void* handle, ReleaseFunction releaseFunction)
+        : _data{data}
+        , _handle{handle}
+        , _releaseFunction{releaseFunction}
+    {
+    }
+
+    DataPublisherLoan(const DataPublisherLoan&) = delete;
+    auto operator=(const DataPublisherLoan&) -> DataPublisherLoan& = delete;
+
+    DataPublisherLoan(DataPublisherLoan&& other) noexcept
+        : _data{other._data}
+        , _handle{other.ReleaseHandle()}
+        , _releaseFunction{other._releaseFunction}
+    {
+    }
+
+    auto operator=(DataPublisherLoan&& other) noexcept -> DataPublisherLoan&
+    {
+        if (this != &other)
+        {
+            Reset();
+            _data = other._data;
+            _releaseFunction = other._releaseFunction;
+            _handle = other.ReleaseHandle();
+        }
+        return *this;
+    }
+
+    ~DataPublisherLoan()
+    {
+        Reset();
+    }
+
+    //! The loaned buffer. It must not be accessed after the loan was published.
+    auto Data() const -> Util::Span<uint8_t>
+    {
+        return _data;
+    }
+
+    //! Used by implementations of \ref IDataPublisher::PublishLoan: Transfers the ownership of the
+    //! handle to the caller and leaves the loan empty.
+    auto ReleaseHandle() -> void*
+    {
+        _data = Util::Span<uint8_t>{};
+        return std::exchange(_handle, nullptr);
+    }
+
+private:
+    void Reset()
+    {
+        if (_handle != nullptr && _releaseFunction != nullptr)
+        {
+            _releaseFunction(ReleaseHandle());
+        }
+    }
+
+private:
+    Util::Span<uint8_t> _data;
+    void* _handle{nullptr};
+    ReleaseFunction _releaseFunction{nullptr};
+};
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
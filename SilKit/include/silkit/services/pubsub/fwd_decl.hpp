@@ -26,6 +26,7 @@ namespace Services {
 namespace PubSub {
 
 struct DataMessageEvent;
+class DataPublisherLoan;
 
 class IDataPublisher;
 class IDataSubscriber;
@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TypeConversion.hpp"
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <cstring>
 
@@ -67,6 +68,52 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size,
+                                                       SilKit_DataPublisherLoan** outLoan, uint8_t** outData)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_OUT_PARAMETER(outLoan);
+    ASSERT_VALID_OUT_PARAMETER(outData);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    auto cppLoan = std::make_unique<SilKit::Services::PubSub::DataPublisherLoan>(cppPublisher->Loan(size));
+    *outData = cppLoan->Data().data();
+    *outLoan = reinterpret_cast<SilKit_DataPublisherLoan*>(cppLoan.release());
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishLoan(SilKit_DataPublisher* self,
+                                                              SilKit_DataPublisherLoan* loan)
+try
+{
+    // the loan is consumed, even if publishing fails
+    std::unique_ptr<SilKit::Services::PubSub::DataPublisherLoan> cppLoan{
+        reinterpret_cast<SilKit::Services::PubSub::DataPublisherLoan*>(loan)};
+
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_POINTER_PARAMETER(loan);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    cppPublisher->PublishLoan(std::move(*cppLoan));
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisherLoan_Release(SilKit_DataPublisherLoan* loan)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(loan);
+
+    delete reinterpret_cast<SilKit::Services::PubSub::DataPublisherLoan*>(loan);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
                                                           SilKit_Participant* participant, const char* controllerName,
                                                           SilKit_DataSpec* dataSpec, void* defaultDataHandlerContext,
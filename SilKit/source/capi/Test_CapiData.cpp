@@ -55,6 +55,25 @@ class MockDataPublisher : public SilKit::Services::PubSub::IDataPublisher
 {
 public:
     MOCK_METHOD(void, Publish, (SilKit::Util::Span<const uint8_t> data), (override));
+
+    auto Loan(size_t size) -> DataPublisherLoan override
+    {
+        loanBuffer.resize(size);
+        return DataPublisherLoan{loanBuffer, this,
+                                 [](void* handle) { static_cast<MockDataPublisher*>(handle)->ReleaseLoan(); }};
+    }
+
+    void PublishLoan(DataPublisherLoan loan) override
+    {
+        const auto data = loan.Data();
+        (void)loan.ReleaseHandle();
+        PublishLoanedData(data);
+    }
+
+    MOCK_METHOD(void, PublishLoanedData, (SilKit::Util::Span<uint8_t> data));
+    MOCK_METHOD(void, ReleaseLoan, ());
+
+    std::vector<uint8_t> loanBuffer;
 };
 
 class MockDataSubscriber : public SilKit::Services::PubSub::IDataSubscriber
@@ -276,4 +295,69 @@ TEST_F(Test_CapiData, data_publisher_publish)
     EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
 }
 
+TEST_F(Test_CapiData, data_publisher_publish_loan)
+{
+    SilKit_ReturnCode returnCode = 0;
+    SilKit_DataPublisherLoan* loan = nullptr;
+    uint8_t* data = nullptr;
+
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 8, &loan, &data);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    ASSERT_NE(loan, nullptr);
+    ASSERT_EQ(data, mockDataPublisher.loanBuffer.data());
+
+    const std::vector<uint8_t> refData{'P', 'U', 'B', 'S', 'U', 'B', ' ', '1'};
+    std::copy(refData.begin(), refData.end(), data);
+
+    EXPECT_CALL(mockDataPublisher, PublishLoanedData(PayloadMatcher(refData))).Times(testing::Exactly(1));
+    EXPECT_CALL(mockDataPublisher, ReleaseLoan()).Times(0);
+    returnCode = SilKit_DataPublisher_PublishLoan((SilKit_DataPublisher*)&mockDataPublisher, loan);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+}
+
+TEST_F(Test_CapiData, data_publisher_release_loan)
+{
+    SilKit_ReturnCode returnCode = 0;
+    SilKit_DataPublisherLoan* loan = nullptr;
+    uint8_t* data = nullptr;
+
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 8, &loan, &data);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockDataPublisher, PublishLoanedData(testing::_)).Times(0);
+    EXPECT_CALL(mockDataPublisher, ReleaseLoan()).Times(testing::Exactly(1));
+    returnCode = SilKit_DataPublisherLoan_Release(loan);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+}
+
+TEST_F(Test_CapiData, data_publisher_loan_bad_parameters)
+{
+    SilKit_ReturnCode returnCode = 0;
+    SilKit_DataPublisherLoan* loan = nullptr;
+    uint8_t* data = nullptr;
+
+    returnCode = SilKit_DataPublisher_Loan(nullptr, 8, &loan, &data);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 8, nullptr, &data);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 8, &loan, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_PublishLoan((SilKit_DataPublisher*)&mockDataPublisher, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisherLoan_Release(nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    // the loan is consumed even if publishing fails
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 8, &loan, &data);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockDataPublisher, ReleaseLoan()).Times(testing::Exactly(1));
+    returnCode = SilKit_DataPublisher_PublishLoan(nullptr, loan);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+}
+
 } // namespace
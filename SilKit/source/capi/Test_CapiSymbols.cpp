@@ -51,6 +51,9 @@ TEST(Test_CapiSymbols, DISABLED_link_all_public_symbols)
     (void)SilKit_DataPublisher_Create(nullptr, nullptr, "", nullptr, 0);
     (void)SilKit_DataSubscriber_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
     (void)SilKit_DataPublisher_Publish(nullptr, nullptr);
+    (void)SilKit_DataPublisher_Loan(nullptr, 0, nullptr, nullptr);
+    (void)SilKit_DataPublisher_PublishLoan(nullptr, nullptr);
+    (void)SilKit_DataPublisherLoan_Release(nullptr);
     (void)SilKit_DataSubscriber_SetDataMessageHandler(nullptr, nullptr, nullptr);
     (void)SilKit_EthernetController_Create(nullptr, nullptr, "", "");
     (void)SilKit_EthernetController_Activate(nullptr);
@@ -71,6 +71,10 @@ struct Sink
     Type type{Type::Remote};
     Services::Logging::Level level{Services::Logging::Level::Info};
     std::string logName;
+    //! \brief Remote sinks only: records buffered for the background sender. 0 sends synchronously.
+    uint32_t queueSize{1024};
+    //! \brief Remote sinks only: maximum number of records sent per second. 0 disables the limit.
+    uint32_t rateLimit{0};
 };
 
 //! \brief Logger service
@@ -95,9 +99,19 @@ struct TraceSink
         Mdf4File
     };
 
+    //! \brief What a trace call does when the sink's record queue is full.
+    enum class OverflowPolicy
+    {
+        Block, //!< Wait until the writer thread made room in the queue.
+        Drop   //!< Discard the record and count it as dropped.
+    };
+
     Type type{Type::Undefined};
     std::string name;
     std::string outputPath;
+    //! \brief Number of records buffered for the writer thread; 0 writes synchronously on the tracing thread.
+    int queueSize{4096};
+    OverflowPolicy overflowPolicy{OverflowPolicy::Block};
 };
 
 struct TraceSource
@@ -214,7 +228,8 @@ auto to_string(NetworkType networkType) -> std::string
 
 bool operator==(const Sink& lhs, const Sink& rhs)
 {
-    return lhs.type == rhs.type && lhs.level == rhs.level && lhs.logName == rhs.logName;
+    return lhs.type == rhs.type && lhs.level == rhs.level && lhs.logName == rhs.logName
+           && lhs.queueSize == rhs.queueSize && lhs.rateLimit == rhs.rateLimit;
 }
 
 bool operator<(const Sink& lhs, const Sink& rhs)
@@ -234,7 +249,8 @@ bool operator==(const Logging& lhs, const Logging& rhs)
 
 bool operator==(const TraceSink& lhs, const TraceSink& rhs)
 {
-    return lhs.name == rhs.name && lhs.outputPath == rhs.outputPath && lhs.type == rhs.type;
+    return lhs.name == rhs.name && lhs.outputPath == rhs.outputPath && lhs.type == rhs.type
+           && lhs.queueSize == rhs.queueSize && lhs.overflowPolicy == rhs.overflowPolicy;
 }
 
 bool operator==(const TraceSource& lhs, const TraceSource& rhs)
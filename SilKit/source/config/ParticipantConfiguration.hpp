@@ -261,6 +261,18 @@ struct Middleware
     bool experimentalRemoteParticipantConnection{true};
     //! Timeout for individual connection attempts (TCP, Local-Domain) and handshakes.
     double connectTimeoutSeconds{5.0};
+    //! Upper bound (in bytes) for queued messages which are combined into a single socket write. 0 disables batching.
+    int maxSendBatchSize{64 * 1024};
+    //! Messages larger than this (in bytes) are sent in chunks, interleaved with smaller messages. 0 disables chunking.
+    int messageChunkSize{0};
+    //! Number of worker threads which deserialize and dispatch received messages in parallel. 0 uses the I/O thread.
+    int ioWorkerThreads{0};
+    //! Execute the sim steps of synchronized participants on a dedicated thread instead of the I/O thread.
+    bool enableSimStepThread{false};
+    //! Co-located participants exchange messages via shared memory, if both sides support it.
+    bool enableSharedMemory{false};
+    //! Route the communication with all other participants through the registry instead of connecting to them directly.
+    bool registryAsHub{false};
 };
 
 // ================================================================================
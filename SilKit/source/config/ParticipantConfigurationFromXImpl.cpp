@@ -59,6 +59,12 @@ struct MiddlewareCache
     SilKit::Util::Optional<bool> enableDomainSockets;
     SilKit::Util::Optional<bool> registryAsFallbackProxy;
     SilKit::Util::Optional<bool> experimentalRemoteParticipantConnection;
+    SilKit::Util::Optional<int> maxSendBatchSize;
+    SilKit::Util::Optional<int> messageChunkSize;
+    SilKit::Util::Optional<int> ioWorkerThreads;
+    SilKit::Util::Optional<bool> enableSimStepThread;
+    SilKit::Util::Optional<bool> enableSharedMemory;
+    SilKit::Util::Optional<bool> registryAsHub;
 };
 
 struct GlobalLogCache
@@ -291,6 +297,12 @@ void CacheMiddleware(const YAML::Node& root, MiddlewareCache& cache)
     PopulateCacheField(root, "Middleware", "ExperimentalRemoteParticipantConnection",
                        cache.experimentalRemoteParticipantConnection);
     PopulateCacheField(root, "Middleware", "ConnectTimeoutSeconds", cache.connectTimeoutSeconds);
+    PopulateCacheField(root, "Middleware", "MaxSendBatchSize", cache.maxSendBatchSize);
+    PopulateCacheField(root, "Middleware", "MessageChunkSize", cache.messageChunkSize);
+    PopulateCacheField(root, "Middleware", "IoWorkerThreads", cache.ioWorkerThreads);
+    PopulateCacheField(root, "Middleware", "EnableSimStepThread", cache.enableSimStepThread);
+    PopulateCacheField(root, "Middleware", "EnableSharedMemory", cache.enableSharedMemory);
+    PopulateCacheField(root, "Middleware", "RegistryAsHub", cache.registryAsHub);
 }
 
 void CacheLoggingOptions(const YAML::Node& root, GlobalLogCache& cache)
@@ -435,6 +447,12 @@ void MergeMiddleware(const MiddlewareCache& cache, Middleware& middleware)
     MergeCacheField(cache.registryAsFallbackProxy, middleware.registryAsFallbackProxy);
     MergeCacheField(cache.experimentalRemoteParticipantConnection, middleware.experimentalRemoteParticipantConnection);
     MergeCacheField(cache.connectTimeoutSeconds, middleware.connectTimeoutSeconds);
+    MergeCacheField(cache.maxSendBatchSize, middleware.maxSendBatchSize);
+    MergeCacheField(cache.messageChunkSize, middleware.messageChunkSize);
+    MergeCacheField(cache.ioWorkerThreads, middleware.ioWorkerThreads);
+    MergeCacheField(cache.enableSimStepThread, middleware.enableSimStepThread);
+    MergeCacheField(cache.enableSharedMemory, middleware.enableSharedMemory);
+    MergeCacheField(cache.registryAsHub, middleware.registryAsHub);
 
     middleware.acceptorUris = cache.acceptorUris;
 }
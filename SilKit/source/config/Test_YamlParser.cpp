@@ -180,6 +180,10 @@ Logging:
   - Type: File
     Level: Critical
     LogName: MyLog1
+  - Type: Remote
+    Level: Debug
+    QueueSize: 256
+    RateLimit: 1000
   FlushLevel: Critical
   LogFromRemotes: false
 HealthCheck:
@@ -190,6 +194,8 @@ Tracing:
   - Name: Sink1
     OutputPath: FlexrayDemo_node0.mf4
     Type: Mdf4File
+    QueueSize: 1024
+    OverflowPolicy: Drop
   TraceSources:
   - Name: Source1
     InputPath: path/to/Source1.mf4
@@ -238,10 +244,14 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.dataPublishers.at(0).topic.has_value()
                 && config.dataPublishers.at(0).topic.value() == "Temperature");
 
-    EXPECT_TRUE(config.logging.sinks.size() == 1);
+    EXPECT_TRUE(config.logging.sinks.size() == 2);
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
     EXPECT_TRUE(config.logging.sinks.at(0).level == SilKit::Services::Logging::Level::Critical);
     EXPECT_TRUE(config.logging.sinks.at(0).logName == "MyLog1");
+    EXPECT_TRUE(config.logging.sinks.at(1).type == Sink::Type::Remote);
+    EXPECT_TRUE(config.logging.sinks.at(1).level == SilKit::Services::Logging::Level::Debug);
+    EXPECT_TRUE(config.logging.sinks.at(1).queueSize == 256);
+    EXPECT_TRUE(config.logging.sinks.at(1).rateLimit == 1000);
 
     EXPECT_TRUE(config.healthCheck.softResponseTimeout.value() == 500ms);
     EXPECT_TRUE(config.healthCheck.hardResponseTimeout.value() == 5000ms);
@@ -250,6 +260,8 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.tracing.traceSinks.at(0).name == "Sink1");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).outputPath == "FlexrayDemo_node0.mf4");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).type == TraceSink::Type::Mdf4File);
+    EXPECT_TRUE(config.tracing.traceSinks.at(0).queueSize == 1024);
+    EXPECT_TRUE(config.tracing.traceSinks.at(0).overflowPolicy == TraceSink::OverflowPolicy::Drop);
     EXPECT_TRUE(config.tracing.traceSources.size() == 1);
     EXPECT_TRUE(config.tracing.traceSources.at(0).name == "Source1");
     EXPECT_TRUE(config.tracing.traceSources.at(0).inputPath == "path/to/Source1.mf4");
@@ -338,6 +350,10 @@ TEST_F(Test_YamlParser, yaml_native_type_conversions)
         sink.type = Sink::Type::Stdout;
         sink.logName = "";
         logger.sinks.push_back(sink);
+        sink.type = Sink::Type::Remote;
+        sink.queueSize = 0;
+        sink.rateLimit = 500;
+        logger.sinks.push_back(sink);
         YAML::Node node;
         node = logger;
         //auto repr = node.as<std::string>();
@@ -364,7 +380,13 @@ TEST_F(Test_YamlParser, middleware_convert)
             "TcpSendBufferSize": 3456,
             "TcpReceiveBufferSize": 3456,
             "EnableDomainSockets": false,
-            "RegistryAsFallbackProxy": false
+            "RegistryAsFallbackProxy": false,
+            "MaxSendBatchSize": 8192,
+            "MessageChunkSize": 1048576,
+            "IoWorkerThreads": 4,
+            "EnableSimStepThread": true,
+            "EnableSharedMemory": true,
+            "RegistryAsHub": true
         }
     )");
     auto config = node.as<Middleware>();
@@ -377,6 +399,12 @@ TEST_F(Test_YamlParser, middleware_convert)
     EXPECT_EQ(config.tcpSendBufferSize, 3456);
     EXPECT_EQ(config.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.registryAsFallbackProxy, false);
+    EXPECT_EQ(config.maxSendBatchSize, 8192);
+    EXPECT_EQ(config.messageChunkSize, 1048576);
+    EXPECT_EQ(config.ioWorkerThreads, 4);
+    EXPECT_EQ(config.enableSimStepThread, true);
+    EXPECT_EQ(config.enableSharedMemory, true);
+    EXPECT_EQ(config.registryAsHub, true);
 }
 
 TEST_F(Test_YamlParser, map_serdes)
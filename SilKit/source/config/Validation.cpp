@@ -50,6 +50,11 @@ void ValidateTraceSinks(const SilKit::Config::v1::ParticipantConfiguration& conf
             throw SilKit::ConfigurationError{"On Participant " + configuration.participantName
                                              + ": TraceSink \"OutputPath\" must not be empty!"};
         }
+        if (sink.queueSize < 0)
+        {
+            throw SilKit::ConfigurationError{"On Participant " + configuration.participantName
+                                             + ": TraceSink \"QueueSize\" must not be negative!"};
+        }
         sinkNames.insert(sink.name);
     }
 
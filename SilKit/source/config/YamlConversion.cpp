@@ -105,6 +105,8 @@ Node Converter::encode(const Sink& obj)
     node["Type"] = obj.type;
     non_default_encode(obj.level, node, "Level", defaultSink.level);
     non_default_encode(obj.logName, node, "LogName", defaultSink.logName);
+    non_default_encode(obj.queueSize, node, "QueueSize", defaultSink.queueSize);
+    non_default_encode(obj.rateLimit, node, "RateLimit", defaultSink.rateLimit);
     return node;
 }
 template <>
@@ -112,6 +114,8 @@ bool Converter::decode(const Node& node, Sink& obj)
 {
     optional_decode(obj.type, node, "Type");
     optional_decode(obj.level, node, "Level");
+    optional_decode(obj.queueSize, node, "QueueSize");
+    optional_decode(obj.rateLimit, node, "RateLimit");
 
     if (obj.type == Sink::Type::File)
     {
@@ -793,10 +797,13 @@ bool Converter::decode(const Node& node, Tracing& obj)
 template <>
 Node Converter::encode(const TraceSink& obj)
 {
+    static const TraceSink defaultObj{};
     Node node;
     node["Name"] = obj.name;
     node["Type"] = obj.type;
     node["OutputPath"] = obj.outputPath;
+    non_default_encode(obj.queueSize, node, "QueueSize", defaultObj.queueSize);
+    non_default_encode(obj.overflowPolicy, node, "OverflowPolicy", defaultObj.overflowPolicy);
     // Only serialize if disabled
     //if (!obj.enabled)
     //{
@@ -811,6 +818,8 @@ bool Converter::decode(const Node& node, TraceSink& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     obj.type = parse_as<decltype(obj.type)>(node["Type"]);
     obj.outputPath = parse_as<decltype(obj.outputPath)>(node["OutputPath"]);
+    optional_decode(obj.queueSize, node, "QueueSize");
+    optional_decode(obj.overflowPolicy, node, "OverflowPolicy");
     //if (node["Enabled"])
     //{
     //    obj.enabled = parse_as<decltype(obj.enabled)>(node["Enabled"]);
@@ -860,6 +869,38 @@ bool Converter::decode(const Node& node, TraceSink::Type& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const TraceSink::OverflowPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case TraceSink::OverflowPolicy::Block:
+        node = "Block";
+        break;
+    case TraceSink::OverflowPolicy::Drop:
+        node = "Drop";
+        break;
+    default:
+        throw ConfigurationError{"Unknown TraceSink OverflowPolicy"};
+    }
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, TraceSink::OverflowPolicy& obj)
+{
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block" || str == "")
+        obj = TraceSink::OverflowPolicy::Block;
+    else if (str == "Drop")
+        obj = TraceSink::OverflowPolicy::Drop;
+    else
+    {
+        throw ConversionError(node, "Unknown TraceSink::OverflowPolicy: " + str + ".");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const TraceSource& obj)
 {
@@ -958,6 +999,12 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection",
                        defaultObj.experimentalRemoteParticipantConnection);
     non_default_encode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
+    non_default_encode(obj.maxSendBatchSize, node, "MaxSendBatchSize", defaultObj.maxSendBatchSize);
+    non_default_encode(obj.messageChunkSize, node, "MessageChunkSize", defaultObj.messageChunkSize);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.enableSimStepThread, node, "EnableSimStepThread", defaultObj.enableSimStepThread);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.registryAsHub, node, "RegistryAsHub", defaultObj.registryAsHub);
     return node;
 }
 template <>
@@ -974,6 +1021,12 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
     optional_decode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection");
     optional_decode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds");
+    optional_decode(obj.maxSendBatchSize, node, "MaxSendBatchSize");
+    optional_decode(obj.messageChunkSize, node, "MessageChunkSize");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.enableSimStepThread, node, "EnableSimStepThread");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.registryAsHub, node, "RegistryAsHub");
     return true;
 }
 
@@ -73,6 +73,7 @@ DEFINE_SILKIT_CONVERT(HealthCheck);
 DEFINE_SILKIT_CONVERT(Tracing);
 DEFINE_SILKIT_CONVERT(TraceSink);
 DEFINE_SILKIT_CONVERT(TraceSink::Type);
+DEFINE_SILKIT_CONVERT(TraceSink::OverflowPolicy);
 DEFINE_SILKIT_CONVERT(TraceSource);
 DEFINE_SILKIT_CONVERT(TraceSource::Type);
 
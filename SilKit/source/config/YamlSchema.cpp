@@ -45,6 +45,8 @@ auto MakeYamlSchema() -> YamlSchemaElem
                                                 {"Name"},
                                                 {"OutputPath"},
                                                 {"Type"},
+                                                {"QueueSize"},
+                                                {"OverflowPolicy"},
                                             });
     YamlSchemaElem traceSources("TraceSources", {
                                                     {"Name"},
@@ -60,6 +62,8 @@ auto MakeYamlSchema() -> YamlSchemaElem
                                                   {"Type"},
                                                   {"Level"},
                                                   {"LogName"},
+                                                  {"QueueSize"},
+                                                  {"RateLimit"},
                                               },
                                           },
 
@@ -194,6 +198,12 @@ auto MakeYamlSchema() -> YamlSchemaElem
              {"RegistryAsFallbackProxy"},
              {"ExperimentalRemoteParticipantConnection"},
              {"ConnectTimeoutSeconds"},
+             {"MaxSendBatchSize"},
+             {"MessageChunkSize"},
+             {"IoWorkerThreads"},
+             {"EnableSimStepThread"},
+             {"EnableSharedMemory"},
+             {"RegistryAsHub"},
          }}};
     return yamlSchema;
 }
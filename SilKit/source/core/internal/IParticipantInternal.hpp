@@ -157,6 +157,7 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, std::vector<Services::Logging::LogMsg>&& msgs) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Discovery::ParticipantDiscoveryEvent& msg) = 0;
@@ -259,6 +260,29 @@ public:
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const RequestReply::RequestReplyCallReturn& msg) = 0;
 
+    // targeted messaging to multiple participants, the message is serialized once for all targets
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Can::WireCanFrameEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Can::CanFrameTransmitEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Can::CanControllerStatus& msg) = 0;
+
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Ethernet::WireEthernetFrameEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets,
+                         const Services::Ethernet::EthernetFrameTransmitEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Ethernet::EthernetStatus& msg) = 0;
+
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::WireFlexrayFrameEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets,
+                         const Services::Flexray::WireFlexrayFrameTransmitEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexraySymbolEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets,
+                         const Services::Flexray::FlexraySymbolTransmitEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexrayCycleStartEvent& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexrayPocStatusEvent& msg) = 0;
+
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinTransmission& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinSendFrameHeaderRequest& msg) = 0;
+    virtual void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinWakeupPulse& msg) = 0;
+
     // For Connection/middleware support:
     virtual void OnAllMessagesDelivered(std::function<void()> callback) = 0;
     virtual void FlushSendBuffers() = 0;
@@ -48,6 +48,14 @@ public:
     virtual auto GetServiceDescriptor() const -> const ServiceDescriptor& = 0;
 };
 
+//! A single receiver of a message which is sent to multiple participants at once
+struct MessageTarget
+{
+    //! The endpoint the message is sent from, it must be the same link for all targets of a message
+    const IServiceEndpoint* from{nullptr};
+    std::string participantName;
+};
+
 inline bool AllowMessageProcessing(const ServiceDescriptor& lhs, const ServiceDescriptor& rhs)
 {
     return lhs.GetServiceId() == rhs.GetServiceId() && lhs.GetParticipantName() == rhs.GetParticipantName();
@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstring>
 #include <stdexcept>
 #include <map>
+#include <memory>
 
 #include "silkit/util/Span.hpp"
 
@@ -74,6 +75,9 @@ public:
     // Constructors and Destructor
     inline MessageBuffer() = default;
     inline MessageBuffer(std::vector<uint8_t> data);
+    //! Read-only view of size bytes at offset in a shared buffer, which is kept alive by the MessageBuffer.
+    //! The view is copied into a private storage once the MessageBuffer is written to or released.
+    inline MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> sharedStorage, size_t offset, size_t size);
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
@@ -117,6 +121,7 @@ public:
     {
         if (_wPos + sizeof(IntegerT) > _storage.size())
         {
+            DetachSharedStorage();
             _storage.resize(_storage.size() + sizeof(IntegerT));
         }
         std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
@@ -128,10 +133,10 @@ public:
     template <typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        if (_rPos + sizeof(IntegerT) > ReadSize())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, ReadData() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -147,6 +152,7 @@ public:
 
         if (_wPos + sizeof(DoubleT) > _storage.size())
         {
+            DetachSharedStorage();
             _storage.resize(_storage.size() + sizeof(DoubleT));
         }
 
@@ -161,10 +167,10 @@ public:
         static_assert(std::numeric_limits<double>::is_iec559,
                       "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > ReadSize())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, ReadData() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -255,14 +261,27 @@ public:
 public:
     void IncreaseCapacity(size_t capacity)
     {
+        DetachSharedStorage();
         _storage.reserve(_storage.size() + capacity);
     }
+    //! Copy the bytes of a read-only view into an own storage, releasing the shared buffer
+    inline void DetachSharedStorage();
+
+private:
+    // ----------------------------------------
+    // private methods
+    inline auto ReadData() const -> const uint8_t*;
+    inline auto ReadSize() const -> size_t;
 
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    // read-only view into a shared buffer, used instead of _storage while set
+    std::shared_ptr<const std::vector<uint8_t>> _sharedStorage;
+    std::size_t _sharedOffset{0u};
+    std::size_t _sharedSize{0u};
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
 };
@@ -277,8 +296,18 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> sharedStorage, size_t offset, size_t size)
+    : _sharedStorage{std::move(sharedStorage)}
+    , _sharedOffset{offset}
+    , _sharedSize{size}
+    , _wPos{size}
+    , _rPos{0u}
+{
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
+    DetachSharedStorage();
     _wPos = 0u;
     _rPos = 0u;
     return std::move(_storage);
@@ -286,7 +315,29 @@ auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    return (_rPos > ReadSize()) ? 0 : (ReadSize() - _rPos);
+}
+
+auto MessageBuffer::ReadData() const -> const uint8_t*
+{
+    return (_sharedStorage == nullptr) ? _storage.data() : (_sharedStorage->data() + _sharedOffset);
+}
+
+auto MessageBuffer::ReadSize() const -> size_t
+{
+    return (_sharedStorage == nullptr) ? _storage.size() : _sharedSize;
+}
+
+void MessageBuffer::DetachSharedStorage()
+{
+    if (_sharedStorage == nullptr)
+    {
+        return;
+    }
+
+    const auto begin = _sharedStorage->begin() + static_cast<std::ptrdiff_t>(_sharedOffset);
+    _storage.assign(begin, begin + static_cast<std::ptrdiff_t>(_sharedSize));
+    _sharedStorage.reset();
 }
 
 // --------------------------------------------------------------------------------
@@ -315,10 +366,11 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > ReadSize())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    // reuses the capacity of the string, e.g., when the messages of a batch are deserialized into the same object
+    str.assign(ReadData() + _rPos, ReadData() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -336,10 +388,10 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > ReadSize())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(ReadData() + _rPos, ReadData() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -370,7 +422,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > ReadSize())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -459,6 +511,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
 
     if (_wPos + array.size() > _storage.size())
     {
+        DetachSharedStorage();
         _storage.resize(_wPos + array.size());
     }
 
@@ -470,10 +523,10 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
 template <size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > ReadSize())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(ReadData() + _rPos, ReadData() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -495,7 +548,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template <typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > ReadSize())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -626,7 +679,7 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return {ReadData(), ReadSize()};
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
@@ -88,6 +88,11 @@ public:
     inline auto GetNetworkType() const -> SilKit::Config::NetworkType;
     inline void SetNetworkType(SilKit::Config::NetworkType val);
 
+    //! \brief Index of the network in the local connection, zero if not assigned. It is never transmitted.
+    inline auto GetNetworkIndex() const -> uint32_t;
+    //! \brief Only used by the connection when registering a service. Changing the network name resets the index.
+    inline void SetNetworkIndex(uint32_t val);
+
     inline auto GetServiceName() const -> const std::string&;
     inline void SetServiceName(std::string val);
 
@@ -126,6 +131,7 @@ private:
     ServiceType _serviceType{ServiceType::Undefined};
     std::string _networkName; //!< the service's link name
     SilKit::Config::NetworkType _networkType{SilKit::Config::NetworkType::Invalid};
+    uint32_t _networkIndex{0};
     std::string _serviceName;
     EndpointId _serviceId{0};
     SupplementalData _supplementalData;
@@ -190,6 +196,17 @@ auto ServiceDescriptor::GetNetworkName() const -> const std::string&
 void ServiceDescriptor::SetNetworkName(std::string val)
 {
     _networkName = std::move(val);
+    _networkIndex = 0;
+}
+
+auto ServiceDescriptor::GetNetworkIndex() const -> uint32_t
+{
+    return _networkIndex;
+}
+
+void ServiceDescriptor::SetNetworkIndex(uint32_t val)
+{
+    _networkIndex = val;
 }
 
 auto ServiceDescriptor::GetNetworkType() const -> SilKit::Config::NetworkType
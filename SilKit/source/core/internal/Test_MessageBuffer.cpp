@@ -235,3 +235,39 @@ TEST(Test_MessageBuffer, mixed_types)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_MessageBuffer, shared_storage_view)
+{
+    SilKit::Core::MessageBuffer source;
+    source << uint32_t{0xdeadbeef} << std::string{"first"} << std::string{"second"};
+    const auto bytes = source.ReleaseStorage();
+
+    // embed the serialized data between some unrelated bytes
+    auto shared = std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t>{1, 2, 3});
+    shared->insert(shared->end(), bytes.begin(), bytes.end());
+    shared->insert(shared->end(), {4, 5, 6});
+
+    SilKit::Core::MessageBuffer buffer{shared, 3, bytes.size()};
+    EXPECT_EQ(buffer.RemainingBytesLeft(), bytes.size());
+
+    uint32_t value{0};
+    std::string first, second;
+    buffer >> value >> first >> second;
+
+    EXPECT_EQ(value, 0xdeadbeef);
+    EXPECT_EQ(first, "first");
+    EXPECT_EQ(second, "second");
+    EXPECT_EQ(buffer.RemainingBytesLeft(), 0u);
+    EXPECT_THROW(buffer >> value, SilKit::Core::end_of_buffer);
+}
+
+TEST(Test_MessageBuffer, shared_storage_is_copied_on_write)
+{
+    const auto shared = std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t>{0, 1, 2, 3, 4, 5});
+
+    SilKit::Core::MessageBuffer buffer{shared, 1, 4};
+    buffer << uint8_t{9};
+
+    EXPECT_EQ(*shared, (std::vector<uint8_t>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(buffer.ReleaseStorage(), (std::vector<uint8_t>{1, 2, 3, 4, 9}));
+}
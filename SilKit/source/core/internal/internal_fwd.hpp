@@ -25,26 +25,34 @@ namespace SilKit {
 namespace Services {
 namespace Can {
 class IMsgForCanSimulator;
+class CanController;
 } // namespace Can
 namespace Ethernet {
 class IMsgForEthSimulator;
+class EthController;
 } // namespace Ethernet
 namespace Flexray {
 class IMsgForFlexrayBusSimulator;
+class FlexrayController;
 } // namespace Flexray
 namespace Lin {
 class IMsgForLinSimulator;
+class LinController;
 } // namespace Lin
 namespace PubSub {
 class IMsgForDataPublisher;
 class IMsgForDataSubscriber;
 class IMsgForDataSubscriberInternal;
+class DataPublisher;
+class DataSubscriber;
 class DataSubscriberInternal;
 } // namespace PubSub
 namespace Rpc {
 class IMsgForRpcClient;
 class IMsgForRpcServer;
 class IMsgForRpcServerInternal;
+class RpcClient;
+class RpcServer;
 class RpcServerInternal;
 class RpcDiscoverer;
 } // namespace Rpc
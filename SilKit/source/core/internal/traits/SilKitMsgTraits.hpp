@@ -75,6 +75,16 @@ struct SilKitMsgTraitForbidSelfDelivery
         return false;
     }
 };
+// Payload messages of independent links may be sent ahead of a large message which is still being sent in chunks.
+// Messages relevant to the synchronization (e.g., NextSimTask) must never overtake other messages.
+template <class MsgT>
+struct SilKitMsgTraitOvertakeChunked
+{
+    static constexpr bool MayOvertakeChunkedMessages()
+    {
+        return false;
+    }
+};
 
 // The final message traits
 template <class MsgT>
@@ -85,6 +95,7 @@ struct SilKitMsgTraits
     , SilKitMsgTraitVersion<MsgT>
     , SilKitMsgTraitSerdesName<MsgT>
     , SilKitMsgTraitForbidSelfDelivery<MsgT>
+    , SilKitMsgTraitOvertakeChunked<MsgT>
 {
 };
 
@@ -124,6 +135,15 @@ struct SilKitMsgTraits
             return true; \
         } \
     };
+#define DefineSilKitMsgTrait_OvertakeChunked(Namespace, MsgName) \
+    template <> \
+    struct SilKitMsgTraitOvertakeChunked<Namespace::MsgName> \
+    { \
+        static constexpr bool MayOvertakeChunkedMessages() \
+        { \
+            return true; \
+        } \
+    };
 
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg) DefineSilKitMsgTrait_TypeName(
     SilKit::Services::Orchestration,
@@ -209,5 +229,12 @@ DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg) DefineSilKitMsg
     // Messages with forbidden self delivery
     DefineSilKitMsgTrait_ForbidSelfDelivery(SilKit::Services::Orchestration, SystemCommand)
 
+    // Messages which may overtake chunked messages of other links
+    DefineSilKitMsgTrait_OvertakeChunked(SilKit::Services::PubSub, WireDataMessageEvent)
+        DefineSilKitMsgTrait_OvertakeChunked(SilKit::Services::Rpc, FunctionCall)
+            DefineSilKitMsgTrait_OvertakeChunked(SilKit::Services::Rpc, FunctionCallResponse)
+                DefineSilKitMsgTrait_OvertakeChunked(SilKit::Services::Can, WireCanFrameEvent)
+                    DefineSilKitMsgTrait_OvertakeChunked(SilKit::Services::Ethernet, WireEthernetFrameEvent)
+
 } // namespace Core
 } // namespace SilKit
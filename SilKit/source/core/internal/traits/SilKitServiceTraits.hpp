@@ -35,9 +35,20 @@ struct SilKitServiceTraitUseAsyncRegistration
     }
 };
 
+template <class SilKitServiceT>
+struct SilKitServiceTraitUseDeferredRegistration
+{
+    static constexpr bool UseDeferredRegistration()
+    {
+        return false;
+    }
+};
+
 // The final service traits
 template <class SilKitServiceT>
-struct SilKitServiceTraits : SilKitServiceTraitUseAsyncRegistration<SilKitServiceT>
+struct SilKitServiceTraits
+    : SilKitServiceTraitUseAsyncRegistration<SilKitServiceT>
+    , SilKitServiceTraitUseDeferredRegistration<SilKitServiceT>
 {
 };
 
@@ -60,6 +71,27 @@ DefineSilKitServiceTrait_UseAsyncRegistration(SilKit::Services::Ethernet, IMsgFo
 DefineSilKitServiceTrait_UseAsyncRegistration(SilKit::Services::Flexray, IMsgForFlexraySimulator);
 DefineSilKitServiceTrait_UseAsyncRegistration(SilKit::Services::Lin, IMsgForLinSimulator);
 
+#define DefineSilKitServiceTrait_UseDeferredRegistration(Namespace, ServiceName) \
+    template <> \
+    struct SilKitServiceTraitUseDeferredRegistration<Namespace::ServiceName> \
+    { \
+        static constexpr bool UseDeferredRegistration() \
+        { \
+            return true; \
+        } \
+    }
+
+// Services that are registered asynchronously, if they are created before the lifecycle is initializing the
+// communication (see VAsioConnection::DeferServiceRegistrations). Otherwise, they are registered synchronously.
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Can, CanController);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Ethernet, EthController);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Flexray, FlexrayController);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Lin, LinController);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::PubSub, DataPublisher);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::PubSub, DataSubscriber);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Rpc, RpcClient);
+DefineSilKitServiceTrait_UseDeferredRegistration(SilKit::Services::Rpc, RpcServer);
+
 
 } // namespace Core
 } // namespace SilKit
@@ -57,11 +57,21 @@ struct NullConnection
     {
     }
 
+    template <typename SilKitMessageT>
+    void SendMsgs(const Core::IServiceEndpoint* /*from*/, std::vector<SilKitMessageT>&& /*msgs*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const Core::IServiceEndpoint* /*from*/, const std::string& /*target*/, SilKitMessageT&& /*msg*/)
     {
     }
 
+    template <typename SilKitMessageT>
+    void SendMsg(std::vector<MessageTarget> /*targets*/, SilKitMessageT&& /*msg*/)
+    {
+    }
+
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
@@ -70,6 +80,7 @@ struct NullConnection
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* /*peer*/, ParticipantAnnouncement)> /*callback*/) {}
     void RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> /*callback*/) {}
 
+    void DeferServiceRegistrations() {}
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/) {}
 
     size_t GetNumberOfConnectedParticipants()
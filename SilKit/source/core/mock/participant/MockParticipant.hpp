@@ -135,7 +135,7 @@ public:
     MOCK_METHOD(void, RegisterServiceDiscoveryHandler, (SilKit::Core::Discovery::ServiceDiscoveryHandler handler),
                 (override));
     MOCK_METHOD(void, RegisterSpecificServiceDiscoveryHandler,
-                (SilKit::Core::Discovery::ServiceDiscoveryHandler handler, const std::string& controllerType,
+                (SilKit::Core::Discovery::SpecificServiceDiscoveryHandler handler, const std::string& controllerType,
                  const std::string& topic, const std::vector<SilKit::Services::MatchingLabel>& labels),
                 (override));
     MOCK_METHOD(std::vector<ServiceDescriptor>, GetServices, (), (const, override));
@@ -356,6 +356,7 @@ public:
     }
 
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsg&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, std::vector<Services::Logging::LogMsg>&& /*msgs*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsg& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
@@ -540,6 +541,52 @@ public:
     {
     }
 
+    // targeted messaging to multiple participants
+
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Can::WireCanFrameEvent& /*msg*/) override {}
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Can::CanFrameTransmitEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Can::CanControllerStatus& /*msg*/) override {}
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Ethernet::WireEthernetFrameEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Ethernet::EthernetFrameTransmitEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Ethernet::EthernetStatus& /*msg*/) override {}
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Flexray::WireFlexrayFrameEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Flexray::WireFlexrayFrameTransmitEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Flexray::FlexraySymbolEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Flexray::FlexraySymbolTransmitEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Flexray::FlexrayCycleStartEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Flexray::FlexrayPocStatusEvent& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Lin::LinTransmission& /*msg*/) override {}
+    void SendMsg(std::vector<MessageTarget> /*targets*/,
+                 const Services::Lin::LinSendFrameHeaderRequest& /*msg*/) override
+    {
+    }
+    void SendMsg(std::vector<MessageTarget> /*targets*/, const Services::Lin::LinWakeupPulse& /*msg*/) override {}
+
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) override {}
     void FlushSendBuffers() override {}
@@ -104,6 +104,7 @@ public:
     Participant(const Participant&) = default;
     Participant(Participant&&) = default;
     Participant(Config::ParticipantConfiguration participantConfig, ProtocolVersion version = CurrentProtocolVersion());
+    ~Participant() override;
 
 public:
     // ----------------------------------------
@@ -212,6 +213,7 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, std::vector<Services::Logging::LogMsg>&& msgs) override;
 
     void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) override;
@@ -318,6 +320,28 @@ public:
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const RequestReply::RequestReplyCallReturn& msg) override;
 
+    // targeted messaging to multiple participants
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Can::WireCanFrameEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Can::CanFrameTransmitEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Can::CanControllerStatus& msg) override;
+
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Ethernet::WireEthernetFrameEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets,
+                 const Services::Ethernet::EthernetFrameTransmitEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Ethernet::EthernetStatus& msg) override;
+
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::WireFlexrayFrameEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets,
+                 const Services::Flexray::WireFlexrayFrameTransmitEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexraySymbolEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexraySymbolTransmitEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexrayCycleStartEvent& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Flexray::FlexrayPocStatusEvent& msg) override;
+
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinTransmission& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinSendFrameHeaderRequest& msg) override;
+    void SendMsg(std::vector<MessageTarget> targets, const Services::Lin::LinWakeupPulse& msg) override;
+
     void OnAllMessagesDelivered(std::function<void()> callback) override;
     void FlushSendBuffers() override;
     void ExecuteDeferred(std::function<void()> callback) override;
@@ -398,6 +422,8 @@ private:
     void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg);
     template <class SilKitMessageT>
     void SendMsgImpl(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg);
+    template <typename SilKitMessageT>
+    void SendMsgImpl(std::vector<MessageTarget> targets, SilKitMessageT&& msg);
 
     template <class ControllerT>
     auto GetController(const std::string& serviceName) -> ControllerT*;
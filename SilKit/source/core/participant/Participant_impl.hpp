@@ -103,6 +103,27 @@ Participant<SilKitConnectionT>::Participant(Config::ParticipantConfiguration par
                   _participantConfig.middleware.registryUri, Version::StringImpl());
 }
 
+template <class SilKitConnectionT>
+Participant<SilKitConnectionT>::~Participant()
+{
+    // NB: Queued remote log records are sent from a background thread through the LogMsgSender, which is destroyed
+    //  together with the other controllers before the logger.
+    auto* logger = dynamic_cast<Services::Logging::Logger*>(_logger.get());
+    if (logger != nullptr)
+    {
+        logger->DisableRemoteLogging();
+    }
+
+    // NB: The connection is destroyed before the controllers. Sim steps executed on the dedicated sim step thread send
+    //  messages, so the thread must be stopped while the connection is still alive.
+    auto* timeSyncService =
+        GetController<Orchestration::TimeSyncService>(SilKit::Core::Discovery::controllerTypeTimeSyncService);
+    if (timeSyncService != nullptr)
+    {
+        timeSyncService->StopSimStepThread();
+    }
+}
+
 
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::JoinSilKitSimulation()
@@ -176,8 +197,8 @@ void Participant<SilKitConnectionT>::SetupRemoteLogging()
             auto&& logMsgSender =
                 CreateController<Services::Logging::LogMsgSender>(config, std::move(supplementalData), true);
 
-            logger->RegisterRemoteLogging([logMsgSender](Services::Logging::LogMsg logMsg) {
-                logMsgSender->SendLogMsg(std::move(logMsg));
+            logger->RegisterBatchedRemoteLogging([logMsgSender](std::vector<Services::Logging::LogMsg> logMsgs) {
+                logMsgSender->SendLogMsgs(std::move(logMsgs));
             });
         }
     }
@@ -722,7 +743,7 @@ auto Participant<SilKitConnectionT>::CreateTimeSyncService(Orchestration::Lifecy
     config.network = "default";
     timeSyncService = CreateController<Orchestration::TimeSyncService>(
         config, std::move(timeSyncSupplementalData), false, &_timeProvider, _participantConfig.healthCheck,
-        lifecycleService);
+        lifecycleService, _participantConfig.middleware.enableSimStepThread);
 
     return timeSyncService;
 }
@@ -797,6 +818,10 @@ auto Participant<SilKitConnectionT>::CreateLifecycleService(
     dynamic_cast<SilKit::Services::Orchestration::LifecycleService*>(lifecycleService)
         ->SetLifecycleConfiguration(startConfiguration);
 
+    // controllers created from now on only need to be subscribed once the communication is initializing, which allows
+    // to subscribe all of them at once
+    _connection.DeferServiceRegistrations();
+
     Logging::Trace(GetLogger(), "Created Lifecycle with operating mode {}",
                    FormatLifecycleConfigurationForLogging(startConfiguration));
 
@@ -1210,6 +1235,18 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             std::vector<Services::Logging::LogMsg>&& msgs)
+{
+    for (const auto& msg : msgs)
+    {
+        TraceTx(GetLogger(), from, msg);
+    }
+    // A single task on the I/O thread for the whole batch
+    _connection.SendMsgs(from, std::move(msgs));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
                                              const Discovery::ParticipantDiscoveryEvent& msg)
@@ -1541,6 +1578,116 @@ void Participant<SilKitConnectionT>::SendMsgImpl(const IServiceEndpoint* from, c
     _connection.SendMsg(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
 }
 
+// Targeted messaging to multiple participants
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Can::WireCanFrameEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Can::CanFrameTransmitEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Can::CanControllerStatus& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Ethernet::WireEthernetFrameEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Ethernet::EthernetFrameTransmitEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Ethernet::EthernetStatus& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Flexray::WireFlexrayFrameEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Flexray::WireFlexrayFrameTransmitEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Flexray::FlexraySymbolEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Flexray::FlexraySymbolTransmitEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Flexray::FlexrayCycleStartEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Flexray::FlexrayPocStatusEvent& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Lin::LinTransmission& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets,
+                                             const Lin::LinSendFrameHeaderRequest& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(std::vector<MessageTarget> targets, const Lin::LinWakeupPulse& msg)
+{
+    SendMsgImpl(std::move(targets), msg);
+}
+
+template <class SilKitConnectionT>
+template <typename SilKitMessageT>
+void Participant<SilKitConnectionT>::SendMsgImpl(std::vector<MessageTarget> targets, SilKitMessageT&& msg)
+{
+    for (const auto& target : targets)
+    {
+        TraceTx(GetLogger(), target.from, msg);
+    }
+    _connection.SendMsg(std::move(targets), std::forward<SilKitMessageT>(msg));
+}
+
 
 template <class SilKitConnectionT>
 template <class ControllerT>
@@ -32,6 +32,10 @@ namespace Discovery {
 
 using ServiceDiscoveryHandler =
     std::function<void(ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor&)>;
+//! The labels of the discovered service are parsed once by the service discovery and passed to all handlers
+using SpecificServiceDiscoveryHandler =
+    std::function<void(ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor&,
+                       const std::vector<SilKit::Services::MatchingLabel>& serviceLabels)>;
 
 class IServiceDiscovery
 {
@@ -46,7 +50,7 @@ public:
     //!< Register a handler for service creation notifications for a specific controllerTypeName,
     //!< associated supplDataKey and given supplDataValue
     virtual void RegisterSpecificServiceDiscoveryHandler(
-        ServiceDiscoveryHandler handler, const std::string& controllerType, const std::string& topic,
+        SpecificServiceDiscoveryHandler handler, const std::string& controllerType, const std::string& topic,
         const std::vector<SilKit::Services::MatchingLabel>& labels) = 0;
     //!< Get the currently known created services on other participants
     virtual std::vector<ServiceDescriptor> GetServices() const = 0;
@@ -114,10 +114,70 @@ void ServiceDiscovery::NotifyServiceCreated(const ServiceDescriptor& serviceDesc
     // No self delivery for ServiceDiscoveryEvent, trigger directly in this thread context
     OnServiceAddition(serviceDescriptor);
 
-    ServiceDiscoveryEvent event;
-    event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
-    event.serviceDescriptor = serviceDescriptor;
-    _participant->SendMsg(this, std::move(event));
+    std::unique_lock<decltype(_announcementsMx)> lock(_announcementsMx);
+
+    std::string supplControllerTypeName;
+    serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName);
+
+    // Other participants react on our own ServiceDiscovery service by requesting all our services, announce it
+    // immediately and as a single event
+    if (supplControllerTypeName == Core::Discovery::controllerTypeServiceDiscovery)
+    {
+        SendPendingAnnouncements();
+
+        ServiceDiscoveryEvent event;
+        event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+        event.serviceDescriptor = serviceDescriptor;
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    // Services are usually created in bursts, coalesce all creations until the deferred flush runs
+    _pendingAnnouncements.push_back(serviceDescriptor);
+    if (_flushScheduled)
+    {
+        return;
+    }
+    _flushScheduled = true;
+    lock.unlock();
+
+    _participant->ExecuteDeferred([this] { FlushPendingAnnouncements(); });
+}
+
+void ServiceDiscovery::FlushPendingAnnouncements()
+{
+    std::unique_lock<decltype(_announcementsMx)> lock(_announcementsMx);
+    _flushScheduled = false;
+    if (_shuttingDown)
+    {
+        return;
+    }
+    SendPendingAnnouncements();
+}
+
+void ServiceDiscovery::SendPendingAnnouncements()
+{
+    if (_pendingAnnouncements.empty())
+    {
+        return;
+    }
+
+    if (_pendingAnnouncements.size() == 1)
+    {
+        ServiceDiscoveryEvent event;
+        event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+        event.serviceDescriptor = std::move(_pendingAnnouncements.front());
+        _pendingAnnouncements.clear();
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    // Receivers merge the services of a ParticipantDiscoveryEvent with the ones they already know
+    ParticipantDiscoveryEvent batch;
+    batch.participantName = _participantName;
+    batch.services = std::move(_pendingAnnouncements);
+    _pendingAnnouncements.clear();
+    _participant->SendMsg(this, std::move(batch));
 }
 
 void ServiceDiscovery::NotifyServiceRemoved(const ServiceDescriptor& serviceDescriptor)
@@ -130,6 +190,10 @@ void ServiceDiscovery::NotifyServiceRemoved(const ServiceDescriptor& serviceDesc
     // No self delivery for ServiceDiscoveryEvent, trigger directly in this thread context
     OnServiceRemoval(serviceDescriptor);
 
+    // The removal must not overtake the announcement of the service
+    std::unique_lock<decltype(_announcementsMx)> lock(_announcementsMx);
+    SendPendingAnnouncements();
+
     ServiceDiscoveryEvent event;
     event.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
     event.serviceDescriptor = serviceDescriptor;
@@ -260,7 +324,7 @@ void ServiceDiscovery::RegisterServiceDiscoveryHandler(ServiceDiscoveryHandler h
 }
 
 void ServiceDiscovery::RegisterSpecificServiceDiscoveryHandler(
-    ServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& topic,
+    SpecificServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& topic,
     const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
     if (_shuttingDown)
@@ -58,8 +58,8 @@ public: //IServiceDiscovery
     //!< Register a handler for asynchronous service creation notifications
     void RegisterServiceDiscoveryHandler(ServiceDiscoveryHandler handler) override;
     //!< Register a specific handler for asynchronous service creation notifications
-    void RegisterSpecificServiceDiscoveryHandler(ServiceDiscoveryHandler handler, const std::string& controllerType,
-                                                 const std::string& topic,
+    void RegisterSpecificServiceDiscoveryHandler(SpecificServiceDiscoveryHandler handler,
+                                                 const std::string& controllerType, const std::string& topic,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels) override;
 
     //!< Get all currently known services, including from ourselves
@@ -91,6 +91,11 @@ private: // Methods
     //!< Inform about service changes
     void CallHandlers(ServiceDiscoveryEvent::Type eventType, const ServiceDescriptor& serviceDescriptor) const;
 
+    //!< Send all queued service creations in a single message, called from the deferred flush
+    void FlushPendingAnnouncements();
+    //!< Send all queued service creations, must be used with a lock on _announcementsMx
+    void SendPendingAnnouncements();
+
 private:
     IParticipantInternal* _participant{nullptr};
     std::string _participantName;
@@ -102,6 +107,10 @@ private:
     SpecificDiscoveryStore _specificDiscoveryStore;
     mutable std::recursive_mutex _discoveryMx;
     std::atomic<bool> _shuttingDown{false};
+    //!< locally created services which are not yet announced to other participants
+    std::vector<ServiceDescriptor> _pendingAnnouncements;
+    bool _flushScheduled{false};
+    std::mutex _announcementsMx;
 };
 
 } // namespace Discovery
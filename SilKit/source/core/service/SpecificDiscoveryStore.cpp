@@ -27,6 +27,11 @@ inline auto MakeFilter(const std::string& type,
 {
     return std::make_tuple(type, topicOrFunction);
 }
+
+inline auto MakeNodeId(const SilKit::Core::ServiceDescriptor& serviceDescriptor) -> SilKit::Core::Discovery::NodeId
+{
+    return std::make_tuple(serviceDescriptor.GetParticipantId(), serviceDescriptor.GetServiceId());
+}
 } // end namespace
 namespace SilKit {
 namespace Core {
@@ -60,7 +65,7 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
                 std::string labelsStr;
                 if (serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientLabels, labelsStr))
                 {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
+                    labels = ParseLabels(labelsStr);
                 }
             }
             else if (supplControllerTypeName == controllerTypeDataPublisher)
@@ -72,7 +77,7 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
                 std::string labelsStr;
                 if (serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
                 {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
+                    labels = ParseLabels(labelsStr);
                 }
             }
 
@@ -91,7 +96,7 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
 
 // A new subscriber shows up -> notify of all earlier services
 void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
-    const ServiceDiscoveryHandler& handler, const std::string& controllerType_, const std::string& key,
+    const SpecificServiceDiscoveryHandler& handler, const std::string& controllerType_, const std::string& key,
     const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
     // pre filter key and mediaType
@@ -99,33 +104,29 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
 
     auto* greedyLabel = GetLabelWithMinimalNodeSet(entry, labels);
 
+    auto notify = [&handler, &entry](const DiscoveryCluster& cluster) {
+        for (auto&& serviceDescriptor : cluster.nodes)
+        {
+            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor,
+                    entry.nodeLabels[MakeNodeId(serviceDescriptor)]);
+        }
+    };
+
     if (greedyLabel == nullptr)
     {
         // no labels present trigger all
-        for (auto&& serviceDescriptor : entry.allCluster.nodes)
-        {
-            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-        }
+        notify(entry.allCluster);
     }
     else
     {
         if (greedyLabel->kind == SilKit::Services::MatchingLabel::Kind::Optional)
         {
             // trigger notlabel handlers
-            for (auto&& serviceDescriptor : entry.notLabelMap[greedyLabel->key].nodes)
-            {
-                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-            }
-            for (auto&& serviceDescriptor : entry.noLabelCluster.nodes)
-            {
-                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-            }
+            notify(entry.notLabelMap[greedyLabel->key]);
+            notify(entry.noLabelCluster);
         }
         // trigger label handlers
-        for (auto&& serviceDescriptor : entry.labelMap[MakeFilter(greedyLabel->key, greedyLabel->value)].nodes)
-        {
-            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-        }
+        notify(entry.labelMap[MakeFilter(greedyLabel->key, greedyLabel->value)]);
     }
 }
 
@@ -148,7 +149,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         {
             if (handler)
             {
-                (*handler)(eventType, serviceDescriptor);
+                (*handler)(eventType, serviceDescriptor, labels);
             }
         }
     }
@@ -161,14 +162,14 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
             {
                 if (handler)
                 {
-                    (*handler)(eventType, serviceDescriptor);
+                    (*handler)(eventType, serviceDescriptor, labels);
                 }
             }
             for (auto&& handler : entry.noLabelCluster.handlers)
             {
                 if (handler)
                 {
-                    (*handler)(eventType, serviceDescriptor);
+                    (*handler)(eventType, serviceDescriptor, labels);
                 }
             }
         }
@@ -177,7 +178,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         {
             if (handler)
             {
-                (*handler)(eventType, serviceDescriptor);
+                (*handler)(eventType, serviceDescriptor, labels);
             }
         }
     }
@@ -340,6 +341,7 @@ void SpecificDiscoveryStore::InsertLookupNode(const std::string& controllerType_
                                               const std::vector<SilKit::Services::MatchingLabel>& labels,
                                               const ServiceDescriptor& serviceDescriptor)
 {
+    _lookup[MakeFilter(controllerType_, key)].nodeLabels[MakeNodeId(serviceDescriptor)] = labels;
     UpdateDiscoveryClusters(controllerType_, key, labels,
                             [&serviceDescriptor](auto& cluster) { cluster.nodes.push_back(serviceDescriptor); });
 }
@@ -348,6 +350,7 @@ void SpecificDiscoveryStore::RemoveLookupNode(const std::string& controllerType_
                                               const ServiceDescriptor& serviceDescriptor)
 {
     auto& entry = _lookup[MakeFilter(controllerType_, key)];
+    entry.nodeLabels.erase(MakeNodeId(serviceDescriptor));
     entry.allCluster.nodes.erase(
         std::remove(entry.allCluster.nodes.begin(), entry.allCluster.nodes.end(), serviceDescriptor),
         entry.allCluster.nodes.end());
@@ -371,7 +374,7 @@ void SpecificDiscoveryStore::RemoveLookupNode(const std::string& controllerType_
 
 void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerType_, const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels,
-                                                 ServiceDiscoveryHandler handler)
+                                                 SpecificServiceDiscoveryHandler handler)
 {
     auto handlerPtr = std::make_shared<decltype(handler)>(std::move(handler));
     UpdateDiscoveryClusters(controllerType_, key, labels,
@@ -379,13 +382,23 @@ void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerTy
 }
 
 void SpecificDiscoveryStore::RegisterSpecificServiceDiscoveryHandler(
-    ServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& key,
+    SpecificServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& key,
     const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
     CallHandlerOnHandlerRegistration(handler, controllerType_, key, labels);
     InsertLookupHandler(controllerType_, key, labels, handler);
 }
 
+auto SpecificDiscoveryStore::ParseLabels(const std::string& labelsStr) -> MatchingLabels
+{
+    // Most services have no labels, which does not require the YAML parser
+    if (labelsStr.empty() || labelsStr == "[]")
+    {
+        return {};
+    }
+    return SilKit::Config::Deserialize<MatchingLabels>(labelsStr);
+}
+
 } // namespace Discovery
 } // namespace Core
 } // namespace SilKit
@@ -27,6 +27,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <string>
 #include <functional>
 #include <map>
+#include <tuple>
+#include <vector>
 
 #include "IServiceDiscovery.hpp"
 #include "Hash.hpp"
@@ -48,7 +50,9 @@ struct FilterTypeHash
     }
 };
 
-using HandlerValue = std::shared_ptr<ServiceDiscoveryHandler>;
+using HandlerValue = std::shared_ptr<SpecificServiceDiscoveryHandler>;
+using MatchingLabels = std::vector<SilKit::Services::MatchingLabel>;
+using NodeId = std::tuple<ParticipantId, EndpointId>;
 
 //! Stores all potential nodes (service descriptors) and handlers to call for a specific data matching branch
 class DiscoveryCluster
@@ -70,6 +74,8 @@ public:
     DiscoveryCluster noLabelCluster;
     //!< Stores all handlers/nodes for a controllerType and key
     DiscoveryCluster allCluster;
+    //!< Stores the parsed labels of all nodes, identified by participant and service id
+    std::map<NodeId, MatchingLabels> nodeLabels;
 };
 
 //! Store to prevent quadratic lookup of services
@@ -92,8 +98,8 @@ public:
     *   Note: handler might be called for service discovery events that only if a subset of the parameter constraints
     *   Implementation is not thread safe, all public API interactions must be secured with a common mutex
     */
-    void RegisterSpecificServiceDiscoveryHandler(ServiceDiscoveryHandler handler, const std::string& controllerType,
-                                                 const std::string& key,
+    void RegisterSpecificServiceDiscoveryHandler(SpecificServiceDiscoveryHandler handler,
+                                                 const std::string& controllerType, const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels);
 
 private: //methods
@@ -104,8 +110,8 @@ private: //methods
                                      const ServiceDescriptor& serviceDescriptor);
 
     //!< Trigger handler for past events that happened before registration
-    void CallHandlerOnHandlerRegistration(const ServiceDiscoveryHandler& handler, const std::string& controllerType,
-                                          const std::string& topic,
+    void CallHandlerOnHandlerRegistration(const SpecificServiceDiscoveryHandler& handler,
+                                          const std::string& controllerType, const std::string& topic,
                                           const std::vector<SilKit::Services::MatchingLabel>& labels);
 
     //!< Update the internal lookup structure when a service discovery event happened
@@ -141,7 +147,10 @@ private: //methods
     //!< Insert a new lookup handler
     void InsertLookupHandler(const std::string& controllerType, const std::string& key,
                              const std::vector<SilKit::Services::MatchingLabel>& labels,
-                             ServiceDiscoveryHandler handler);
+                             SpecificServiceDiscoveryHandler handler);
+
+    //!< Parse the labels of a service, which are serialized in its supplemental data
+    static auto ParseLabels(const std::string& labelsStr) -> MatchingLabels;
 
 private: //member
     //!< SpecificDiscoveryStore is only available to a a sub set of controllers
@@ -54,6 +54,43 @@ public:
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ServiceDiscoveryEvent&), (override));
 };
 
+class MockParticipantWithDeferredExecution : public MockParticipant
+{
+public:
+    void ExecuteDeferred(std::function<void()> callback) override
+    {
+        deferred.emplace_back(std::move(callback));
+    }
+
+    void RunDeferred()
+    {
+        auto callbacks = std::move(deferred);
+        deferred.clear();
+        for (auto&& callback : callbacks)
+        {
+            callback();
+        }
+    }
+
+    std::vector<std::function<void()>> deferred;
+};
+
+MATCHER_P2(ParticipantDiscoveryEventWith, participantName, serviceNames, "")
+{
+    if (arg.participantName != participantName || arg.services.size() != serviceNames.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < serviceNames.size(); ++i)
+    {
+        if (arg.services[i].GetServiceName() != serviceNames[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 class Callbacks
 {
 public:
@@ -214,4 +251,64 @@ TEST_F(Test_ServiceDiscovery, service_removal)
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(_, _)).Times(0);
     disco.ReceiveMsg(&otherParticipant, event);
 }
+
+TEST_F(Test_ServiceDiscovery, service_creations_are_announced_in_a_single_batch)
+{
+    MockParticipantWithDeferredExecution deferringParticipant;
+    ServiceDiscovery disco{&deferringParticipant, "ParticipantA"};
+
+    ServiceDescriptor descr;
+    descr.SetParticipantNameAndComputeId("ParticipantA");
+    descr.SetNetworkName("Link1");
+
+    const std::vector<std::string> serviceNames{"Service0", "Service1", "Service2"};
+
+    EXPECT_CALL(deferringParticipant, SendMsg(&disco, A<const ServiceDiscoveryEvent&>())).Times(0);
+    EXPECT_CALL(deferringParticipant, SendMsg(&disco, A<const ParticipantDiscoveryEvent&>())).Times(0);
+    for (const auto& serviceName : serviceNames)
+    {
+        descr.SetServiceName(serviceName);
+        disco.NotifyServiceCreated(descr);
+    }
+    // creations are visible locally before they are announced
+    ASSERT_EQ(disco.GetServices().size(), serviceNames.size());
+    ASSERT_EQ(deferringParticipant.deferred.size(), 1u) << "only a single flush must be scheduled";
+    Mock::VerifyAndClearExpectations(&deferringParticipant);
+
+    EXPECT_CALL(deferringParticipant,
+                SendMsg(&disco, Matcher<const ParticipantDiscoveryEvent&>(
+                                    ParticipantDiscoveryEventWith("ParticipantA", serviceNames))))
+        .Times(1);
+    deferringParticipant.RunDeferred();
+}
+
+TEST_F(Test_ServiceDiscovery, service_removal_does_not_overtake_pending_creations)
+{
+    MockParticipantWithDeferredExecution deferringParticipant;
+    ServiceDiscovery disco{&deferringParticipant, "ParticipantA"};
+
+    ServiceDescriptor descr;
+    descr.SetParticipantNameAndComputeId("ParticipantA");
+    descr.SetNetworkName("Link1");
+    descr.SetServiceName("TestService");
+
+    ServiceDiscoveryEvent created;
+    created.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+    created.serviceDescriptor = descr;
+    ServiceDiscoveryEvent removed;
+    removed.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
+    removed.serviceDescriptor = descr;
+
+    {
+        InSequence seq;
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, created)).Times(1);
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, removed)).Times(1);
+    }
+    disco.NotifyServiceCreated(descr);
+    disco.NotifyServiceRemoved(descr);
+    ASSERT_TRUE(disco.GetServices().empty());
+
+    // the flush has nothing left to send
+    deferringParticipant.RunDeferred();
+}
 } // namespace
@@ -33,7 +33,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "LabelMatching.hpp"
 #include "MockParticipant.hpp"
 #include "MockServiceEndpoint.hpp"
-#include "YamlParser.hpp"
 
 namespace {
 
@@ -272,7 +271,7 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_handler_then_service_discovery)
     noLabelTestDescriptor.SetServiceId(1);
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd, const auto& /*labels*/) {
         callbacks.ServiceDiscoveryHandler(discoveryType, sd);
     }, controllerTypeDataPublisher, "Topic1", {});
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, noLabelTestDescriptor))
@@ -302,7 +301,7 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_no_lab
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, noLabelTestDescriptor))
         .Times(1);
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd, const auto& /*labels*/) {
         callbacks.ServiceDiscoveryHandler(discoveryType, sd);
     }, controllerTypeDataPublisher, "Topic1", {});
 }
@@ -330,7 +329,7 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_labels
         .Times(1);
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd, const auto& /*labels*/) {
         callbacks.ServiceDiscoveryHandler(discoveryType, sd);
     }, controllerTypeDataPublisher, "Topic1", {label});
 }
@@ -372,13 +371,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
         {"kC", "vC", SilKit::Services::MatchingLabel::Kind::Optional}};
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this, optionalSubscriberLabels](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
-        std::vector<SilKit::Services::MatchingLabel> labels;
-        std::string labelsStr;
-        if (sd.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-        {
-            labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-        }
+        [this, optionalSubscriberLabels](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+                   const std::vector<SilKit::Services::MatchingLabel>& labels) {
         if (MatchLabels(labels, optionalSubscriberLabels))
         {
             callbacks.ServiceDiscoveryHandler(discoveryType, sd);
@@ -390,13 +384,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
         {"kB", "vB", SilKit::Services::MatchingLabel::Kind::Optional},
         {"kC", "vC", SilKit::Services::MatchingLabel::Kind::Optional}};
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this, optionalSubscriberLabels2](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
-        std::vector<SilKit::Services::MatchingLabel> labels;
-        std::string labelsStr;
-        if (sd.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-        {
-            labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-        }
+        [this, optionalSubscriberLabels2](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+                   const std::vector<SilKit::Services::MatchingLabel>& labels) {
         if (MatchLabels(labels, optionalSubscriberLabels2))
         {
             callbacks.ServiceDiscoveryHandler(discoveryType, sd);
@@ -404,4 +393,46 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
     }, controllerTypeDataPublisher, "Topic1", optionalSubscriberLabels2);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, handlers_receive_parsed_labels)
+{
+    TestWrapperSpecificDiscoveryStore testStore;
+
+    ServiceDescriptor baseDescriptor{};
+    baseDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    baseDescriptor.SetNetworkName("Link1");
+    baseDescriptor.SetServiceName("ServiceDiscovery");
+    baseDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataPublisher);
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherTopic, "Topic1");
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherMediaType, "text/json");
+
+    ServiceDescriptor earlyDescriptor{baseDescriptor};
+    earlyDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels, "- key: kA\n  value: vA\n  kind: 2");
+    earlyDescriptor.SetServiceId(1);
+
+    ServiceDescriptor lateDescriptor{baseDescriptor};
+    lateDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels, "[]");
+    lateDescriptor.SetServiceId(2);
+
+    std::vector<std::vector<SilKit::Services::MatchingLabel>> receivedLabels;
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, earlyDescriptor);
+    testStore.RegisterSpecificServiceDiscoveryHandler(
+        [&receivedLabels](ServiceDiscoveryEvent::Type, const ServiceDescriptor&, const auto& labels) {
+        receivedLabels.push_back(labels);
+    }, controllerTypeDataPublisher, "Topic1", {});
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, lateDescriptor);
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, earlyDescriptor);
+
+    ASSERT_EQ(receivedLabels.size(), 3u);
+    for (const auto& labels : {receivedLabels[0], receivedLabels[2]})
+    {
+        ASSERT_EQ(labels.size(), 1u);
+        EXPECT_EQ(labels[0].key, "kA");
+        EXPECT_EQ(labels[0].value, "vA");
+        EXPECT_EQ(labels[0].kind, SilKit::Services::MatchingLabel::Kind::Mandatory);
+    }
+    EXPECT_TRUE(receivedLabels[1].empty());
+    EXPECT_EQ(testStore.GetLookup()[std::make_tuple(controllerTypeDataPublisher, "Topic1")].nodeLabels.size(), 1u);
+}
+
 } // namespace
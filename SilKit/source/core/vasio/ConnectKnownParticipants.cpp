@@ -267,6 +267,30 @@ void ConnectKnownParticipants::Peer::StartConnecting()
 {
     SILKIT_TRACE_METHOD_(_manager->_logger, "()");
 
+    if (_manager->_settings.proxyConnectFirst)
+    {
+        // the proxy-connection immediately sends our ParticipantAnnouncement via the registry
+        _peerStage = PeerStage::WAITING_FOR_REPLY;
+        if (TryProxyConnect())
+        {
+            // connect directly, if the reply does not arrive via the proxy in time
+            _proxyConnectTimer = _manager->_ioContext->MakeTimer();
+            _proxyConnectTimer->SetListener(*this);
+            _proxyConnectTimer->AsyncWaitFor(_manager->_settings.proxyConnectTimeout);
+            return;
+        }
+
+        _proxyConnectFailed = true;
+
+        Log::Debug(_manager->_logger, "Unable to use the registry as a proxy for peer '{}', connecting directly",
+                   _info.participantName);
+    }
+
+    StartDirectConnect();
+}
+
+void ConnectKnownParticipants::Peer::StartDirectConnect()
+{
     _peerStage = PeerStage::DIRECT;
 
     _directConnectPeer = _manager->_connectionMethods->MakeConnectPeer(_info);
@@ -274,6 +298,12 @@ void ConnectKnownParticipants::Peer::StartConnecting()
     _directConnectPeer->AsyncConnect(1, _manager->_settings.directConnectTimeout);
 }
 
+bool ConnectKnownParticipants::Peer::TryProxyConnect()
+{
+    // do not wait for the proxy again, if it has already failed to deliver the reply
+    return !_proxyConnectFailed && _manager->_connectionMethods->TryProxyConnect(_info);
+}
+
 void ConnectKnownParticipants::Peer::HandleEvent(PeerEvent event)
 {
     SILKIT_TRACE_METHOD_(_manager->_logger, "({})", event);
@@ -308,7 +338,7 @@ void ConnectKnownParticipants::Peer::HandleEvent(PeerEvent event)
 
         // attempt to connect via proxy, which immediately sends our ParticipantAnnouncement via the proxy
         _peerStage = PeerStage::WAITING_FOR_REPLY;
-        if (_manager->_connectionMethods->TryProxyConnect(_info))
+        if (TryProxyConnect())
         {
             _manager->UpdateStage();
             return;
@@ -342,6 +372,11 @@ void ConnectKnownParticipants::Peer::HandleEvent(PeerEvent event)
             return;
         }
 
+        if (_proxyConnectTimer != nullptr)
+        {
+            _proxyConnectTimer->Shutdown();
+        }
+
         _peerStage = PeerStage::REPLY_RECEIVED;
         _manager->UpdateStage();
 
@@ -363,6 +398,11 @@ void ConnectKnownParticipants::Peer::Shutdown()
     {
         _remoteConnectRequestTimer->Shutdown();
     }
+
+    if (_proxyConnectTimer != nullptr)
+    {
+        _proxyConnectTimer->Shutdown();
+    }
 }
 
 auto ConnectKnownParticipants::Peer::Describe() const -> std::string
@@ -438,7 +478,7 @@ void ConnectKnownParticipants::Peer::OnConnectPeerFailure(IConnectPeer&, VAsioPe
 
     // attempt to connect via proxy, which immediately sends our ParticipantAnnouncement via the proxy
     _peerStage = PeerStage::WAITING_FOR_REPLY;
-    if (_manager->_connectionMethods->TryProxyConnect(_info))
+    if (TryProxyConnect())
     {
         _manager->UpdateStage();
         return;
@@ -449,10 +489,29 @@ void ConnectKnownParticipants::Peer::OnConnectPeerFailure(IConnectPeer&, VAsioPe
 }
 
 
-void ConnectKnownParticipants::Peer::OnTimerExpired(VSilKit::ITimer&)
+void ConnectKnownParticipants::Peer::OnTimerExpired(VSilKit::ITimer& timer)
 {
     SILKIT_TRACE_METHOD_(_manager->_logger, "(...)");
 
+    if (&timer == _proxyConnectTimer.get())
+    {
+        if (_peerStage != PeerStage::WAITING_FOR_REPLY)
+        {
+            Log::Debug(_manager->_logger, "Ignoring expired proxy connection timer for {} in stage {}",
+                       _info.participantName, _peerStage.load());
+            return;
+        }
+
+        Log::Warn(_manager->_logger, "No reply from peer '{}' via the registry as a proxy, connecting directly",
+                  _info.participantName);
+
+        // drop the proxy peer, otherwise the direct connection would add a second peer for the same participant
+        _proxyConnectFailed = true;
+        _manager->_connectionMethods->RemoveProxyPeer(_info);
+        StartDirectConnect();
+        return;
+    }
+
     if (_peerStage != PeerStage::REMOTE_CONNECT_REQUESTED)
     {
         Log::Debug(_manager->_logger, "Ignoring expired remote connection request timer for {} in stage {}",
@@ -461,7 +520,7 @@ void ConnectKnownParticipants::Peer::OnTimerExpired(VSilKit::ITimer&)
     }
 
     _peerStage = PeerStage::WAITING_FOR_REPLY;
-    if (_manager->_connectionMethods->TryProxyConnect(_info))
+    if (TryProxyConnect())
     {
         _manager->UpdateStage();
         return;
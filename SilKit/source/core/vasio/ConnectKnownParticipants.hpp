@@ -56,6 +56,10 @@ struct ConnectKnownParticipantsSettings
 {
     std::chrono::milliseconds directConnectTimeout{5000};
     std::chrono::milliseconds remoteConnectRequestTimeout{5000};
+    /// Time to wait for the reply via the proxy, before connecting directly (only used with proxyConnectFirst)
+    std::chrono::milliseconds proxyConnectTimeout{5000};
+    /// Use the registry as a proxy first, and only connect directly if that is not possible
+    bool proxyConnectFirst{false};
 };
 
 
@@ -107,6 +111,8 @@ private:
         std::atomic<PeerStage> _peerStage{PeerStage::INVALID};
         std::unique_ptr<IConnectPeer> _directConnectPeer;
         std::unique_ptr<ITimer> _remoteConnectRequestTimer;
+        std::unique_ptr<ITimer> _proxyConnectTimer;
+        bool _proxyConnectFailed{false};
         std::string _failureReason;
 
     public:
@@ -130,6 +136,8 @@ private:
         void OnTimerExpired(ITimer& timer) override;
 
     private:
+        void StartDirectConnect();
+        bool TryProxyConnect();
         void HasFailed(const std::string& reason);
     };
 
@@ -9,6 +9,8 @@
 #include "VAsioConnection.hpp"
 #include "VAsioPeerInfo.hpp"
 #include "VAsioPeer.hpp"
+#include "VAsioCapabilities.hpp"
+#include "MakeSharedMemoryTransport.hpp"
 
 #include "Uri.hpp"
 
@@ -30,11 +32,14 @@ namespace VSilKit {
 
 
 ConnectPeer::ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILogger* logger,
-                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets)
+                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets,
+                         bool enableSharedMemory, std::chrono::milliseconds attemptDelay)
     : _ioContext{ioContext}
     , _logger{logger}
     , _peerInfo{peerInfo}
     , _enableDomainSockets{enableDomainSockets}
+    , _enableSharedMemory{enableSharedMemory}
+    , _attemptDelay{attemptDelay}
 {
     SILKIT_ASSERT(_ioContext != nullptr);
     SILKIT_ASSERT(!_peerInfo.participantName.empty());
@@ -70,9 +75,21 @@ void ConnectPeer::Shutdown()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    if (_connector)
+    if (_attemptDelayTimer != nullptr)
     {
-        _connector->Shutdown();
+        _attemptDelayTimer->Shutdown();
+    }
+
+    // the connectors may report their failure immediately, which modifies the vector
+    std::vector<IConnector*> connectors;
+    for (const auto& connector : _connectors)
+    {
+        connectors.push_back(connector.get());
+    }
+
+    for (auto* connector : connectors)
+    {
+        connector->Shutdown();
     }
 }
 
@@ -92,6 +109,10 @@ void ConnectPeer::UpdateUris()
 {
     std::vector<Uri> acceptorUris;
 
+    const bool useSharedMemory{_enableSharedMemory && _enableDomainSockets
+                               && SilKit::Core::VAsioCapabilities{_peerInfo.capabilities}.HasCapability(
+                                   SilKit::Core::Capabilities::SharedMemory)};
+
     for (const auto& str : _peerInfo.acceptorUris)
     {
         try
@@ -122,6 +143,12 @@ void ConnectPeer::UpdateUris()
             }
             else
             {
+                if (useSharedMemory && uri.Type() == Uri::UriType::Local)
+                {
+                    // the peer accepts shared-memory connections next to each of its local-domain acceptors
+                    acceptorUris.emplace_back(Uri::Parse("shm://" + MakeSharedMemoryAcceptorPath(uri.Path())));
+                }
+
                 acceptorUris.emplace_back(std::move(uri));
             }
         }
@@ -135,11 +162,13 @@ void ConnectPeer::UpdateUris()
         }
     }
 
-    // ensure local-domain URIs are tried first
+    // ensure shared-memory and local-domain URIs are tried first
     std::stable_sort(acceptorUris.begin(), acceptorUris.end(), [](const Uri& lhs, const Uri& rhs) {
         const auto ComputePenalty{[](const Uri& uri) -> int {
             switch (uri.Type())
             {
+            case Uri::UriType::SharedMemory:
+                return 50;
             case Uri::UriType::Local:
                 return 100;
             case Uri::UriType::Tcp:
@@ -168,20 +197,28 @@ void ConnectPeer::TryNextUri()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    if (_remainingAttempts == 0)
+    if (_finished)
     {
-        HandleFailure();
         return;
     }
 
-    if (_uris.empty())
+    if (_remainingAttempts == 0 || _uris.empty())
     {
-        HandleFailure();
+        if (_connectors.empty())
+        {
+            HandleFailure();
+        }
         return;
     }
 
     if (_uriIndex >= _uris.size())
     {
+        // the next round starts after all attempts of this round have failed
+        if (!_connectors.empty())
+        {
+            return;
+        }
+
         _remainingAttempts -= 1;
         _uriIndex = 0;
 
@@ -194,51 +231,103 @@ void ConnectPeer::TryNextUri()
 
     Log::Debug(_logger, "Trying to connect to {} on {}", _peerInfo.participantName, uri.EncodedString());
 
+    auto connector{MakeConnector(uri)};
+
+    if (connector == nullptr)
+    {
+        _ioContext->Dispatch([this] { TryNextUri(); });
+        return;
+    }
+
+    auto* connectorPtr{connector.get()};
+    _connectors.emplace_back(std::move(connector));
+
+    // start the timer before connecting, the connector may report its result immediately
+    StartAttemptDelayTimer();
+
+    connectorPtr->SetListener(*this);
+    connectorPtr->AsyncConnect(_timeout);
+}
+
+
+auto ConnectPeer::MakeConnector(const Uri& uri) -> std::unique_ptr<IConnector>
+{
     try
     {
         switch (uri.Type())
         {
         case Uri::UriType::Tcp:
-            _connector = _ioContext->MakeTcpConnector(uri.Host(), uri.Port());
-            break;
+            return _ioContext->MakeTcpConnector(uri.Host(), uri.Port());
 
         case Uri::UriType::Local:
             if (!_enableDomainSockets)
             {
                 Log::Debug(_logger, "Unable to connect via local-domain because it is disabled via configuration");
+                return nullptr;
             }
-            else
-            {
-                _connector = _ioContext->MakeLocalConnector(uri.Path());
-            }
-            break;
+            return _ioContext->MakeLocalConnector(uri.Path());
+
+        case Uri::UriType::SharedMemory:
+            return MakeSharedMemoryConnector(*_ioContext, _ioContext->MakeLocalConnector(uri.Path()), _logger);
 
         default:
             Log::Warn(_logger, "Invalid uri type {}", static_cast<std::underlying_type_t<Uri::UriType>>(uri.Type()));
-            break;
-        }
-
-        if (_connector != nullptr)
-        {
-            _connector->SetListener(*this);
-            _connector->AsyncConnect(_timeout);
+            return nullptr;
         }
     }
     catch (const std::exception& exception)
     {
-        _connector.reset();
         Log::Warn(_logger, "Failed to start connecting to '{}': {}", uri.EncodedString(), exception.what());
     }
     catch (...)
     {
-        _connector.reset();
         Log::Warn(_logger, "Failed to start connecting to '{}'", uri.EncodedString());
     }
 
-    if (_connector == nullptr)
+    return nullptr;
+}
+
+
+void ConnectPeer::StartAttemptDelayTimer()
+{
+    if (_attemptDelay.count() <= 0)
     {
-        _ioContext->Dispatch([this] { TryNextUri(); });
+        return;
     }
+
+    if (_uriIndex >= _uris.size())
+    {
+        // the remaining attempts of this round are already pending
+        if (_attemptDelayTimer != nullptr)
+        {
+            _attemptDelayTimer->Shutdown();
+        }
+        return;
+    }
+
+    if (_attemptDelayTimer == nullptr)
+    {
+        _attemptDelayTimer = _ioContext->MakeTimer();
+        _attemptDelayTimer->SetListener(*this);
+    }
+
+    _attemptDelayTimer->AsyncWaitFor(_attemptDelay);
+}
+
+
+auto ConnectPeer::ReleaseConnector(IConnector& connector) -> std::unique_ptr<IConnector>
+{
+    auto it = std::find_if(_connectors.begin(), _connectors.end(),
+                           [needle = &connector](const auto& hay) { return hay.get() == needle; });
+
+    if (it == _connectors.end())
+    {
+        return nullptr;
+    }
+
+    auto released = std::move(*it);
+    _connectors.erase(it);
+    return released;
 }
 
 
@@ -246,7 +335,24 @@ void ConnectPeer::HandleSuccess(std::unique_ptr<IRawByteStream> stream)
 {
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(stream.get()));
 
-    _connector.reset();
+    _finished = true;
+
+    if (_attemptDelayTimer != nullptr)
+    {
+        _attemptDelayTimer->Shutdown();
+    }
+
+    // abandon all attempts which are still pending, their results are ignored
+    auto connectors{std::move(_connectors)};
+    _connectors.clear();
+
+    for (const auto& connector : connectors)
+    {
+        connector->Shutdown();
+    }
+
+    connectors.clear();
+
     _listener->OnConnectPeerSuccess(*this, _peerInfo, std::move(stream));
 }
 
@@ -255,24 +361,49 @@ void ConnectPeer::HandleFailure()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    _connector.reset();
+    _finished = true;
+
+    if (_attemptDelayTimer != nullptr)
+    {
+        _attemptDelayTimer->Shutdown();
+    }
+
+    _connectors.clear();
     _listener->OnConnectPeerFailure(*this, _peerInfo);
 }
 
 
-void ConnectPeer::OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream)
+void ConnectPeer::OnAsyncConnectSuccess(IConnector& connector, std::unique_ptr<IRawByteStream> stream)
 {
     SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
 
+    // the connector is released when this function returns
+    auto releasedConnector{ReleaseConnector(connector)};
+
+    if (_finished)
+    {
+        return;
+    }
+
     HandleSuccess(std::move(stream));
 }
 
 
-void ConnectPeer::OnAsyncConnectFailure(IConnector&)
+void ConnectPeer::OnAsyncConnectFailure(IConnector& connector)
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
 
-    _connector.reset();
+    auto releasedConnector{ReleaseConnector(connector)};
+
+    // do not wait for the attempt delay, if the attempt has failed
+    TryNextUri();
+}
+
+
+void ConnectPeer::OnTimerExpired(ITimer&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
     TryNextUri();
 }
 
@@ -25,12 +25,14 @@
 #include "IConnectPeer.hpp"
 
 #include "IIoContext.hpp"
+#include "ITimer.hpp"
 
 #include "ILogger.hpp"
 
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <vector>
 
 
 namespace SilKit {
@@ -48,9 +50,15 @@ namespace VSilKit {
 struct IConnectPeerListener;
 
 
+/// Connects to one of the acceptor URIs of a peer.
+///
+/// The URIs are tried in order of preference. If the attempt delay is non-zero, the next URI is tried as soon as the
+/// delay expires, even if earlier attempts are still pending. The first successful connection wins, and all other
+/// pending attempts are abandoned. A zero attempt delay tries the URIs strictly one after another.
 class ConnectPeer
     : public IConnectPeer
     , private IConnectorListener
+    , private ITimerListener
 {
     using Uri = SilKit::Core::Uri;
 
@@ -58,6 +66,8 @@ class ConnectPeer
     SilKit::Services::Logging::ILogger* _logger{nullptr};
     SilKit::Core::VAsioPeerInfo _peerInfo;
     bool _enableDomainSockets{false};
+    bool _enableSharedMemory{false};
+    std::chrono::milliseconds _attemptDelay{};
 
     IConnectPeerListener* _listener{nullptr};
 
@@ -67,11 +77,14 @@ class ConnectPeer
 
     std::chrono::milliseconds _timeout{};
 
-    std::unique_ptr<IConnector> _connector;
+    bool _finished{false};
+    std::vector<std::unique_ptr<IConnector>> _connectors;
+    std::unique_ptr<ITimer> _attemptDelayTimer;
 
 public:
     ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILogger* logger,
-                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets);
+                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets, bool enableSharedMemory,
+                std::chrono::milliseconds attemptDelay);
     ~ConnectPeer() override;
 
 public: // IConnectPeer
@@ -82,12 +95,18 @@ public: // IConnectPeer
 private:
     void UpdateUris();
     void TryNextUri();
+    auto MakeConnector(const Uri& uri) -> std::unique_ptr<IConnector>;
+    void StartAttemptDelayTimer();
+    auto ReleaseConnector(IConnector& connector) -> std::unique_ptr<IConnector>;
     void HandleSuccess(std::unique_ptr<IRawByteStream> stream);
     void HandleFailure();
 
 private: // IConnectorListener
     void OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream) override;
     void OnAsyncConnectFailure(IConnector&) override;
+
+private: // ITimerListener
+    void OnTimerExpired(ITimer&) override;
 };
 
 
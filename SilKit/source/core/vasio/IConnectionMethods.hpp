@@ -39,7 +39,7 @@ namespace VSilKit {
 /// It should be broken up further in the future, since it combines
 /// - the factory functions for IConnectPeer and IVAsioPeer objects,
 /// - the networking function HandleConnectedPeer, TryRemoteConnectRequest, and TryProxyConnect,
-/// - and the peer management function AddPeer.
+/// - and the peer management functions AddPeer and RemoveProxyPeer.
 struct IConnectionMethods
 {
     virtual ~IConnectionMethods() = default;
@@ -49,6 +49,7 @@ struct IConnectionMethods
 
     virtual void HandleConnectedPeer(SilKit::Core::IVAsioPeer* peer) = 0;
     virtual void AddPeer(std::unique_ptr<SilKit::Core::IVAsioPeer> peer) = 0;
+    virtual void RemoveProxyPeer(const SilKit::Core::VAsioPeerInfo& peerInfo) = 0;
 
     virtual auto TryRemoteConnectRequest(const SilKit::Core::VAsioPeerInfo& peerInfo) -> bool = 0;
     virtual auto TryProxyConnect(const SilKit::Core::VAsioPeerInfo& peerInfo) -> bool = 0;
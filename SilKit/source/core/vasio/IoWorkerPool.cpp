@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "IoWorkerPool.hpp"
+
+#include "SetThreadName.hpp"
+
+
+namespace SilKit {
+namespace Core {
+
+
+// ================================================================================
+//  IoWorkerPool
+// ================================================================================
+
+IoWorkerPool::IoWorkerPool(size_t numberOfThreads, const std::string& threadName,
+                           Services::Logging::ILogger* logger)
+    : _logger{logger}
+{
+    _workers.reserve(numberOfThreads);
+    for (size_t index = 0; index != numberOfThreads; ++index)
+    {
+        _workers.emplace_back([this, threadName] {
+            SilKit::Util::SetThreadName(threadName.substr(0, 15));
+            Work();
+        });
+    }
+}
+
+IoWorkerPool::~IoWorkerPool()
+{
+    Shutdown();
+}
+
+auto IoWorkerPool::MakeStrand() -> std::shared_ptr<Strand>
+{
+    return std::make_shared<Strand>(*this);
+}
+
+void IoWorkerPool::Shutdown()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _isShuttingDown = true;
+    }
+
+    _readyStrandsChanged.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+void IoWorkerPool::Schedule(std::shared_ptr<Strand> strand)
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _readyStrands.emplace_back(std::move(strand));
+    }
+
+    _readyStrandsChanged.notify_one();
+}
+
+void IoWorkerPool::Work()
+{
+    while (true)
+    {
+        std::shared_ptr<Strand> strand;
+
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _readyStrandsChanged.wait(lock, [this] { return _isShuttingDown || !_readyStrands.empty(); });
+
+            // the remaining functions are executed before the workers terminate
+            if (_readyStrands.empty())
+            {
+                return;
+            }
+
+            strand = std::move(_readyStrands.front());
+            _readyStrands.pop_front();
+        }
+
+        if (strand->RunPending())
+        {
+            // give the other strands a chance to run before continuing with this one
+            Schedule(std::move(strand));
+        }
+    }
+}
+
+
+// ================================================================================
+//  IoWorkerPool::Strand
+// ================================================================================
+
+IoWorkerPool::Strand::Strand(IoWorkerPool& pool)
+    : _pool{&pool}
+{
+}
+
+void IoWorkerPool::Strand::Post(std::function<void()> function)
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _functions.emplace_back(std::move(function));
+
+        if (_isScheduled)
+        {
+            return;
+        }
+
+        _isScheduled = true;
+    }
+
+    _pool->Schedule(shared_from_this());
+}
+
+auto IoWorkerPool::Strand::RunPending() -> bool
+{
+    std::deque<std::function<void()>> functions;
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        functions.swap(_functions);
+    }
+
+    for (auto& function : functions)
+    {
+        try
+        {
+            function();
+        }
+        catch (const std::exception& error)
+        {
+            Services::Logging::Error(_pool->_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
+        }
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _isScheduled = !_functions.empty();
+    return _isScheduled;
+}
+
+
+} // namespace Core
+} // namespace SilKit
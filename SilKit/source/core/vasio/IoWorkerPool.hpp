@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ILogger.hpp"
+
+
+namespace SilKit {
+namespace Core {
+
+
+//! Executes functions on a fixed number of worker threads. Functions posted to the same strand are executed in the
+//! order they were posted, and never concurrently. Functions posted to different strands may run in parallel.
+class IoWorkerPool
+{
+public:
+    class Strand;
+
+public:
+    IoWorkerPool(size_t numberOfThreads, const std::string& threadName, Services::Logging::ILogger* logger);
+    ~IoWorkerPool();
+
+    auto MakeStrand() -> std::shared_ptr<Strand>;
+
+    //! Executes all pending functions and joins the worker threads. Functions posted afterwards are discarded.
+    void Shutdown();
+
+private:
+    void Schedule(std::shared_ptr<Strand> strand);
+    void Work();
+
+private:
+    Services::Logging::ILogger* _logger{nullptr};
+
+    std::mutex _mutex;
+    std::condition_variable _readyStrandsChanged;
+    std::deque<std::shared_ptr<Strand>> _readyStrands;
+    bool _isShuttingDown{false};
+
+    std::vector<std::thread> _workers;
+};
+
+
+class IoWorkerPool::Strand : public std::enable_shared_from_this<Strand>
+{
+public:
+    explicit Strand(IoWorkerPool& pool);
+
+    void Post(std::function<void()> function);
+
+private:
+    friend class IoWorkerPool;
+
+    //! Executes the pending functions and returns true if more functions were posted in the meantime
+    auto RunPending() -> bool;
+
+private:
+    IoWorkerPool* _pool{nullptr};
+
+    std::mutex _mutex;
+    std::deque<std::function<void()>> _functions;
+    bool _isScheduled{false};
+};
+
+
+} // namespace Core
+} // namespace SilKit
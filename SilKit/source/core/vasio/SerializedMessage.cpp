@@ -31,8 +31,35 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+SerializedMessage::SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> receiveBuffer, size_t offset,
+                                     size_t size)
+    : _buffer{std::move(receiveBuffer), offset, size}
+{
+    ReadNetworkHeaders();
+}
+
+SerializedMessage::SerializedMessage(const SharedSerializedBody& body, EndpointAddress endpointAddress,
+                                     EndpointId remoteIndex)
+    : _sharedBody{body.data}
+    , _mayOvertakeChunkedMessages{body.mayOvertakeChunkedMessages}
+{
+    if (!IsMwOrSim(body.messageKind) || _sharedBody == nullptr)
+    {
+        throw SilKitError("SerializedMessage: shared message body is only supported for sim messages");
+    }
+
+    _remoteIndex = remoteIndex;
+    _endpointAddress = endpointAddress;
+    _messageKind = body.messageKind;
+    WriteNetworkHeaders();
+    //Ensure we can directly Deserialize in unit tests by reading the header in again
+    ReadNetworkHeaders();
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
+    MergeSharedBody();
+
     auto buffer = _buffer.ReleaseStorage();
     if (buffer.size() > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
@@ -43,6 +70,29 @@ auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
     return buffer;
 }
 
+auto SerializedMessage::ReleaseStorageWithSharedBody() -> SerializedMessageStorage
+{
+    SerializedMessageStorage storage;
+    storage.data = _buffer.ReleaseStorage();
+    storage.sharedBody = std::move(_sharedBody);
+    storage.mayOvertakeChunkedMessages = _mayOvertakeChunkedMessages;
+    storage.remoteIndex = _remoteIndex;
+
+    const auto sharedBodySize = storage.sharedBody == nullptr ? size_t{0} : storage.sharedBody->size();
+    if (storage.data.size() + sharedBodySize > std::numeric_limits<uint32_t>::max())
+        throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
+
+    // emplace the size of the whole message (including the shared body) as the first element in the byte stream
+    const auto bufferSize = static_cast<uint32_t>(storage.data.size() + sharedBodySize);
+    memcpy(storage.data.data(), &bufferSize, sizeof(uint32_t));
+    return storage;
+}
+
+void SerializedMessage::DetachFromReceiveBuffer()
+{
+    _buffer.DetachSharedStorage();
+}
+
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
 {
     return _messageKind;
@@ -88,6 +138,37 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
+auto SerializedMessage::GetProxyMessageRouting() -> ProxyMessageRouting
+{
+    if (_messageKind != VAsioMsgKind::SilKitProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::GetProxyMessageRouting called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    return PeekProxyMessageRouting(_buffer);
+}
+
+void SerializedMessage::MergeSharedBody()
+{
+    if (_sharedBody == nullptr)
+    {
+        return;
+    }
+
+    // append the shared body to a private copy of the network headers, keeping the read position
+    const auto protocolVersion = _buffer.GetProtocolVersion();
+    const auto readPos = _buffer.ReadPos();
+
+    auto storage = _buffer.ReleaseStorage();
+    storage.insert(storage.end(), _sharedBody->begin(), _sharedBody->end());
+
+    _buffer = MessageBuffer{std::move(storage)};
+    _buffer.SetProtocolVersion(protocolVersion);
+    _buffer.SetReadPos(readPos);
+
+    _sharedBody.reset();
+}
+
 void SerializedMessage::WriteNetworkHeaders()
 {
     _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
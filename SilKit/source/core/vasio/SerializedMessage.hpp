@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
+#include <memory>
+
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
@@ -38,6 +40,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "LoggingSerdes.hpp"
 #include "DataSerdes.hpp"
 
+#include "traits/SilKitMsgTraits.hpp"
+
 namespace SilKit {
 namespace Core {
 
@@ -64,6 +68,41 @@ struct SerializedSize
     }
 };
 
+// The serialized body of a sim message, which is shared by the SerializedMessages sent to all remote receivers.
+// This allows serializing a message once and only writing the small network headers per receiver.
+struct SharedSerializedBody
+{
+    VAsioMsgKind messageKind{VAsioMsgKind::Invalid};
+    std::shared_ptr<const std::vector<uint8_t>> data;
+    bool mayOvertakeChunkedMessages{false};
+};
+
+template <typename MessageT>
+auto MakeSharedSerializedBody(const MessageT& message) -> SharedSerializedBody;
+
+// The serialized body of a message batch (see messageBatchKind), which carries several messages of the same sender.
+// The messages are written back to back, after their number.
+template <typename MessageT>
+auto MakeSharedSerializedBatch(const std::vector<MessageT>& messages) -> SharedSerializedBody;
+
+// Messages may carry their serialized body themselves (see WireDataMessageEvent), which is then sent as is. Found via
+// ADL, the overloads are declared next to the Serialize functions of the message.
+template <typename MessageT>
+auto GetSerializedBody(const MessageT& /*message*/) -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    return nullptr;
+}
+
+// The binary wire representation of a SerializedMessage. If sharedBody is set, it must be sent directly after data.
+struct SerializedMessageStorage
+{
+    std::vector<uint8_t> data;
+    std::shared_ptr<const std::vector<uint8_t>> sharedBody;
+    // Used by the VAsioPeer to decide if the message may be sent ahead of a message which is sent in chunks
+    bool mayOvertakeChunkedMessages{false};
+    EndpointId remoteIndex{0};
+};
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -81,28 +120,44 @@ public: // Sending a SerializedMessage: from T to binary blob
     explicit SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex);
     template <typename MessageT>
     explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+    // Sim messages with a shared body only contain the network headers themselves:
+    explicit SerializedMessage(const SharedSerializedBody& body, EndpointAddress endpointAddress,
+                               EndpointId remoteIndex);
 
     auto ReleaseStorage() -> std::vector<uint8_t>;
+    //! Release the storage without copying a shared body into the network header buffer
+    auto ReleaseStorageWithSharedBody() -> SerializedMessageStorage;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     explicit SerializedMessage(std::vector<uint8_t>&& blob);
+    //! Refers to size bytes at offset in a shared receive buffer without copying them, see MessageBuffer
+    explicit SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> receiveBuffer, size_t offset, size_t size);
 
     template <typename ApiMessageT>
     auto Deserialize() -> ApiMessageT;
     template <typename ApiMessageT>
     auto Deserialize() const -> ApiMessageT;
+    //! Deserialize the messages of a batch one after the other into the same object, which is passed to the handler.
+    //! The object is reused for the next message, so its storage is only allocated once per batch.
+    template <typename ApiMessageT, typename HandlerT>
+    void DeserializeBatch(HandlerT&& handler);
 
     auto GetMessageKind() const -> VAsioMsgKind;
     auto GetRegistryKind() const -> RegistryMessageKind;
     auto GetRemoteIndex() const -> EndpointId;
     auto GetEndpointAddress() const -> EndpointAddress;
     void SetProtocolVersion(ProtocolVersion version);
+    //! Copy the message out of the shared receive buffer, e.g., before it is queued for another thread
+    void DetachFromReceiveBuffer();
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
+    //! Read the source and destination of a proxy message, without deserializing its payload
+    auto GetProxyMessageRouting() -> ProxyMessageRouting;
     auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
 
 private:
     void WriteNetworkHeaders();
     void ReadNetworkHeaders();
+    void MergeSharedBody();
     // network headers, some members are optional depending on messageKind
     uint32_t _messageSize{0};
     VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
@@ -116,6 +171,10 @@ private:
     ProxyMessageHeader _proxyMessageHeader;
 
     MessageBuffer _buffer;
+    // For sim messages sent to multiple receivers, see MakeSharedSerializedBody
+    std::shared_ptr<const std::vector<uint8_t>> _sharedBody;
+    // See SilKitMsgTraitOvertakeChunked
+    bool _mayOvertakeChunkedMessages{false};
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -160,15 +219,62 @@ SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress en
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
+    _mayOvertakeChunkedMessages = SilKitMsgTraits<MessageT>::MayOvertakeChunkedMessages();
     WriteNetworkHeaders();
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+auto MakeSharedSerializedBody(const MessageT& message) -> SharedSerializedBody
+{
+    SharedSerializedBody body;
+    body.messageKind = messageKind<MessageT>();
+    body.mayOvertakeChunkedMessages = SilKitMsgTraits<MessageT>::MayOvertakeChunkedMessages();
+    body.data = GetSerializedBody(message);
+    if (body.data != nullptr)
+    {
+        return body;
+    }
+
+    static SerializedSize<MessageT> messageSize{message};
+
+    MessageBuffer buffer;
+    buffer.IncreaseCapacity(messageSize.Size());
+    Serialize(buffer, message);
+
+    body.data = std::make_shared<const std::vector<uint8_t>>(buffer.ReleaseStorage());
+    return body;
+}
+
+template <typename MessageT>
+auto MakeSharedSerializedBatch(const std::vector<MessageT>& messages) -> SharedSerializedBody
+{
+    if (messages.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw SilKitError{"MakeSharedSerializedBatch: too many messages"};
+    }
+
+    SharedSerializedBody body;
+    body.messageKind = messageBatchKind<MessageT>();
+    body.mayOvertakeChunkedMessages = SilKitMsgTraits<MessageT>::MayOvertakeChunkedMessages();
+
+    MessageBuffer buffer;
+    buffer << static_cast<uint32_t>(messages.size());
+    for (const auto& message : messages)
+    {
+        Serialize(buffer, message);
+    }
+
+    body.data = std::make_shared<const std::vector<uint8_t>>(buffer.ReleaseStorage());
+    return body;
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
+    MergeSharedBody();
     ApiMessageT value{};
     AdlDeserialize(_buffer, value);
     return value;
@@ -177,10 +283,30 @@ auto SerializedMessage::Deserialize() -> ApiMessageT
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() const -> ApiMessageT
 {
-    auto bufferCopy = _buffer;
+    auto messageCopy = *this;
+    return messageCopy.Deserialize<ApiMessageT>();
+}
+
+template <typename ApiMessageT, typename HandlerT>
+void SerializedMessage::DeserializeBatch(HandlerT&& handler)
+{
+    if (_messageKind != messageBatchKind<ApiMessageT>())
+    {
+        throw SilKitError("SerializedMessage::DeserializeBatch called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+
+    MergeSharedBody();
+
+    uint32_t count{0};
+    _buffer >> count;
+
     ApiMessageT value{};
-    AdlDeserialize(bufferCopy, value);
-    return value;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        AdlDeserialize(_buffer, value);
+        handler(value);
+    }
 }
 
 } // namespace Core
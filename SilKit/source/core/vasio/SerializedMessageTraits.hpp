@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
+#include "LoggingDatatypesInternal.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -68,6 +69,16 @@ inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind
 {
     return VAsioMsgKind::SubscriptionAnnouncement;
 }
+template <>
+inline constexpr auto messageKind<SubscriptionAnnouncementBatch>() -> VAsioMsgKind
+{
+    return VAsioMsgKind::SubscriptionAnnouncementBatch;
+}
+template <>
+inline constexpr auto messageKind<SubscriptionAcknowledgeBatch>() -> VAsioMsgKind
+{
+    return VAsioMsgKind::SubscriptionAcknowledgeBatch;
+}
 
 // Proxy messages
 template <>
@@ -76,6 +87,18 @@ inline constexpr auto messageKind<ProxyMessage>() -> VAsioMsgKind
     return VAsioMsgKind::SilKitProxyMessage;
 }
 
+// Message batches: several messages of the same sender in a single network message, see MakeSharedSerializedBatch
+template <typename MessageT>
+inline constexpr auto messageBatchKind() -> VAsioMsgKind
+{
+    return VAsioMsgKind::Invalid;
+}
+template <>
+inline constexpr auto messageBatchKind<Services::Logging::LogMsg>() -> VAsioMsgKind
+{
+    return VAsioMsgKind::LogMsgBatch;
+}
+
 template <typename MessageT>
 inline constexpr auto registryMessageKind() -> RegistryMessageKind
 {
@@ -110,7 +133,7 @@ inline constexpr bool IsMwOrSim(VAsioMsgKind kind);
 //////////////////////////////////////////////////////////////////////
 inline constexpr bool IsMwOrSim(VAsioMsgKind kind)
 {
-    return kind == VAsioMsgKind::SilKitMwMsg || kind == VAsioMsgKind::SilKitSimMsg;
+    return kind == VAsioMsgKind::SilKitMwMsg || kind == VAsioMsgKind::SilKitSimMsg || kind == VAsioMsgKind::LogMsgBatch;
 }
 
 } // namespace Core
@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "ILogger.hpp"
 
 #include "VAsioTransmitter.hpp"
@@ -61,7 +65,10 @@ public:
         return _name;
     }
 
-    void AddLocalReceiver(ReceiverT* receiver);
+    //! The dispatch mutex serializes the delivery of received messages to the service the receiver belongs to. It is
+    //! shared by all links of the service and must outlive the link. It is null if a single thread delivers all
+    //! received messages, which requires no locking.
+    void AddLocalReceiver(ReceiverT* receiver, std::mutex* dispatchMutex);
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx);
     void RemoveRemoteReceiver(IVAsioPeer* peer);
     size_t GetNumberOfRemoteReceivers();
@@ -69,11 +76,13 @@ public:
 
     void DistributeRemoteSilKitMessage(const IServiceEndpoint* from, MsgT&& msg);
     void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg);
+    void DistributeLocalSilKitMessages(const IServiceEndpoint* from, const std::vector<MsgT>& msgs);
 
     void SetHistoryLength(size_t history);
 
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                        const MsgT& msg);
+    void DispatchSilKitMessageToTargets(const std::vector<MessageTarget>& targets, const MsgT& msg);
 
 private:
     // ----------------------------------------
@@ -81,6 +90,14 @@ private:
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
     void DistributeToSelf(const IServiceEndpoint* from, const MsgT& msg);
 
+    struct LocalReceiver
+    {
+        ReceiverT* receiver;
+        std::mutex* dispatchMutex;
+    };
+
+    auto GetLocalReceivers() const -> std::shared_ptr<const std::vector<LocalReceiver>>;
+
 private:
     // ----------------------------------------
     // private members
@@ -88,7 +105,10 @@ private:
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
 
-    std::vector<ReceiverT*> _localReceivers;
+    // Receivers are added on the I/O thread while messages are distributed by other threads. The list is therefore
+    // replaced (copy-on-write) instead of modified, and each distribution uses the snapshot it started with.
+    mutable std::mutex _localReceiversMutex;
+    std::shared_ptr<const std::vector<LocalReceiver>> _localReceivers{std::make_shared<std::vector<LocalReceiver>>()};
     VAsioTransmitter<MsgT> _vasioTransmitter;
 };
 
@@ -105,11 +125,26 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logge
 }
 
 template <class MsgT>
-void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
+void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver, std::mutex* dispatchMutex)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end())
+    std::unique_lock<decltype(_localReceiversMutex)> lock{_localReceiversMutex};
+
+    const auto isReceiver = [receiver](const LocalReceiver& localReceiver) {
+        return localReceiver.receiver == receiver;
+    };
+    if (std::any_of(_localReceivers->begin(), _localReceivers->end(), isReceiver))
         return;
-    _localReceivers.push_back(receiver);
+
+    auto localReceivers = std::make_shared<std::vector<LocalReceiver>>(*_localReceivers);
+    localReceivers->push_back(LocalReceiver{receiver, dispatchMutex});
+    _localReceivers = std::move(localReceivers);
+}
+
+template <class MsgT>
+auto SilKitLink<MsgT>::GetLocalReceivers() const -> std::shared_ptr<const std::vector<LocalReceiver>>
+{
+    std::unique_lock<decltype(_localReceiversMutex)> lock{_localReceiversMutex};
+    return _localReceivers;
 }
 
 template <class MsgT>
@@ -162,9 +197,19 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    // Received messages may be distributed by several I/O worker threads (see IoWorkerThreads). A service only ever
+    // receives one of them at a time, regardless of the link and message type.
+    const auto localReceivers = GetLocalReceivers();
+    for (const auto& localReceiver : *localReceivers)
     {
-        DispatchSilKitMessage(receiver, from, msg);
+        if (localReceiver.dispatchMutex == nullptr)
+        {
+            DispatchSilKitMessage(localReceiver.receiver, from, msg);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{*localReceiver.dispatchMutex};
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -179,11 +224,33 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
     DistributeToSelf(from, msg);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::DistributeLocalSilKitMessages(const IServiceEndpoint* from, const std::vector<MsgT>& msgs)
+{
+    // NB: Messages must be dispatched to remote receivers first, see DistributeLocalSilKitMessage
+    try
+    {
+        _vasioTransmitter.SendMessageBatch(from, msgs);
+    }
+    catch (const std::exception& e)
+    {
+        Services::Logging::Warn(_logger, "Sending a batch of {}[\"{}\"] threw an exception: {}", MsgTypeName(), Name(),
+                                e.what());
+    }
+
+    for (const auto& msg : msgs)
+    {
+        DistributeToSelf(from, msg);
+    }
+}
+
 template <class MsgT>
 void SilKitLink<MsgT>::DistributeToSelf(const IServiceEndpoint* from, const MsgT& msg)
 {
-    for (auto&& receiver : _localReceivers)
+    const auto localReceivers = GetLocalReceivers();
+    for (const auto& localReceiver : *localReceivers)
     {
+        auto* receiver = localReceiver.receiver;
         auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
 
         // C++ 17 -> if constexpr
@@ -237,6 +304,21 @@ void SilKitLink<MsgT>::DispatchSilKitMessageToTarget(const IServiceEndpoint* fro
     }
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::DispatchSilKitMessageToTargets(const std::vector<MessageTarget>& targets, const MsgT& msg)
+{
+    // NB: Messages must be dispatched to remote receivers first, see DistributeLocalSilKitMessage
+    _vasioTransmitter.SendMessageToTargets(targets, msg, _logger);
+
+    for (const auto& target : targets)
+    {
+        if (target.from->GetServiceDescriptor().GetParticipantName() == target.participantName)
+        {
+            DistributeToSelf(target.from, msg);
+        }
+    }
+}
+
 template <class MsgT>
 void SilKitLink<MsgT>::SetHistoryLength(size_t history)
 {
@@ -436,4 +436,239 @@ TEST_F(Test_ConnectKnownParticipants, remote_connect_fallback_to_proxy_after_fai
 }
 
 
+TEST_F(Test_ConnectKnownParticipants, proxy_connect_first_does_not_connect_directly)
+{
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    settings.proxyConnectFirst = true;
+
+    // Arrange
+
+    Sequence s1;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    MockConnectKnownParticipantsListener listener;
+
+    EXPECT_CALL(connectionMethods, TryProxyConnect(WithParticipantName(peerInfo.participantName)))
+        .InSequence(s1)
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce([this] {
+        const auto timeout{static_cast<std::chrono::nanoseconds>(settings.proxyConnectTimeout)};
+        auto timer{std::make_unique<NiceMock<MockTimer>>()};
+        EXPECT_CALL(*timer, AsyncWaitFor(timeout));
+        return timer;
+    });
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    connectKnownParticipants.SetKnownParticipants({peerInfo});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectKnownParticipants, proxy_connect_first_fallback_to_direct_connect)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    settings.proxyConnectFirst = true;
+
+    // Arrange
+
+    Sequence s1;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    {
+        EXPECT_CALL(connectionMethods, TryProxyConnect(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1)
+            .WillOnce(Return(false));
+
+        EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1)
+            .WillOnce(MakeSucceedingConnectPeer);
+
+        EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+            .InSequence(s1)
+            .WillOnce([](std::unique_ptr<IRawByteStream>) {
+            auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+            return vAsioPeer;
+        });
+
+        EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+        EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+    }
+
+    MockConnectKnownParticipantsListener listener;
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    connectKnownParticipants.SetKnownParticipants({peerInfo});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectKnownParticipants, proxy_connect_first_timeout_fallback_to_direct_connect)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    settings.proxyConnectFirst = true;
+
+    // Arrange
+
+    Sequence s1;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    {
+        EXPECT_CALL(connectionMethods, TryProxyConnect(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1)
+            .WillOnce(Return(true));
+
+        EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce([this] {
+            const auto timeout{static_cast<std::chrono::nanoseconds>(settings.proxyConnectTimeout)};
+            auto timer{std::make_unique<MockTimerThatExpiresImmediately>(ioContext)};
+            EXPECT_CALL(*timer, DoSetListener);
+            EXPECT_CALL(*timer, DoAsyncWaitFor(timeout));
+            return timer;
+        });
+
+        EXPECT_CALL(connectionMethods, RemoveProxyPeer(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1);
+
+        EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1)
+            .WillOnce(MakeSucceedingConnectPeer);
+
+        EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+            .InSequence(s1)
+            .WillOnce([](std::unique_ptr<IRawByteStream>) {
+            auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+            return vAsioPeer;
+        });
+
+        EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+        EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+    }
+
+    MockConnectKnownParticipantsListener listener;
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsFailure).Times(0);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    connectKnownParticipants.SetKnownParticipants({peerInfo});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectKnownParticipants, proxy_connect_first_ignores_proxy_reply_after_direct_connect)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    settings.proxyConnectFirst = true;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    MockConnectKnownParticipantsListener listener;
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(connectionMethods, TryProxyConnect(WithParticipantName(peerInfo.participantName)))
+        .InSequence(s1)
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce([this] {
+        auto timer{std::make_unique<MockTimerThatExpiresImmediately>(ioContext)};
+        EXPECT_CALL(*timer, DoSetListener);
+        EXPECT_CALL(*timer, DoAsyncWaitFor);
+        return timer;
+    });
+
+    // the proxy peer must be gone before the direct connection adds the peer for the same participant
+    EXPECT_CALL(connectionMethods, RemoveProxyPeer(WithParticipantName(peerInfo.participantName))).InSequence(s1);
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+        .InSequence(s1)
+        .WillOnce(MakeSucceedingConnectPeer);
+
+    EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+        .InSequence(s1)
+        .WillOnce([](std::unique_ptr<IRawByteStream>) { return std::make_unique<NiceMock<MockVAsioPeer>>(); });
+
+    EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+    EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1).WillOnce([this, &peerInfo, &connectKnownParticipants] {
+        ioContext.Post([&peerInfo, &connectKnownParticipants] {
+            // the reply via the direct connection
+            connectKnownParticipants.HandlePeerEvent(peerInfo.participantName,
+                                                     PeerEvent::PARTICIPANT_ANNOUNCEMENT_REPLY);
+            // the late reply via the proxy
+            connectKnownParticipants.HandlePeerEvent(peerInfo.participantName,
+                                                     PeerEvent::PARTICIPANT_ANNOUNCEMENT_REPLY);
+        });
+    });
+
+    // the proxy connection already waits for the reply
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsAllRepliesReceived).Times(1).InSequence(s1);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsFailure).Times(0);
+
+    // Act
+
+    connectKnownParticipants.SetKnownParticipants({peerInfo});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+
+    // Assert
+
+    EXPECT_THAT(connectKnownParticipants.Describe(), ::testing::HasSubstr("is connected"));
+}
+
+
 } // namespace
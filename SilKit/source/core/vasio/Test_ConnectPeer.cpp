@@ -28,6 +28,7 @@
 #include "MockConnectPeer.hpp"
 #include "MockIoContext.hpp"
 #include "MockRawByteStream.hpp"
+#include "MockTimer.hpp"
 
 #include "Hash.hpp"
 
@@ -53,9 +54,15 @@ using ::testing::Return;
 
 using SilKit::Services::Logging::MockLogger;
 using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockConnector;
 using VSilKit::MockConnectorThatFails;
 using VSilKit::MockConnectorThatSucceeds;
 using VSilKit::MockRawByteStream;
+using VSilKit::MockTimer;
+using VSilKit::MockTimerThatExpiresImmediately;
+
+
+constexpr std::chrono::milliseconds NO_ATTEMPT_DELAY{0};
 
 
 struct Test_ConnectPeer : ::testing::Test
@@ -84,6 +91,7 @@ struct Test_ConnectPeer : ::testing::Test
 TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specified_timeout)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
@@ -111,7 +119,8 @@ TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specifie
     peerInfo.acceptorUris.emplace_back("tcp://host:1234");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -122,6 +131,7 @@ TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specifie
 TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
@@ -157,7 +167,8 @@ TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
     peerInfo.acceptorUris.emplace_back("tcp://host:5678");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -168,6 +179,7 @@ TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
 TEST_F(Test_ConnectPeer, retry_count_is_honored)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr size_t RETRY_COUNT{3};
     static constexpr auto TIMEOUT{4321ms};
 
@@ -196,7 +208,8 @@ TEST_F(Test_ConnectPeer, retry_count_is_honored)
     peerInfo.acceptorUris.emplace_back("tcp://host:1234");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(RETRY_COUNT, TIMEOUT);
 
@@ -207,6 +220,7 @@ TEST_F(Test_ConnectPeer, retry_count_is_honored)
 TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr size_t RETRY_COUNT{2};
     static constexpr auto TIMEOUT{4321ms};
 
@@ -234,7 +248,8 @@ TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
     peerInfo.acceptorUris.emplace_back("local:///two");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(RETRY_COUNT, TIMEOUT);
 
@@ -245,6 +260,7 @@ TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
 TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{false};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
@@ -270,7 +286,8 @@ TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
     peerInfo.acceptorUris.emplace_back("local:///one");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -281,6 +298,7 @@ TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
 TEST_F(Test_ConnectPeer, successful_connection_skips_remainder)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeFailingConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
@@ -312,7 +330,8 @@ TEST_F(Test_ConnectPeer, successful_connection_skips_remainder)
     peerInfo.acceptorUris.emplace_back("local:///two");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(2, TIMEOUT);
 
@@ -320,4 +339,179 @@ TEST_F(Test_ConnectPeer, successful_connection_skips_remainder)
 }
 
 
+TEST_F(Test_ConnectPeer, shared_memory_is_tried_before_local_if_the_peer_supports_it)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{true};
+    static constexpr auto TIMEOUT{4321ms};
+
+    auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
+
+    // Arrange
+
+    Sequence s1;
+
+    // the shared-memory connector wraps a local-domain connector to the shared-memory acceptor path
+    EXPECT_CALL(ioContext, MakeLocalConnector("/one.shm")).InSequence(s1).WillOnce(MakeConnector);
+    EXPECT_CALL(ioContext, MakeLocalConnector("/one")).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = R"([{"name":"shared-memory"}])";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectPeer, shared_memory_is_not_used_if_the_peer_does_not_support_it)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{true};
+    static constexpr auto TIMEOUT{4321ms};
+
+    auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, MakeLocalConnector("/one")).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            NO_ATTEMPT_DELAY};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
+
+TEST_F(Test_ConnectPeer, next_uri_is_tried_after_attempt_delay_and_first_success_wins)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
+    static constexpr auto TIMEOUT{4321ms};
+    static constexpr auto ATTEMPT_DELAY{250ms};
+
+    // the connection attempt on the local-domain socket never completes
+    auto MakePendingConnector{[] {
+        auto connector{std::make_unique<NiceMock<MockConnector>>()};
+        EXPECT_CALL(*connector, AsyncConnect(TIMEOUT));
+        EXPECT_CALL(*connector, Shutdown).Times(1);
+        return connector;
+    }};
+
+    auto MakeSucceedingConnector{[this] {
+        auto connector{MakeConnectorThatSucceeds(TIMEOUT)};
+        EXPECT_CALL(*connector, MakeRawByteStream).WillOnce([] { return std::make_unique<MockRawByteStream>(); });
+        return connector;
+    }};
+
+    auto MakeTimer{[this] {
+        auto timer{std::make_unique<MockTimerThatExpiresImmediately>(ioContext)};
+        EXPECT_CALL(*timer, DoSetListener);
+        EXPECT_CALL(*timer, DoAsyncWaitFor(std::chrono::nanoseconds{ATTEMPT_DELAY}));
+        EXPECT_CALL(*timer, DoShutdown).Times(::testing::AtLeast(1));
+        return timer;
+    }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, Resolve("host")).WillOnce(Return(std::vector<std::string>{"1.2.3.4"}));
+
+    EXPECT_CALL(ioContext, MakeLocalConnector("/one")).InSequence(s1).WillOnce(MakePendingConnector);
+    EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce(MakeTimer);
+    EXPECT_CALL(ioContext, MakeTcpConnector("1.2.3.4", 1234)).InSequence(s1).WillOnce(MakeSucceedingConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(1).InSequence(s1);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(0);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.acceptorUris.emplace_back("tcp://host:1234");
+    peerInfo.capabilities = "";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            ATTEMPT_DELAY};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectPeer, failed_attempt_does_not_wait_for_attempt_delay)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
+    static constexpr auto TIMEOUT{4321ms};
+    static constexpr auto ATTEMPT_DELAY{250ms};
+
+    auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
+
+    // the attempt delay never expires
+    auto MakeTimer{[] { return std::make_unique<NiceMock<MockTimer>>(); }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, MakeLocalConnector("/one")).InSequence(s1).WillOnce(MakeConnector);
+    EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce(MakeTimer);
+    EXPECT_CALL(ioContext, MakeLocalConnector("/two")).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.acceptorUris.emplace_back("local:///two");
+    peerInfo.capabilities = "";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED,
+                            ATTEMPT_DELAY};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
 } // namespace
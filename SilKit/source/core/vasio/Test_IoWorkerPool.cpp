@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+
+#include "IoWorkerPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace std::chrono_literals;
+
+using SilKit::Core::IoWorkerPool;
+
+
+TEST(Test_IoWorkerPool, functions_of_a_strand_run_in_order)
+{
+    IoWorkerPool pool{4, "Test", nullptr};
+    auto strand{pool.MakeStrand()};
+
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        strand->Post([&values, i] { values.push_back(i); });
+    }
+
+    pool.Shutdown();
+
+    ASSERT_EQ(values.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(values[i], i);
+    }
+}
+
+TEST(Test_IoWorkerPool, functions_of_a_strand_never_run_concurrently)
+{
+    IoWorkerPool pool{4, "Test", nullptr};
+    auto strand{pool.MakeStrand()};
+
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        strand->Post([&running, &maxRunning] {
+            const auto current = ++running;
+            maxRunning = std::max(maxRunning.load(), current);
+            std::this_thread::sleep_for(100us);
+            --running;
+        });
+    }
+
+    pool.Shutdown();
+
+    EXPECT_EQ(maxRunning, 1);
+}
+
+TEST(Test_IoWorkerPool, different_strands_run_in_parallel)
+{
+    IoWorkerPool pool{2, "Test", nullptr};
+    auto first{pool.MakeStrand()};
+    auto second{pool.MakeStrand()};
+
+    std::promise<void> firstStarted;
+    std::promise<void> secondStarted;
+
+    // both functions only complete if they are executed concurrently
+    first->Post([&] {
+        firstStarted.set_value();
+        EXPECT_EQ(secondStarted.get_future().wait_for(5s), std::future_status::ready);
+    });
+    second->Post([&] {
+        secondStarted.set_value();
+        EXPECT_EQ(firstStarted.get_future().wait_for(5s), std::future_status::ready);
+    });
+
+    pool.Shutdown();
+}
+
+TEST(Test_IoWorkerPool, exceptions_do_not_stop_the_strand)
+{
+    IoWorkerPool pool{1, "Test", nullptr};
+    auto strand{pool.MakeStrand()};
+
+    bool executed{false};
+    strand->Post([] { throw std::runtime_error{"error"}; });
+    strand->Post([&executed] { executed = true; });
+
+    pool.Shutdown();
+
+    EXPECT_TRUE(executed);
+}
+
+
+} // namespace
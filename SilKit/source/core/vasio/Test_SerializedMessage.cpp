@@ -20,6 +20,7 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SerializedMessage.hpp"
+#include "TestDataTypes.hpp"
 
 #include <cstdint>
 #include <array>
@@ -99,3 +100,110 @@ TEST(Test_SerializedMessage, packed_handshake_message)
     ASSERT_EQ(ptr->simulationNameSize, announcement.simulationName.size());
     ASSERT_EQ(to_string(ptr->simulationName, ptr->simulationNameSize), announcement.simulationName);
 }
+
+TEST(Test_SerializedMessage, shared_body_matches_per_receiver_serialization)
+{
+    SilKit::Core::Tests::TestFrameEvent event;
+    event.integer = 1234;
+    event.str = "shared body";
+
+    EndpointAddress endpointAddress{5678, 9};
+    const auto body = MakeSharedSerializedBody(event);
+
+    for (EndpointId remoteIndex : {EndpointId{0}, EndpointId{42}})
+    {
+        auto expected = SerializedMessage{event, endpointAddress, remoteIndex}.ReleaseStorage();
+
+        SerializedMessage msg{body, endpointAddress, remoteIndex};
+        ASSERT_EQ(msg.GetRemoteIndex(), remoteIndex);
+        ASSERT_EQ(msg.GetEndpointAddress(), endpointAddress);
+
+        // the shared body is not copied into the per-receiver storage
+        auto storage = msg.ReleaseStorageWithSharedBody();
+        ASSERT_EQ(storage.sharedBody, body.data);
+
+        std::vector<uint8_t> blob{storage.data};
+        blob.insert(blob.end(), storage.sharedBody->begin(), storage.sharedBody->end());
+        ASSERT_EQ(blob, expected);
+
+        // receiving the concatenated wire bytes yields the original message
+        SerializedMessage received{std::move(blob)};
+        ASSERT_EQ(received.GetRemoteIndex(), remoteIndex);
+        auto receivedEvent = received.Deserialize<SilKit::Core::Tests::TestFrameEvent>();
+        ASSERT_EQ(receivedEvent.integer, event.integer);
+        ASSERT_EQ(receivedEvent.str, event.str);
+    }
+
+    // deserializing directly from a message with a shared body works as well
+    SerializedMessage msg{body, endpointAddress, 0};
+    auto deserialized = msg.Deserialize<SilKit::Core::Tests::TestFrameEvent>();
+    ASSERT_EQ(deserialized.str, event.str);
+    ASSERT_EQ(msg.ReleaseStorage(), SerializedMessage(event, endpointAddress, 0).ReleaseStorage());
+}
+
+TEST(Test_SerializedMessage, proxy_message_routing_is_read_without_the_payload)
+{
+    ProxyMessage proxyMessage{};
+    proxyMessage.source = "Source";
+    proxyMessage.destination = "Destination";
+    proxyMessage.payload = {1, 2, 3, 4, 5};
+
+    const auto wireBytes = SerializedMessage{proxyMessage}.ReleaseStorage();
+    auto receiveBuffer = std::make_shared<const std::vector<uint8_t>>(wireBytes);
+
+    SerializedMessage received{receiveBuffer, 0, wireBytes.size()};
+    const auto routing = received.GetProxyMessageRouting();
+    ASSERT_EQ(routing.source, proxyMessage.source);
+    ASSERT_EQ(routing.destination, proxyMessage.destination);
+
+    // peeking the routing does not consume the message, which can still be deserialized or forwarded unchanged
+    const auto deserialized = received.Deserialize<ProxyMessage>();
+    ASSERT_EQ(deserialized.destination, proxyMessage.destination);
+    ASSERT_EQ(deserialized.payload, proxyMessage.payload);
+    SerializedMessage forwarded{receiveBuffer, 0, wireBytes.size()};
+    ASSERT_EQ(forwarded.ReleaseStorage(), wireBytes);
+}
+
+TEST(Test_SerializedMessage, detached_message_does_not_refer_to_the_receive_buffer)
+{
+    SilKit::Core::Tests::TestFrameEvent event;
+    event.str = "detached";
+    const EndpointAddress endpointAddress{1, 2};
+
+    const auto wireBytes = SerializedMessage{event, endpointAddress, 3}.ReleaseStorage();
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(wireBytes);
+
+    SerializedMessage received{receiveBuffer, 0, wireBytes.size()};
+    received.DetachFromReceiveBuffer();
+    ASSERT_EQ(receiveBuffer.use_count(), 1);
+
+    // the receive buffer can be reused without affecting the message
+    std::fill(receiveBuffer->begin(), receiveBuffer->end(), uint8_t{0});
+    ASSERT_EQ(received.GetRemoteIndex(), 3u);
+    ASSERT_EQ(received.Deserialize<SilKit::Core::Tests::TestFrameEvent>().str, event.str);
+}
+
+TEST(Test_SerializedMessage, log_msg_batch_is_deserialized_message_by_message)
+{
+    std::vector<SilKit::Services::Logging::LogMsg> logMsgs(3);
+    for (size_t i = 0; i < logMsgs.size(); ++i)
+    {
+        logMsgs[i].logger_name = "Logger";
+        logMsgs[i].level = SilKit::Services::Logging::Level::Info;
+        logMsgs[i].payload = "record " + std::to_string(i);
+    }
+    const EndpointAddress endpointAddress{1, 2};
+
+    const auto body = MakeSharedSerializedBatch(logMsgs);
+    auto wireBytes = SerializedMessage{body, endpointAddress, 3}.ReleaseStorage();
+
+    SerializedMessage received{std::move(wireBytes)};
+    ASSERT_EQ(received.GetMessageKind(), VAsioMsgKind::LogMsgBatch);
+    ASSERT_EQ(received.GetRemoteIndex(), 3u);
+    ASSERT_EQ(received.GetEndpointAddress(), endpointAddress);
+
+    std::vector<std::string> payloads;
+    received.DeserializeBatch<SilKit::Services::Logging::LogMsg>(
+        [&payloads](const SilKit::Services::Logging::LogMsg& logMsg) { payloads.push_back(logMsg.payload); });
+    ASSERT_EQ(payloads, (std::vector<std::string>{"record 0", "record 1", "record 2"}));
+}
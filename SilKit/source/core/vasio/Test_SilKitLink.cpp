@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "SilKitLink.hpp"
+#include "VAsioReceiver.hpp"
+
+#include "MockLogger.hpp"
+#include "MockTimeProvider.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::Can;
+using namespace std::chrono_literals;
+
+using ::testing::NiceMock;
+
+using SilKit::Core::Tests::MockTimeProvider;
+using SilKit::Services::Logging::MockLogger;
+
+
+// Receives messages of two types, like a controller which is attached to a frame and a status link
+struct ConcurrencyTrackingReceiver
+    : IMessageReceiver<WireCanFrameEvent>
+    , IMessageReceiver<CanControllerStatus>
+{
+    void ReceiveMsg(const IServiceEndpoint*, const WireCanFrameEvent&) override
+    {
+        Track();
+    }
+
+    void ReceiveMsg(const IServiceEndpoint*, const CanControllerStatus&) override
+    {
+        Track();
+    }
+
+    void Track()
+    {
+        const auto active = ++activeCalls;
+        maxActiveCalls = std::max(maxActiveCalls.load(), active);
+        std::this_thread::sleep_for(100us);
+        --activeCalls;
+        ++receivedCount;
+    }
+
+    std::atomic<int> activeCalls{0};
+    std::atomic<int> maxActiveCalls{0};
+    std::atomic<int> receivedCount{0};
+};
+
+
+struct Test_SilKitLink : ::testing::Test
+{
+    NiceMock<MockLogger> logger;
+    NiceMock<MockTimeProvider> timeProvider;
+    ServiceDescriptor fromDescriptor{"P2", "CAN1", "CanController1", 5};
+};
+
+
+TEST_F(Test_SilKitLink, service_never_receives_messages_of_different_links_concurrently)
+{
+    SilKitLink<WireCanFrameEvent> frameLink{"CAN1", &logger, &timeProvider};
+    SilKitLink<CanControllerStatus> statusLink{"CAN1", &logger, &timeProvider};
+
+    ConcurrencyTrackingReceiver receiver;
+    std::mutex dispatchMutex;
+    frameLink.AddLocalReceiver(&receiver, &dispatchMutex);
+    statusLink.AddLocalReceiver(&receiver, &dispatchMutex);
+
+    const RemoteServiceEndpoint from{fromDescriptor};
+    const int count{100};
+
+    std::thread frameThread{[&] {
+        for (int i = 0; i < count; ++i)
+        {
+            frameLink.DistributeRemoteSilKitMessage(&from, WireCanFrameEvent{});
+        }
+    }};
+    std::thread statusThread{[&] {
+        for (int i = 0; i < count; ++i)
+        {
+            statusLink.DistributeRemoteSilKitMessage(&from, CanControllerStatus{});
+        }
+    }};
+
+    frameThread.join();
+    statusThread.join();
+
+    EXPECT_EQ(receiver.receivedCount, 2 * count);
+    EXPECT_EQ(receiver.maxActiveCalls, 1);
+}
+
+TEST_F(Test_SilKitLink, receivers_without_dispatch_mutex_receive_messages)
+{
+    SilKitLink<WireCanFrameEvent> frameLink{"CAN1", &logger, &timeProvider};
+
+    ConcurrencyTrackingReceiver receiver;
+    frameLink.AddLocalReceiver(&receiver, nullptr);
+
+    const RemoteServiceEndpoint from{fromDescriptor};
+    frameLink.DistributeRemoteSilKitMessage(&from, WireCanFrameEvent{});
+
+    EXPECT_EQ(receiver.receivedCount, 1);
+}
+
+TEST_F(Test_SilKitLink, receivers_can_be_added_while_messages_are_distributed)
+{
+    SilKitLink<WireCanFrameEvent> frameLink{"CAN1", &logger, &timeProvider};
+
+    std::vector<std::unique_ptr<ConcurrencyTrackingReceiver>> receivers;
+    std::vector<std::unique_ptr<std::mutex>> dispatchMutexes;
+    for (int i = 0; i < 50; ++i)
+    {
+        receivers.emplace_back(std::make_unique<ConcurrencyTrackingReceiver>());
+        dispatchMutexes.emplace_back(std::make_unique<std::mutex>());
+    }
+
+    const RemoteServiceEndpoint from{fromDescriptor};
+
+    std::atomic<bool> done{false};
+    std::thread distributingThread{[&] {
+        while (!done)
+        {
+            frameLink.DistributeRemoteSilKitMessage(&from, WireCanFrameEvent{});
+        }
+    }};
+
+    for (size_t i = 0; i < receivers.size(); ++i)
+    {
+        frameLink.AddLocalReceiver(receivers[i].get(), dispatchMutexes[i].get());
+    }
+
+    done = true;
+    distributingThread.join();
+
+    // every receiver which was added before a message is distributed receives it
+    std::vector<int> countsBefore;
+    for (const auto& receiver : receivers)
+    {
+        countsBefore.push_back(receiver->receivedCount);
+    }
+
+    frameLink.DistributeRemoteSilKitMessage(&from, WireCanFrameEvent{});
+
+    for (size_t i = 0; i < receivers.size(); ++i)
+    {
+        EXPECT_EQ(receivers[i]->receivedCount, countsBefore[i] + 1);
+    }
+}
+
+
+} // namespace
@@ -162,6 +162,51 @@ MATCHER_P(SubscriptionAcknowledgeMatcher, subscriber,
     return reply.status == SubscriptionAcknowledge::Status::Success && reply.subscriber == subscriber;
 }
 
+MATCHER_P2(TargetedMessageMatcher, remoteIndex, senderServiceId, "Check the receiver and sender of a SerializedMessage")
+{
+    return arg.GetRemoteIndex() == remoteIndex && arg.GetEndpointAddress().endpoint == senderServiceId;
+}
+
+MATCHER_P(MessageKindMatcher, messageKind, "Check the message kind of a SerializedMessage")
+{
+    return arg.GetMessageKind() == messageKind;
+}
+
+MATCHER_P(SubscriptionAcknowledgeBatchMatcher, subscribers,
+          "Deserialize the MessageBuffer from the SerializedMessage and check the acks of the subscription batch")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::SubscriptionAcknowledgeBatch)
+    {
+        return false;
+    }
+    auto reply = message.Deserialize<SubscriptionAcknowledgeBatch>();
+    if (reply.acknowledges.size() != subscribers.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < subscribers.size(); ++i)
+    {
+        if (reply.acknowledges[i].status != SubscriptionAcknowledge::Status::Success
+            || !(reply.acknowledges[i].subscriber == subscribers[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+MATCHER_P(SubscriptionAnnouncementBatchMatcher, subscriberCount,
+          "Deserialize the MessageBuffer from the SerializedMessage and check the size of the subscription batch")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::SubscriptionAnnouncementBatch)
+    {
+        return false;
+    }
+    return message.Deserialize<SubscriptionAnnouncementBatch>().subscribers.size() == subscriberCount;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////
@@ -190,7 +235,31 @@ protected:
     template <typename MessageT, typename ServiceT>
     void RegisterSilKitMsgReceiver(SilKit::Core::IMessageReceiver<MessageT>* receiver)
     {
-        _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
+        const auto registrationMode = SilKitServiceTraits<ServiceT>::UseAsyncRegistration()
+                                          ? VAsioConnection::RegistrationMode::Asynchronous
+                                          : VAsioConnection::RegistrationMode::Synchronous;
+        _connection.RegisterSilKitMsgReceiver<MessageT>(receiver, registrationMode);
+    }
+
+    template <typename MessageT>
+    void RegisterDeferredSilKitMsgReceiver(SilKit::Core::IMessageReceiver<MessageT>* receiver)
+    {
+        _connection.RegisterSilKitMsgReceiver<MessageT>(receiver, VAsioConnection::RegistrationMode::Deferred);
+    }
+
+    void AddPeer(std::unique_ptr<IVAsioPeer> peer)
+    {
+        _connection._peers.emplace_back(std::move(peer));
+    }
+
+    void RunIoContext()
+    {
+        _connection._ioContext->Run();
+    }
+
+    auto GetNetworkIndex(const std::string& networkName) -> uint32_t
+    {
+        return _connection.GetNetworkIndex(networkName);
     }
 };
 
@@ -293,3 +362,167 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Batched subscriptions
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, subscription_announcement_batch_is_acknowledged_by_a_single_batch)
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+
+    VAsioMsgSubscriber subscriber;
+    subscriber.receiverIdx = 0;
+    subscriber.networkName = "unittest";
+    subscriber.msgTypeName = SilKitMsgTraits<Tests::Version1::TestMessage>::SerdesName();
+    subscriber.version = SilKitMsgTraits<Tests::Version1::TestMessage>::Version();
+    subscribers.push_back(subscriber);
+
+    subscriber.receiverIdx = 1;
+    subscriber.msgTypeName = SilKitMsgTraits<Tests::TestFrameEvent>::SerdesName();
+    subscriber.version = SilKitMsgTraits<Tests::TestFrameEvent>::Version();
+    subscribers.push_back(subscriber);
+
+    SubscriptionAnnouncementBatch batch;
+    batch.subscribers = subscribers;
+
+    EXPECT_CALL(_from, SendSilKitMsg(SubscriptionAcknowledgeBatchMatcher(subscribers))).Times(1);
+    _connection.OnSocketData(&_from, SerializedMessage{batch});
+}
+
+TEST_F(Test_VAsioConnection, deferred_registrations_are_subscribed_in_a_single_batch)
+{
+    VAsioCapabilities capabilities;
+    capabilities.AddCapability(Capabilities::SubscriptionBatch);
+
+    auto peer = std::make_unique<testing::NiceMock<MockVAsioPeer>>();
+    peer->_peerInfo.capabilities = capabilities.ToCapabilitiesString();
+    auto* peerPtr = peer.get();
+    AddPeer(std::move(peer));
+
+    _connection.DeferServiceRegistrations();
+
+    testing::NiceMock<MockSilKitMessageReceiver> receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    testing::NiceMock<MockSilKitMessageReceiver> receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+    RegisterDeferredSilKitMsgReceiver<Tests::Version2::TestMessage>(&receiverA);
+    RegisterDeferredSilKitMsgReceiver<Tests::Version2::TestMessage>(&receiverB);
+
+    // the subscriptions are only sent once the deferred registrations end
+    EXPECT_CALL(*peerPtr, SendSilKitMsg(_)).Times(0);
+    EXPECT_CALL(*peerPtr, Subscribe(_)).Times(0);
+    RunIoContext();
+    testing::Mock::VerifyAndClearExpectations(peerPtr);
+
+    EXPECT_CALL(*peerPtr, SendSilKitMsg(SubscriptionAnnouncementBatchMatcher(2u))).Times(1);
+    _connection.AddAsyncSubscriptionsCompletionHandler([] {});
+    RunIoContext();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Targeted messages
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, message_to_multiple_targets_is_sent_to_each_target_peer)
+{
+    testing::NiceMock<MockVAsioPeer> peerA;
+    peerA._peerInfo.participantName = "PeerA";
+    testing::NiceMock<MockVAsioPeer> peerB;
+    peerB._peerInfo.participantName = "PeerB";
+
+    VAsioTransmitter<Tests::TestFrameEvent> transmitter;
+    transmitter.AddRemoteReceiver(&peerA, 5);
+    transmitter.AddRemoteReceiver(&peerB, 6);
+
+    testing::NiceMock<MockSilKitMessageReceiver> fromA;
+    fromA._serviceDescriptor.SetServiceId(2);
+    testing::NiceMock<MockSilKitMessageReceiver> fromB;
+    fromB._serviceDescriptor.SetServiceId(3);
+
+    EXPECT_CALL(peerA, SendSilKitMsg(TargetedMessageMatcher(5u, 2u))).Times(1);
+    EXPECT_CALL(peerB, SendSilKitMsg(TargetedMessageMatcher(6u, 3u))).Times(1);
+
+    // targets on the sending participant itself are not sent to any peer
+    const auto localParticipantName = fromA.GetServiceDescriptor().GetParticipantName();
+    transmitter.SendMessageToTargets({{&fromA, "PeerA"}, {&fromB, "PeerB"}, {&fromA, localParticipantName}},
+                                     Tests::TestFrameEvent{}, &_dummyLogger);
+}
+
+TEST_F(Test_VAsioConnection, message_to_multiple_targets_skips_unknown_targets)
+{
+    testing::NiceMock<MockVAsioPeer> peerA;
+    peerA._peerInfo.participantName = "PeerA";
+    testing::NiceMock<MockVAsioPeer> peerB;
+    peerB._peerInfo.participantName = "PeerB";
+
+    VAsioTransmitter<Tests::TestFrameEvent> transmitter;
+    transmitter.AddRemoteReceiver(&peerA, 5);
+    transmitter.AddRemoteReceiver(&peerB, 6);
+
+    testing::NiceMock<MockSilKitMessageReceiver> from;
+    from._serviceDescriptor.SetServiceId(2);
+
+    EXPECT_CALL(peerA, SendSilKitMsg(TargetedMessageMatcher(5u, 2u))).Times(1);
+    EXPECT_CALL(peerB, SendSilKitMsg(TargetedMessageMatcher(6u, 2u))).Times(1);
+    EXPECT_CALL(_dummyLogger, Log(testing::_, testing::_)).Times(testing::AnyNumber());
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Warn, testing::HasSubstr("UnknownPeer"))).Times(1);
+
+    transmitter.SendMessageToTargets({{&from, "PeerA"}, {&from, "UnknownPeer"}, {&from, "PeerB"}},
+                                     Tests::TestFrameEvent{}, &_dummyLogger);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Message batches
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, log_msg_batch_is_only_sent_to_peers_which_accept_it)
+{
+    VAsioCapabilities capabilities;
+    capabilities.AddCapability(Capabilities::LogMsgBatch);
+
+    testing::NiceMock<MockVAsioPeer> batchPeer;
+    batchPeer._peerInfo.participantName = "BatchPeer";
+    batchPeer._peerInfo.capabilities = capabilities.ToCapabilitiesString();
+    testing::NiceMock<MockVAsioPeer> legacyPeer;
+    legacyPeer._peerInfo.participantName = "LegacyPeer";
+
+    VAsioTransmitter<SilKit::Services::Logging::LogMsg> transmitter;
+    transmitter.AddRemoteReceiver(&batchPeer, 5);
+    transmitter.AddRemoteReceiver(&legacyPeer, 6);
+
+    testing::NiceMock<MockSilKitMessageReceiver> from;
+    from._serviceDescriptor.SetServiceId(2);
+
+    // peers without the capability receive the messages one by one
+    EXPECT_CALL(batchPeer, SendSilKitMsg(MessageKindMatcher(VAsioMsgKind::LogMsgBatch))).Times(1);
+    EXPECT_CALL(legacyPeer, SendSilKitMsg(MessageKindMatcher(VAsioMsgKind::SilKitMwMsg))).Times(3);
+
+    transmitter.SendMessageBatch(&from, std::vector<SilKit::Services::Logging::LogMsg>(3));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Network indices
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, network_indices_are_assigned_per_network_name)
+{
+    const auto indexA = GetNetworkIndex("A");
+    const auto indexB = GetNetworkIndex("B");
+
+    EXPECT_NE(indexA, 0u);
+    EXPECT_NE(indexB, 0u);
+    EXPECT_NE(indexA, indexB);
+    EXPECT_EQ(GetNetworkIndex("A"), indexA);
+    EXPECT_EQ(GetNetworkIndex("B"), indexB);
+}
+
+TEST_F(Test_VAsioConnection, changing_the_network_name_resets_the_network_index)
+{
+    ServiceDescriptor serviceDescriptor{"P1", "A", "Service", 1};
+    serviceDescriptor.SetNetworkIndex(GetNetworkIndex("A"));
+    EXPECT_NE(serviceDescriptor.GetNetworkIndex(), 0u);
+
+    serviceDescriptor.SetNetworkName("B");
+    EXPECT_EQ(serviceDescriptor.GetNetworkIndex(), 0u);
+}
@@ -0,0 +1,450 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+
+#include <algorithm>
+#include <cstring>
+
+#include "VAsioPeer.hpp"
+#include "VAsioCapabilities.hpp"
+#include "TestDataTypes.hpp"
+
+#include "MockLogger.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+using namespace std::chrono_literals;
+
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+};
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    MockVAsioPeerListener peerListener;
+
+    MockRawByteStream* stream{nullptr};
+    IRawByteStreamListener* streamListener{nullptr};
+
+    // contents of the buffer sequence of every AsyncWriteSome call
+    std::vector<std::vector<uint8_t>> writes;
+    // buffer of the currently pending AsyncReadSome call
+    MutableBuffer pendingRead;
+
+    auto MakePeer(size_t maxSendBatchSize, size_t messageChunkSize = 0) -> std::unique_ptr<VAsioPeer>
+    {
+        auto rawByteStream{std::make_unique<NiceMock<MockRawByteStream>>()};
+        stream = rawByteStream.get();
+
+        ON_CALL(*stream, SetListener(_)).WillByDefault(Invoke([this](IRawByteStreamListener& listener) {
+            streamListener = &listener;
+        }));
+        ON_CALL(*stream, AsyncWriteSome(_)).WillByDefault(Invoke([this](ConstBufferSequence bufferSequence) {
+            std::vector<uint8_t> bytes;
+            for (const auto& buffer : bufferSequence)
+            {
+                const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+                bytes.insert(bytes.end(), data, data + buffer.GetSize());
+            }
+            writes.emplace_back(std::move(bytes));
+        }));
+        ON_CALL(*stream, AsyncReadSome(_)).WillByDefault(Invoke([this](MutableBufferSequence bufferSequence) {
+            ASSERT_EQ(bufferSequence.size(), 1u);
+            pendingRead = bufferSequence[0];
+        }));
+
+        VAsioPeerSettings settings;
+        settings.maxSendBatchSize = maxSendBatchSize;
+        settings.messageChunkSize = messageChunkSize;
+
+        return std::make_unique<VAsioPeer>(&peerListener, &ioContext, std::move(rawByteStream), &logger, settings);
+    }
+
+    // Completes the pending read operations with the given bytes, possibly split over multiple reads
+    void Receive(const std::vector<uint8_t>& bytes)
+    {
+        size_t offset{0};
+        while (offset < bytes.size())
+        {
+            const auto size = std::min(pendingRead.GetSize(), bytes.size() - offset);
+            ASSERT_GT(size, 0u);
+            std::memcpy(pendingRead.GetData(), bytes.data() + offset, size);
+            offset += size;
+            streamListener->OnAsyncReadSomeDone(*stream, size);
+        }
+    }
+
+    // Completes every write operation, including the ones started by completing a previous one
+    void CompleteWrites()
+    {
+        for (size_t i = 0; i < writes.size(); ++i)
+        {
+            streamListener->OnAsyncWriteSomeDone(*stream, writes[i].size());
+        }
+    }
+
+    static auto MakePeerInfoWithMessageChunks() -> VAsioPeerInfo
+    {
+        VAsioCapabilities capabilities;
+        capabilities.AddCapability(Capabilities::MessageChunks);
+
+        VAsioPeerInfo info;
+        info.capabilities = capabilities.ToCapabilitiesString();
+        return info;
+    }
+
+    static auto MakeSubscriber(const std::string& networkName) -> VAsioMsgSubscriber
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.receiverIdx = 1;
+        subscriber.networkName = networkName;
+        subscriber.msgTypeName = "TestMessage";
+        subscriber.version = 1;
+        return subscriber;
+    }
+
+    static auto WireBytes(const VAsioMsgSubscriber& subscriber) -> std::vector<uint8_t>
+    {
+        return SerializedMessage{subscriber}.ReleaseStorage();
+    }
+
+    static auto Concat(std::initializer_list<std::vector<uint8_t>> parts) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> result;
+        for (const auto& part : parts)
+        {
+            result.insert(result.end(), part.begin(), part.end());
+        }
+        return result;
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, queued_messages_are_written_in_a_single_batch)
+{
+    auto peer{MakePeer(64 * 1024)};
+
+    const auto a{MakeSubscriber("A")}, b{MakeSubscriber("B")}, c{MakeSubscriber("C")};
+    peer->SendSilKitMsg(SerializedMessage{a});
+    peer->SendSilKitMsg(SerializedMessage{b});
+    peer->SendSilKitMsg(SerializedMessage{c});
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], Concat({WireBytes(a), WireBytes(b), WireBytes(c)}));
+}
+
+TEST_F(Test_VAsioPeer, batch_size_limit_is_honored)
+{
+    const auto a{MakeSubscriber("A")}, b{MakeSubscriber("B")}, c{MakeSubscriber("C")};
+
+    // the limit allows exactly two messages per batch
+    auto peer{MakePeer(WireBytes(a).size() + WireBytes(b).size())};
+
+    peer->SendSilKitMsg(SerializedMessage{a});
+    peer->SendSilKitMsg(SerializedMessage{b});
+    peer->SendSilKitMsg(SerializedMessage{c});
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], Concat({WireBytes(a), WireBytes(b)}));
+
+    streamListener->OnAsyncWriteSomeDone(*stream, writes[0].size());
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], WireBytes(c));
+}
+
+TEST_F(Test_VAsioPeer, zero_batch_size_writes_messages_individually)
+{
+    auto peer{MakePeer(0)};
+
+    const auto a{MakeSubscriber("A")}, b{MakeSubscriber("B")};
+    peer->SendSilKitMsg(SerializedMessage{a});
+    peer->SendSilKitMsg(SerializedMessage{b});
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], WireBytes(a));
+
+    streamListener->OnAsyncWriteSomeDone(*stream, writes[0].size());
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], WireBytes(b));
+}
+
+TEST_F(Test_VAsioPeer, partial_writes_continue_with_the_remaining_bytes)
+{
+    auto peer{MakePeer(64 * 1024)};
+
+    const auto a{MakeSubscriber("A")}, b{MakeSubscriber("B")};
+    peer->SendSilKitMsg(SerializedMessage{a});
+    peer->SendSilKitMsg(SerializedMessage{b});
+
+    ioContext.Run();
+
+    const auto expected{Concat({WireBytes(a), WireBytes(b)})};
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes[0], expected);
+
+    // complete the first message and a part of the second message
+    const auto transferred{WireBytes(a).size() + 3};
+    streamListener->OnAsyncWriteSomeDone(*stream, transferred);
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], std::vector<uint8_t>(expected.begin() + transferred, expected.end()));
+
+    // completing the remaining bytes does not trigger another write
+    streamListener->OnAsyncWriteSomeDone(*stream, writes[1].size());
+    EXPECT_EQ(writes.size(), 2u);
+}
+
+TEST_F(Test_VAsioPeer, shared_message_body_is_written_after_the_network_headers)
+{
+    auto peer{MakePeer(64 * 1024)};
+
+    SilKit::Core::Tests::TestFrameEvent event;
+    event.str = "shared";
+    const EndpointAddress endpointAddress{1, 2};
+
+    peer->SendSilKitMsg(SerializedMessage{MakeSharedSerializedBody(event), endpointAddress, 3});
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], SerializedMessage(event, endpointAddress, 3).ReleaseStorage());
+}
+
+
+TEST_F(Test_VAsioPeer, large_messages_are_written_in_chunks_and_reassembled)
+{
+    const size_t chunkSize{1024};
+    auto sender{MakePeer(64 * 1024, chunkSize)};
+    sender->SetInfo(MakePeerInfoWithMessageChunks());
+
+    const auto large{MakeSubscriber(std::string(10 * 1024, 'L'))};
+    sender->SendSilKitMsg(SerializedMessage{large});
+
+    ioContext.Run();
+    CompleteWrites();
+
+    EXPECT_GT(writes.size(), 10u);
+    std::vector<uint8_t> bytes;
+    for (const auto& write : writes)
+    {
+        // each chunk is preceded by its size, the message kind, and the size of the complete message
+        EXPECT_LE(write.size(), chunkSize + 9);
+        bytes.insert(bytes.end(), write.begin(), write.end());
+    }
+
+    auto receiver{MakePeer(64 * 1024)};
+    receiver->StartAsyncRead();
+
+    std::vector<std::string> networkNames;
+    EXPECT_CALL(peerListener, OnSocketData(receiver.get(), _))
+        .WillOnce(Invoke([&networkNames](IVAsioPeer*, SerializedMessage&& message) {
+        networkNames.emplace_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+    }));
+
+    Receive(bytes);
+
+    EXPECT_EQ(networkNames, (std::vector<std::string>{large.networkName}));
+}
+
+TEST_F(Test_VAsioPeer, messages_of_other_links_overtake_chunked_messages)
+{
+    auto sender{MakePeer(64 * 1024, 1024)};
+    sender->SetInfo(MakePeerInfoWithMessageChunks());
+
+    using SilKit::Services::PubSub::WireDataMessageEvent;
+    const size_t largeSize{10 * 1024}, smallSize{3};
+    const WireDataMessageEvent largeEvent{0ns, std::vector<uint8_t>(largeSize, 'L')};
+    const WireDataMessageEvent smallEvent{0ns, std::vector<uint8_t>(smallSize, 'S')};
+    const EndpointAddress endpointAddress{1, 2};
+
+    // the chunks span the network headers and the shared body of the large message
+    sender->SendSilKitMsg(SerializedMessage{MakeSharedSerializedBody(largeEvent), endpointAddress, 1});
+    // the message of another link is sent ahead of the chunks
+    sender->SendSilKitMsg(SerializedMessage{smallEvent, endpointAddress, 2});
+    // messages of the same link and synchronization messages keep their order
+    sender->SendSilKitMsg(SerializedMessage{smallEvent, endpointAddress, 1});
+    sender->SendSilKitMsg(SerializedMessage{SilKit::Services::Orchestration::NextSimTask{}, endpointAddress, 3});
+
+    ioContext.Run();
+    CompleteWrites();
+
+    std::vector<uint8_t> bytes;
+    for (const auto& write : writes)
+    {
+        bytes.insert(bytes.end(), write.begin(), write.end());
+    }
+
+    auto receiver{MakePeer(64 * 1024)};
+    receiver->StartAsyncRead();
+
+    // remote index and data size of each received message
+    std::vector<std::pair<EndpointId, size_t>> received;
+    EXPECT_CALL(peerListener, OnSocketData(receiver.get(), _))
+        .WillRepeatedly(Invoke([&received](IVAsioPeer*, SerializedMessage&& message) {
+        const auto remoteIndex = message.GetRemoteIndex();
+        const auto dataSize =
+            remoteIndex == 3 ? size_t{0} : message.Deserialize<WireDataMessageEvent>().data.AsSpan().size();
+        received.emplace_back(remoteIndex, dataSize);
+    }));
+
+    Receive(bytes);
+
+    const std::vector<std::pair<EndpointId, size_t>> expected{{2, smallSize}, {1, largeSize}, {1, smallSize}, {3, 0}};
+    EXPECT_EQ(received, expected);
+}
+
+TEST_F(Test_VAsioPeer, messages_are_not_chunked_without_remote_support)
+{
+    auto peer{MakePeer(64 * 1024, 1024)};
+
+    const auto large{MakeSubscriber(std::string(10 * 1024, 'L'))};
+    peer->SendSilKitMsg(SerializedMessage{large});
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], WireBytes(large));
+}
+
+TEST_F(Test_VAsioPeer, multiple_messages_in_a_single_read_are_dispatched)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    std::vector<std::string> networkNames;
+    EXPECT_CALL(peerListener, OnSocketData(peer.get(), _))
+        .Times(3)
+        .WillRepeatedly(Invoke([&networkNames](IVAsioPeer*, SerializedMessage&& message) {
+        networkNames.emplace_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+    }));
+
+    Receive(Concat({WireBytes(MakeSubscriber("A")), WireBytes(MakeSubscriber("B")), WireBytes(MakeSubscriber("C"))}));
+
+    EXPECT_EQ(networkNames, (std::vector<std::string>{"A", "B", "C"}));
+}
+
+TEST_F(Test_VAsioPeer, messages_split_over_multiple_reads_are_dispatched)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    std::vector<std::string> networkNames;
+    EXPECT_CALL(peerListener, OnSocketData(peer.get(), _))
+        .Times(2)
+        .WillRepeatedly(Invoke([&networkNames](IVAsioPeer*, SerializedMessage&& message) {
+        networkNames.emplace_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+    }));
+
+    const auto bytes{Concat({WireBytes(MakeSubscriber("A")), WireBytes(MakeSubscriber("B"))})};
+    for (const auto byte : bytes)
+    {
+        Receive({byte});
+    }
+
+    EXPECT_EQ(networkNames, (std::vector<std::string>{"A", "B"}));
+}
+
+TEST_F(Test_VAsioPeer, messages_larger_than_the_receive_buffer_are_dispatched)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    const auto large{MakeSubscriber(std::string(1024 * 1024, 'L'))};
+
+    std::vector<std::string> networkNames;
+    EXPECT_CALL(peerListener, OnSocketData(peer.get(), _))
+        .Times(3)
+        .WillRepeatedly(Invoke([&networkNames](IVAsioPeer*, SerializedMessage&& message) {
+        networkNames.emplace_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+    }));
+
+    Receive(Concat({WireBytes(MakeSubscriber("A")), WireBytes(large), WireBytes(MakeSubscriber("B"))}));
+
+    EXPECT_EQ(networkNames, (std::vector<std::string>{"A", large.networkName, "B"}));
+}
+
+TEST_F(Test_VAsioPeer, retained_messages_stay_valid_while_receiving)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    std::vector<SerializedMessage> messages;
+    EXPECT_CALL(peerListener, OnSocketData(peer.get(), _))
+        .WillRepeatedly(Invoke([&messages](IVAsioPeer*, SerializedMessage&& message) {
+        messages.emplace_back(std::move(message));
+    }));
+
+    // receive enough messages to cycle through several receive buffers
+    std::vector<std::string> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        expected.emplace_back(std::to_string(i) + std::string(200, 'x'));
+        Receive(WireBytes(MakeSubscriber(expected.back())));
+    }
+
+    ASSERT_EQ(messages.size(), expected.size());
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        EXPECT_EQ(messages[i].Deserialize<VAsioMsgSubscriber>().networkName, expected[i]);
+    }
+}
+
+TEST_F(Test_VAsioPeer, invalid_message_size_shuts_down_the_peer)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    EXPECT_CALL(peerListener, OnSocketData(_, _)).Times(0);
+    EXPECT_CALL(*stream, Shutdown()).Times(1);
+
+    Receive({2, 0, 0, 0});
+}
+
+TEST_F(Test_VAsioPeer, invalid_message_chunk_shuts_down_the_peer)
+{
+    auto peer{MakePeer(64 * 1024)};
+    peer->StartAsyncRead();
+
+    EXPECT_CALL(peerListener, OnSocketData(_, _)).Times(0);
+    EXPECT_CALL(*stream, Shutdown()).Times(1);
+
+    // the chunk is larger than the complete message it claims to be part of
+    const auto chunkKind = static_cast<uint8_t>(VAsioMsgKind::SilKitMessageChunk);
+    Receive({13, 0, 0, 0, chunkKind, 4, 0, 0, 0, 8, 0, 0, 0});
+}
+
+
+} // namespace
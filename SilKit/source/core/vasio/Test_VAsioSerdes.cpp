@@ -50,6 +50,21 @@ bool operator==(const KnownParticipants& lhs, const KnownParticipants& rhs)
     return lhs.messageHeader == rhs.messageHeader && lhs.peerInfos == rhs.peerInfos;
 }
 
+bool operator==(const SubscriptionAnnouncementBatch& lhs, const SubscriptionAnnouncementBatch& rhs)
+{
+    return lhs.subscribers == rhs.subscribers;
+}
+
+bool operator==(const SubscriptionAcknowledge& lhs, const SubscriptionAcknowledge& rhs)
+{
+    return lhs.status == rhs.status && lhs.subscriber == rhs.subscriber;
+}
+
+bool operator==(const SubscriptionAcknowledgeBatch& lhs, const SubscriptionAcknowledgeBatch& rhs)
+{
+    return lhs.acknowledges == rhs.acknowledges;
+}
+
 } // namespace Core
 } // namespace SilKit
 
@@ -121,6 +136,29 @@ TEST(Test_VAsioSerdes, vasio_participantAnouncementReply)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_VAsioSerdes, vasio_subscriptionBatches)
+{
+    MessageBuffer buffer;
+    SubscriptionAnnouncementBatch announcementIn{}, announcementOut{};
+    SubscriptionAcknowledgeBatch acknowledgeIn{}, acknowledgeOut{};
+
+    for (auto i = 0; i < 10; i++)
+    {
+        announcementIn.subscribers.push_back(MakeSubscriber());
+        acknowledgeIn.acknowledges.push_back(
+            {i % 2 == 0 ? SubscriptionAcknowledge::Status::Success : SubscriptionAcknowledge::Status::Failed,
+             MakeSubscriber()});
+    }
+
+    Serialize(buffer, announcementIn);
+    Serialize(buffer, acknowledgeIn);
+    Deserialize(buffer, announcementOut);
+    Deserialize(buffer, acknowledgeOut);
+
+    EXPECT_EQ(announcementIn, announcementOut);
+    EXPECT_EQ(acknowledgeIn, acknowledgeOut);
+}
+
 TEST(Test_VAsioSerdes, vasio_knownParticipants)
 {
     MessageBuffer buffer;
@@ -19,6 +19,8 @@
 // OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 // WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#pragma once
+
 #include <string>
 #include <unordered_set>
 
@@ -51,6 +53,10 @@ namespace Capabilities {
 const auto ProxyMessage = CapabilityLiteral{"proxy-message"};
 const auto AutonomousSynchronous = CapabilityLiteral{"autonomous-synchronous"};
 const auto RequestParticipantConnection = CapabilityLiteral{"request-participant-connection-v2"};
+const auto SharedMemory = CapabilityLiteral{"shared-memory"};
+const auto SubscriptionBatch = CapabilityLiteral{"subscription-batch"};
+const auto MessageChunks = CapabilityLiteral{"message-chunks"};
+const auto LogMsgBatch = CapabilityLiteral{"log-msg-batch"};
 } // namespace Capabilities
 
 
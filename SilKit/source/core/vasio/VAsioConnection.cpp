@@ -40,9 +40,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SetThreadName.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
+#include "Hash.hpp"
 #include "TransformAcceptorUris.hpp"
 
 #include "ConnectPeer.hpp"
+#include "MakeSharedMemoryTransport.hpp"
 #include "util/TracingMacros.hpp"
 
 #include "asio.hpp"
@@ -178,6 +180,9 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
     SilKit::Core::VAsioCapabilities capabilities;
 
     capabilities.AddCapability(SilKit::Core::Capabilities::AutonomousSynchronous);
+    capabilities.AddCapability(SilKit::Core::Capabilities::SubscriptionBatch);
+    capabilities.AddCapability(SilKit::Core::Capabilities::MessageChunks);
+    capabilities.AddCapability(SilKit::Core::Capabilities::LogMsgBatch);
 
     if (participantConfiguration.middleware.registryAsFallbackProxy)
     {
@@ -189,6 +194,14 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
         capabilities.AddCapability(SilKit::Core::Capabilities::RequestParticipantConnection);
     }
 
+    // the shared-memory connection is negotiated via the local-domain socket
+    const auto& middleware = participantConfiguration.middleware;
+    if (middleware.enableSharedMemory && middleware.enableDomainSockets
+        && SilKit::Core::IsSharedMemoryTransportSupported())
+    {
+        capabilities.AddCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
+
     return capabilities;
 }
 
@@ -221,6 +234,13 @@ auto GetConnectTimeoutSeconds(const SilKit::Config::ParticipantConfiguration& co
 }
 
 
+auto GetConnectAttemptDelay(const SilKit::Config::ParticipantConfiguration& config) -> std::chrono::milliseconds
+{
+    // a pending connection attempt does not delay the attempt with the next acceptor URI for longer than this
+    return std::min(250ms, GetConnectTimeoutSeconds(config));
+}
+
+
 auto GetRegistryConnectTimeout(const SilKit::Config::ParticipantConfiguration& config) -> std::chrono::milliseconds
 {
     return GetConnectTimeoutSeconds(config);
@@ -242,6 +262,18 @@ auto MakeConnectKnownParticipantsSettings(const SilKit::Config::ParticipantConfi
     SilKit::Core::ConnectKnownParticipantsSettings settings;
     settings.directConnectTimeout = GetConnectTimeoutSeconds(config);
     settings.remoteConnectRequestTimeout = GetConnectTimeoutSeconds(config);
+    settings.proxyConnectTimeout = GetConnectTimeoutSeconds(config);
+    settings.proxyConnectFirst = config.middleware.registryAsHub;
+    return settings;
+}
+
+auto MakeVAsioPeerSettings(const SilKit::Config::ParticipantConfiguration& config) -> SilKit::Core::VAsioPeerSettings
+{
+    SilKit::Core::VAsioPeerSettings settings;
+    settings.maxSendBatchSize = static_cast<size_t>(std::max(0, config.middleware.maxSendBatchSize));
+    // larger chunks would be rejected by the receiving peer
+    settings.messageChunkSize = std::min(static_cast<size_t>(std::max(0, config.middleware.messageChunkSize)),
+                                         SilKit::Core::MAX_MESSAGE_CHUNK_SIZE);
     return settings;
 }
 
@@ -316,6 +348,11 @@ VAsioConnection::~VAsioConnection()
     {
         _ioWorker.join();
     }
+
+    if (_ioWorkerPool != nullptr)
+    {
+        _ioWorkerPool->Shutdown();
+    }
 }
 
 void VAsioConnection::SetLogger(Services::Logging::ILogger* logger)
@@ -424,6 +461,11 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
                 Services::Logging::Error(_logger, "Unable to accept local domain connections on '{}': {}", uri.Path(),
                                          exception.what());
             }
+
+            if (_capabilities.HasCapability(Capabilities::SharedMemory))
+            {
+                OpenSharedMemoryAcceptor(uri.Path());
+            }
         }
         else if (uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
         {
@@ -436,6 +478,32 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
     }
 }
 
+void VAsioConnection::OpenSharedMemoryAcceptor(const std::string& localPath)
+{
+    const auto path = MakeSharedMemoryAcceptorPath(localPath);
+
+    // file must not exist before we bind/listen on it
+    (void)fs::remove(path);
+
+    try
+    {
+        auto acceptor{MakeSharedMemoryAcceptor(*_ioContext, _ioContext->MakeLocalAcceptor(path), _logger)};
+        acceptor->SetListener(*this);
+        acceptor->AsyncAccept({});
+
+        {
+            std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
+            _acceptors.emplace_back(std::move(acceptor));
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        // peers fall back to the local-domain acceptor
+        Services::Logging::Warn(_logger, "Unable to accept shared-memory connections on '{}': {}", path,
+                                exception.what());
+    }
+}
+
 void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
@@ -452,7 +520,8 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // Wait for a fixed amount of time for the registry connection to complete.
     WaitForRegistryHandshakeToComplete(GetRegistryHandshakeTimeout(_config));
 
-    // Start connecting and initiate the handshakes with all known participants.
+    // Wait until connecting and the handshakes with all known participants have been initiated. This starts as soon as
+    // the registry sends the known participants, while the registry handshake is still being completed.
     ConnectToKnownParticipants();
 
     // Wait for a fixed amount of time for all handshakes to complete.
@@ -581,8 +650,6 @@ void VAsioConnection::ConnectToKnownParticipants()
 {
     _logger->Debug("Connecting to known participants");
 
-    _connectKnownParticipants.StartConnecting();
-
     auto future{_startWaitingForParticipantHandshakes.get_future()};
 
     // propagate any exception stored in the promise
@@ -854,6 +921,10 @@ void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessag
     peer->SetProtocolVersion(ExtractProtocolVersion(msg.messageHeader));
 
     _connectKnownParticipants.SetKnownParticipants(msg.peerInfos);
+
+    // The registry only sends the known participants after accepting our announcement. Start connecting right away,
+    // instead of waiting for the main thread to observe the completed registry handshake.
+    _connectKnownParticipants.StartConnecting();
 }
 
 
@@ -1076,8 +1147,44 @@ void VAsioConnection::HandleConnectedPeer(IVAsioPeer* peer)
 void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& simulationName,
                                                       const std::string& participantName, IVAsioPeer* peer)
 {
-    std::lock_guard<decltype(_mutex)> lock{_mutex};
-    _participantNameToPeer[simulationName].insert({participantName, peer});
+    const bool isProxyPeer{dynamic_cast<VAsioProxyPeer*>(peer) != nullptr};
+
+    VAsioProxyPeer* replacedProxyPeer{nullptr};
+
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+        auto& participantNameToPeer{_participantNameToPeer[simulationName]};
+
+        const auto it{participantNameToPeer.find(participantName)};
+        if (it == participantNameToPeer.end())
+        {
+            participantNameToPeer.emplace(participantName, peer);
+        }
+        else if (!isProxyPeer)
+        {
+            // a direct connection replaces the proxy connection to the same participant
+            replacedProxyPeer = dynamic_cast<VAsioProxyPeer*>(it->second);
+            if (replacedProxyPeer != nullptr)
+            {
+                it->second = peer;
+            }
+        }
+
+        if (!isProxyPeer)
+        {
+            _replacedProxyPeerNames.erase(participantName);
+        }
+    }
+
+    if (replacedProxyPeer != nullptr)
+    {
+        SilKit::Services::Logging::Debug(_logger, "Replacing the proxy connection to {} by the direct connection",
+                                         participantName);
+
+        std::unique_lock<std::mutex> lock{_peersLock};
+        RemoveReplacedProxyPeer(replacedProxyPeer);
+    }
 }
 
 auto VAsioConnection::FindPeerByName(const std::string& simulationName,
@@ -1109,6 +1216,13 @@ void VAsioConnection::StartIoWorker()
         return;
     }
 
+    const auto ioWorkerThreads = std::max(0, _config.middleware.ioWorkerThreads);
+    if (ioWorkerThreads > 0 && !_isShuttingDown)
+    {
+        _ioWorkerPool = std::make_unique<IoWorkerPool>(static_cast<size_t>(ioWorkerThreads),
+                                                       "IOW " + _participantName, _logger);
+    }
+
     _ioWorker = std::thread{[this]() {
         SilKit::Util::SetThreadName(("IO " + _participantName).substr(0, 15));
 
@@ -1224,6 +1338,40 @@ void VAsioConnection::AddPeer(std::unique_ptr<IVAsioPeer> newPeer)
     _peers.emplace_back(std::move(newPeer));
 }
 
+void VAsioConnection::RemoveProxyPeer(const VAsioPeerInfo& peerInfo)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", peerInfo.participantName);
+
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _replacedProxyPeerNames.insert(peerInfo.participantName);
+    }
+
+    std::unique_lock<std::mutex> lock{_peersLock};
+
+    for (const auto& peer : _peers)
+    {
+        auto* const proxyPeer = dynamic_cast<VAsioProxyPeer*>(peer.get());
+        if (proxyPeer != nullptr && proxyPeer->GetInfo().participantName == peerInfo.participantName)
+        {
+            RemoveReplacedProxyPeer(proxyPeer);
+            return;
+        }
+    }
+}
+
+void VAsioConnection::RemoveReplacedProxyPeer(VAsioProxyPeer* proxyPeer)
+{
+    const auto it{_peerToProxyPeers.find(proxyPeer->GetPeer())};
+    if (it != _peerToProxyPeers.end())
+    {
+        it->second.erase(proxyPeer);
+    }
+
+    RemovePeerFromLinks(proxyPeer);
+    RemovePeerFromConnection(proxyPeer);
+}
+
 void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> callback)
 {
     ExecuteOnIoThread(
@@ -1321,10 +1469,19 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
         auto simulationIt{_participantNameToPeer.find(peer->GetSimulationName())};
         if (simulationIt != _participantNameToPeer.end())
         {
-            simulationIt->second.erase(peer->GetInfo().participantName);
+            // the name may already be associated with the direct peer that replaced this (proxy) peer
+            auto participantIt{simulationIt->second.find(peer->GetInfo().participantName)};
+            if (participantIt != simulationIt->second.end() && participantIt->second == peer)
+            {
+                simulationIt->second.erase(participantIt);
+            }
         }
     }
 
+    _peerStrands.erase(peer);
+    _remoteServiceEndpoints.erase(peer);
+    _queuedSubscriptions.erase(peer);
+
     auto it{
         std::find_if(_peers.begin(), _peers.end(), [needle = peer](const auto& hay) { return hay.get() == needle; })};
 
@@ -1351,14 +1508,24 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveSubscriptionAnnouncement(from, std::move(buffer));
     case VAsioMsgKind::SubscriptionAcknowledge:
         return ReceiveSubscriptionAcknowledge(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionAnnouncementBatch:
+        return ReceiveSubscriptionAnnouncementBatch(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionAcknowledgeBatch:
+        return ReceiveSubscriptionAcknowledgeBatch(from, std::move(buffer));
     case VAsioMsgKind::SilKitMwMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitSimMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
+    case VAsioMsgKind::LogMsgBatch:
+        return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitRegistryMessage:
         return ReceiveRegistryMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitProxyMessage:
         return ReceiveProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SilKitMessageChunk:
+        // chunks are reassembled by the peer and never delivered on their own
+        _logger->Warn("Received message with VAsioMsgKind::SilKitMessageChunk");
+        break;
     }
 }
 
@@ -1375,7 +1542,8 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         return;
     }
 
-    auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+    // NB: Only the routing information is read here. The payload is only deserialized if we are the destination.
+    const auto proxyMessageRouting = buffer.GetProxyMessageRouting();
 
     if (!_capabilities.HasProxyMessageCapability())
     {
@@ -1383,7 +1551,7 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         SilKit::Services::Logging::Warn(
             _logger, onceFlag,
             "Ignoring VAsioMsgKind::SilKitProxyMessage because feature is disabled via configuration: From {}, To {}",
-            proxyMessage.source, proxyMessage.destination);
+            proxyMessageRouting.source, proxyMessageRouting.destination);
         return;
     }
 
@@ -1391,35 +1559,59 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
 
     SilKit::Services::Logging::Trace(_logger,
                                      "Received message with VAsioMsgKind::SilKitProxyMessage: From {} ({}), To {}",
-                                     proxyMessage.source, fromSimulationName, proxyMessage.destination);
+                                     proxyMessageRouting.source, fromSimulationName, proxyMessageRouting.destination);
 
 
-    const bool fromIsSource = from->GetInfo().participantName == proxyMessage.source;
+    const bool fromIsSource = from->GetInfo().participantName == proxyMessageRouting.source;
     if (fromIsSource)
     {
-        auto peer{FindPeerByName(fromSimulationName, proxyMessage.destination)};
+        auto peer{FindPeerByName(fromSimulationName, proxyMessageRouting.destination)};
         if (peer == nullptr)
         {
             SilKit::Services::Logging::Error(_logger, "Unable to deliver proxy message from {} to {} in simulation {}",
-                                             proxyMessage.source, proxyMessage.destination, fromSimulationName);
+                                             proxyMessageRouting.source, proxyMessageRouting.destination,
+                                             fromSimulationName);
             return;
         }
 
-        peer->SendSilKitMsg(SerializedMessage{proxyMessage});
+        // The received wire bytes are forwarded unchanged, without decoding and re-encoding the payload.
+        peer->SendSilKitMsg(SerializedMessage{buffer.ReleaseStorage()});
 
         // We are relaying a message from source to destination and acting as a proxy. Record the association between
         // source and destination. This is used during disconnects, where we create empty ProxyMessages on behalf of
         // the disconnected peer, to inform the destination that the source peer has disconnected.
-        _proxySourceToDestinations[fromSimulationName][proxyMessage.source].insert(proxyMessage.destination);
+        _proxySourceToDestinations[fromSimulationName][proxyMessageRouting.source].insert(
+            proxyMessageRouting.destination);
 
         return;
     }
 
-    const bool isDestination = _participantName == proxyMessage.destination;
+    const bool isDestination = _participantName == proxyMessageRouting.destination;
     if (isDestination)
     {
+        auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+
         auto peer{FindPeerByName(_simulationName, proxyMessage.source)};
 
+        const bool isReplacedProxyConnection{[this, &proxyMessage, peer] {
+            if (peer != nullptr)
+            {
+                return dynamic_cast<VAsioProxyPeer*>(peer) == nullptr;
+            }
+
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+            return _replacedProxyPeerNames.count(proxyMessage.source) > 0;
+        }()};
+
+        // Late messages via the proxy must not reach (or re-create) a peer for a directly connected participant.
+        if (isReplacedProxyConnection)
+        {
+            SilKit::Services::Logging::Debug(
+                _logger, "Ignoring proxy message from {}, because the proxy connection was replaced by a direct one",
+                proxyMessage.source);
+            return;
+        }
+
         if (peer == nullptr)
         {
             SilKit::Services::Logging::Debug(_logger, "Creating VAsioProxyPeer ({})", proxyMessage.source);
@@ -1445,6 +1637,29 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
 }
 
 void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
+    auto ack = AddRemoteSubscriberAndMakeAcknowledge(from, std::move(subscriber));
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+}
+
+void VAsioConnection::ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAnnouncementBatch>();
+
+    SubscriptionAcknowledgeBatch ackBatch;
+    ackBatch.acknowledges.reserve(batch.subscribers.size());
+    for (auto&& subscriber : batch.subscribers)
+    {
+        ackBatch.acknowledges.emplace_back(AddRemoteSubscriberAndMakeAcknowledge(from, std::move(subscriber)));
+    }
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ackBatch});
+}
+
+auto VAsioConnection::AddRemoteSubscriberAndMakeAcknowledge(IVAsioPeer* from, VAsioMsgSubscriber subscriber)
+    -> SubscriptionAcknowledge
 {
     // Note: there may be multiple types that match the SerdesName
     // we try to find a version to match it, for backward compatibility.
@@ -1465,7 +1680,6 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         return subscriptionVersion;
     };
 
-    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
     bool wasAdded = TryAddRemoteSubscriber(from, subscriber);
 
     // check our Message version against the remote participant's version
@@ -1482,18 +1696,30 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         // Tell our peer what version of the given message type we have
         subscriber.version = myMessageVersion;
     }
-    // send acknowledge
+    // acknowledge
     SubscriptionAcknowledge ack;
     ack.subscriber = std::move(subscriber);
     ack.status = wasAdded ? SubscriptionAcknowledge::Status::Success : SubscriptionAcknowledge::Status::Failed;
-
-    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+    return ack;
 }
 
 void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto ack = buffer.Deserialize<SubscriptionAcknowledge>();
+    HandleSubscriptionAcknowledge(from, ack);
+}
+
+void VAsioConnection::ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAcknowledgeBatch>();
+    for (const auto& ack : batch.acknowledges)
+    {
+        HandleSubscriptionAcknowledge(from, ack);
+    }
+}
 
+void VAsioConnection::HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack)
+{
     if (ack.status != SubscriptionAcknowledge::Status::Success)
     {
         Services::Logging::Error(_logger, "Failed to subscribe [{}] {} from {}", ack.subscriber.networkName,
@@ -1504,24 +1730,28 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
     RemovePendingSubscription({from, ack.subscriber});
 }
 
+auto VAsioConnection::PendingAcksIdentifierHash::operator()(const PendingAcksIdentifier& ackId) const -> size_t
+{
+    // the version is not part of the identity of a subscriber, see operator==(VAsioMsgSubscriber, VAsioMsgSubscriber)
+    const auto& subscriber = ackId.second;
+    auto hash = Util::Hash::HashCombine(std::hash<IVAsioPeer*>{}(ackId.first), subscriber.receiverIdx);
+    hash = Util::Hash::HashCombine(hash, Util::Hash::Hash(subscriber.networkName));
+    hash = Util::Hash::HashCombine(hash, Util::Hash::Hash(subscriber.msgTypeName));
+    return static_cast<size_t>(hash);
+}
+
 void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
 {
-    auto iterPendingSync =
-        std::find(_pendingSubscriptionAcknowledges.begin(), _pendingSubscriptionAcknowledges.end(), ackId);
-    if (iterPendingSync != _pendingSubscriptionAcknowledges.end())
+    if (_pendingSubscriptionAcknowledges.erase(ackId) > 0)
     {
-        _pendingSubscriptionAcknowledges.erase(iterPendingSync);
         if (_pendingSubscriptionAcknowledges.empty())
         {
             SyncSubscriptionsCompleted();
         }
     }
 
-    auto iterPendingASync =
-        std::find(_pendingAsyncSubscriptionAcknowledges.begin(), _pendingAsyncSubscriptionAcknowledges.end(), ackId);
-    if (iterPendingASync != _pendingAsyncSubscriptionAcknowledges.end())
+    if (_pendingAsyncSubscriptionAcknowledges.erase(ackId) > 0)
     {
-        _pendingAsyncSubscriptionAcknowledges.erase(iterPendingASync);
         if (_pendingAsyncSubscriptionAcknowledges.empty())
         {
             AsyncSubscriptionsCompleted();
@@ -1529,6 +1759,69 @@ void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ack
     }
 }
 
+void VAsioConnection::QueueSubscription(IVAsioPeer* peer, const VAsioMsgSubscriber& subscriber,
+                                        RegistrationMode registrationMode)
+{
+    _queuedSubscriptions[peer].emplace_back(subscriber);
+
+    // deferred subscriptions are sent together when the deferred registrations end, see
+    // AddAsyncSubscriptionsCompletionHandler, unless they already ended in the meantime
+    if (registrationMode != RegistrationMode::Deferred || !_deferServiceRegistrations)
+    {
+        PostSendQueuedSubscriptions();
+    }
+}
+
+void VAsioConnection::PostSendQueuedSubscriptions()
+{
+    // registrations which are already posted to the I/O context are processed first and end up in the same batch
+    if (!_sendQueuedSubscriptionsPosted)
+    {
+        _sendQueuedSubscriptionsPosted = true;
+        _ioContext->Post([this] { SendQueuedSubscriptions(); });
+    }
+}
+
+void VAsioConnection::SendQueuedSubscriptions()
+{
+    _sendQueuedSubscriptionsPosted = false;
+
+    auto queuedSubscriptions = std::move(_queuedSubscriptions);
+    _queuedSubscriptions.clear();
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+    // peers which disconnected in the meantime are skipped
+    for (auto&& peer : _peers)
+    {
+        auto it = queuedSubscriptions.find(peer.get());
+        if (it == queuedSubscriptions.end())
+        {
+            continue;
+        }
+
+        auto& subscribers = it->second;
+
+        const VAsioCapabilities peerCapabilities{peer->GetInfo().capabilities};
+        if (subscribers.size() > 1 && peerCapabilities.HasCapability(Capabilities::SubscriptionBatch))
+        {
+            Services::Logging::Debug(_logger, "Subscribing to {} message types from participant '{}'",
+                                     subscribers.size(), peer->GetInfo().participantName);
+
+            SubscriptionAnnouncementBatch batch;
+            batch.subscribers = std::move(subscribers);
+            peer->SendSilKitMsg(SerializedMessage{batch});
+        }
+        else
+        {
+            for (auto&& subscriber : subscribers)
+            {
+                peer->Subscribe(std::move(subscriber));
+            }
+        }
+    }
+}
+
 bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber)
 {
     bool wasAdded = false;
@@ -1581,11 +1874,46 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    const auto& remoteEndpoint = GetRemoteServiceEndpoint(from, endpoint.endpoint);
+
+    if (_ioWorkerPool == nullptr)
+    {
+        _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, *remoteEndpoint, std::move(buffer));
+        return;
+    }
+
+    // Messages of a single peer are dispatched in order, and a single service never receives messages concurrently
+    // (see SilKitLink::DistributeRemoteSilKitMessage). The peer might be removed before the message is dispatched,
+    // therefore it is not passed on to the receiver.
+    auto& strand = _peerStrands[from];
+    if (strand == nullptr)
+    {
+        strand = _ioWorkerPool->MakeStrand();
+    }
+
+    // The receive buffer is reused by the I/O thread once it is no longer referenced. Queued messages must not refer
+    // to it, which also keeps a small queued message from holding on to a whole receive buffer.
+    buffer.DetachFromReceiveBuffer();
+
+    auto* receiver = _vasioReceivers[receiverIdx].get();
+    strand->Post([receiver, remoteEndpoint, buffer = std::move(buffer)]() mutable {
+        receiver->ReceiveRawMsg(nullptr, *remoteEndpoint, std::move(buffer));
+    });
+}
+
+auto VAsioConnection::GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId serviceId)
+    -> const std::shared_ptr<const RemoteServiceEndpoint>&
+{
+    auto& remoteEndpoint = _remoteServiceEndpoints[from][serviceId];
+    if (remoteEndpoint == nullptr)
+    {
+        auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
+        ServiceDescriptor descriptor(fromService->GetServiceDescriptor());
+        descriptor.SetServiceId(serviceId);
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+        remoteEndpoint = std::make_shared<const RemoteServiceEndpoint>(std::move(descriptor));
+    }
+    return remoteEndpoint;
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1645,8 +1973,15 @@ void VAsioConnection::ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage
     }
 }
 
+void VAsioConnection::DeferServiceRegistrations()
+{
+    _deferServiceRegistrations = true;
+}
+
 void VAsioConnection::AddAsyncSubscriptionsCompletionHandler(std::function<void()> handler)
 {
+    const auto endDeferredServiceRegistrations = _deferServiceRegistrations.exchange(false);
+
     if (_hasPendingAsyncSubscriptions)
     {
         _asyncSubscriptionsCompletionHandlers.Add(std::move(handler));
@@ -1655,6 +1990,13 @@ void VAsioConnection::AddAsyncSubscriptionsCompletionHandler(std::function<void(
     {
         handler();
     }
+
+    // the deferred registrations are already posted to the I/O context, their subscriptions are sent afterwards and
+    // acknowledged only after the handler has been added
+    if (endDeferredServiceRegistrations)
+    {
+        _ioContext->Post([this] { SendQueuedSubscriptions(); });
+    }
 }
 
 auto VAsioConnection::GetNumberOfRemoteReceivers(const IServiceEndpoint* service,
@@ -1787,17 +2129,30 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
 }
 
 
+auto VAsioConnection::GetNetworkIndex(const std::string& networkName) -> uint32_t
+{
+    std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+
+    // index zero marks service descriptors without an assigned network index
+    const auto nextNetworkIndex = static_cast<uint32_t>(_networkIndices.size() + 1);
+    return _networkIndices.emplace(networkName, nextNetworkIndex).first->second;
+}
+
+
 auto VAsioConnection::MakeConnectPeer(const VAsioPeerInfo& peerInfo) -> std::unique_ptr<IConnectPeer>
 {
-    auto connectPeer{
-        std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo, _config.middleware.enableDomainSockets)};
+    auto connectPeer{std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo,
+                                                   _config.middleware.enableDomainSockets,
+                                                   _capabilities.HasCapability(Capabilities::SharedMemory),
+                                                   GetConnectAttemptDelay(_config))};
     return connectPeer;
 }
 
 
 auto VAsioConnection::MakeVAsioPeer(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IVAsioPeer>
 {
-    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger)};
+    auto vAsioPeer{
+        std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger, MakeVAsioPeerSettings(_config))};
     return vAsioPeer;
 }
 
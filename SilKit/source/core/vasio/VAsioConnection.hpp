@@ -68,12 +68,15 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MakeAsioIoContext.hpp"
 #include "ConnectKnownParticipants.hpp"
 #include "RemoteConnectionManager.hpp"
+#include "IoWorkerPool.hpp"
 
 
 namespace SilKit {
 namespace Core {
 
 
+class VAsioProxyPeer;
+
 class VAsioConnection
     : public IVAsioPeerListener
     , private IAcceptorListener
@@ -120,8 +123,20 @@ public:
     template <class SilKitServiceT>
     void RegisterSilKitService(SilKitServiceT* service)
     {
+        AssignNetworkIndex(service);
+
+        auto registrationMode = RegistrationMode::Synchronous;
+        if (SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        {
+            registrationMode = RegistrationMode::Asynchronous;
+        }
+        else if (SilKitServiceTraits<SilKitServiceT>::UseDeferredRegistration() && _deferServiceRegistrations)
+        {
+            registrationMode = RegistrationMode::Deferred;
+        }
+
         std::future<void> allAcked;
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (registrationMode == RegistrationMode::Synchronous)
         {
             SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
             _receivedAllSubscriptionAcknowledges = std::promise<void>{};
@@ -132,9 +147,11 @@ public:
             _hasPendingAsyncSubscriptions = true;
         }
 
-        _ioContext->Post([this, service]() { this->RegisterSilKitServiceImpl<SilKitServiceT>(service); });
+        _ioContext->Post([this, service, registrationMode]() {
+            this->RegisterSilKitServiceImpl<SilKitServiceT>(service, registrationMode);
+        });
 
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (registrationMode == RegistrationMode::Synchronous)
         {
             Trace(_logger, "SIL Kit waiting for subscription acknowledges for SilKitService {}.",
                   typeid(*service).name());
@@ -164,6 +181,13 @@ public:
         ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
     }
 
+    template <typename SilKitMessageT>
+    void SendMsgs(const IServiceEndpoint* from, std::vector<SilKitMessageT>&& msgs)
+    {
+        // A single task for all messages, peers which accept message batches receive them as a single message
+        ExecuteOnIoThread([this, from, msgs = std::move(msgs)] { SendMsgsImpl(from, msgs); });
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
@@ -171,6 +195,16 @@ public:
                           std::forward<SilKitMessageT>(msg));
     }
 
+    template <typename SilKitMessageT>
+    void SendMsg(std::vector<MessageTarget> targets, SilKitMessageT&& msg)
+    {
+        using MessageT = std::decay_t<SilKitMessageT>;
+        // A single task for all targets, the message is serialized once on the I/O thread
+        ExecuteOnIoThread([this, targets = std::move(targets), msg = MessageT{std::forward<SilKitMessageT>(msg)}] {
+            SendMsgToTargetsImpl(targets, msg);
+        });
+    }
+
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
     {
         callback();
@@ -194,6 +228,7 @@ public:
     auto PrepareAcceptorEndpointUris(const std::string& connectUri) -> std::vector<std::string>;
     void OpenTcpAcceptors(const std::vector<std::string>& acceptorEndpointUris);
     void OpenLocalAcceptors(const std::vector<std::string>& acceptorEndpointUris);
+    void OpenSharedMemoryAcceptor(const std::string& localPath);
 
     // Listening Sockets (acceptors)
     void AcceptLocalConnections(const std::string& uniqueId);
@@ -205,7 +240,12 @@ public:
 
     void NotifyShutdown();
 
-    // Register handlers for completion of async service creation
+    //! \brief Services which support it (see SilKitServiceTraits::UseDeferredRegistration) are registered
+    //! asynchronously from now on. Their subscriptions are sent to each peer in a single batch, once
+    //! AddAsyncSubscriptionsCompletionHandler is called, which also waits for their acknowledges.
+    void DeferServiceRegistrations();
+
+    // Register handlers for completion of async service creation, ends the deferred service registrations
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> handler);
 
     size_t GetNumberOfConnectedParticipants()
@@ -230,6 +270,9 @@ private: // data types
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    template <class MsgT>
+    using SilKitSenderLinks = std::vector<std::shared_ptr<SilKitLink<MsgT>>>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
     using SilKitMessageTypes = std::tuple<
@@ -258,8 +301,16 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    //! Returns the cached remote service endpoint of the given service of the peer, see _remoteServiceEndpoints
+    auto GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId serviceId)
+        -> const std::shared_ptr<const RemoteServiceEndpoint>&;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    auto AddRemoteSubscriberAndMakeAcknowledge(IVAsioPeer* from, VAsioMsgSubscriber subscriber)
+        -> SubscriptionAcknowledge;
+    void HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
@@ -285,16 +336,36 @@ private:
                                          IVAsioPeer* peer);
     auto FindPeerByName(const std::string& simulationName, const std::string& participantName) const -> IVAsioPeer*;
 
+    enum class RegistrationMode
+    {
+        //! The registering thread waits for the subscription acknowledges
+        Synchronous,
+        //! The acknowledges are awaited by the async subscriptions completion handlers
+        Asynchronous,
+        //! Like Asynchronous, but the subscriptions are only sent when the deferred registrations end
+        Deferred,
+    };
+
     // Subscriptions completed Helper
     void SyncSubscriptionsCompleted();
     void AsyncSubscriptionsCompleted();
     // Unique identifier of SubscriptionAcknowledges on the subscriber
     using PendingAcksIdentifier = std::pair<IVAsioPeer*, VAsioMsgSubscriber>;
+    struct PendingAcksIdentifierHash
+    {
+        auto operator()(const PendingAcksIdentifier& ackId) const -> size_t;
+    };
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
+    // Subscriptions are sent in a single batch per peer, once all queued service registrations were processed
+    void QueueSubscription(IVAsioPeer* peer, const VAsioMsgSubscriber& subscriber, RegistrationMode registrationMode);
+    void PostSendQueuedSubscriptions();
+    void SendQueuedSubscriptions();
 
     void SendProxyPeerShutdownNotification(IVAsioPeer* peer);
     void RemovePeerFromLinks(IVAsioPeer* peer);
     void RemovePeerFromConnection(IVAsioPeer* peer);
+    // Removes a proxy peer without notifying the shutdown callbacks, requires holding _peersLock
+    void RemoveReplacedProxyPeer(VAsioProxyPeer* proxyPeer);
 
     template <class SilKitMessageT>
     auto GetLinkByName(const std::string& networkName) -> std::shared_ptr<SilKitLink<SilKitMessageT>>
@@ -309,15 +380,55 @@ private:
         return link;
     }
 
-    template <class SilKitMessageT, class SilKitServiceT>
-    void RegisterSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver)
+    auto GetNetworkIndex(const std::string& networkName) -> uint32_t;
+
+    template <class SilKitServiceT>
+    void AssignNetworkIndex(SilKitServiceT* service)
+    {
+        // the service is not in use yet, so its descriptor can be updated from the calling thread
+        auto& serviceEndpoint = dynamic_cast<IServiceEndpoint&>(*service);
+        auto serviceDescriptor = serviceEndpoint.GetServiceDescriptor();
+        serviceDescriptor.SetNetworkIndex(GetNetworkIndex(serviceDescriptor.GetNetworkName()));
+        serviceEndpoint.SetServiceDescriptor(serviceDescriptor);
+    }
+
+    template <class SilKitMessageT>
+    auto GetSenderLink(const ServiceDescriptor& serviceDescriptor) -> SilKitLink<SilKitMessageT>*
+    {
+        const auto& senderLinks = std::get<SilKitSenderLinks<SilKitMessageT>>(_senderLinks);
+
+        const auto networkIndex = serviceDescriptor.GetNetworkIndex();
+        if (networkIndex != 0 && networkIndex < senderLinks.size() && senderLinks[networkIndex] != nullptr)
+        {
+            return senderLinks[networkIndex].get();
+        }
+
+        // endpoints which have not been registered with this connection are looked up by their network name
+        const auto& linkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        const auto it = linkMap.find(serviceDescriptor.GetNetworkName());
+        return it != linkMap.end() ? it->second.get() : nullptr;
+    }
+
+    template <class SilKitMessageT>
+    void RegisterSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver, RegistrationMode registrationMode)
     {
         SILKIT_ASSERT(_logger);
         auto&& serviceDescriptor = GetServiceDescriptor(receiver);
         auto&& networkName = serviceDescriptor.GetNetworkName();
 
         auto link = GetLinkByName<SilKitMessageT>(networkName);
-        link->AddLocalReceiver(receiver);
+        // without I/O worker threads, only the I/O thread delivers received messages, no locking is required
+        std::mutex* dispatchMutex{nullptr};
+        if (_config.middleware.ioWorkerThreads > 0)
+        {
+            auto& serviceDispatchMutex = _serviceDispatchMutexes[dynamic_cast<const IServiceEndpoint*>(receiver)];
+            if (serviceDispatchMutex == nullptr)
+            {
+                serviceDispatchMutex = std::make_unique<std::mutex>();
+            }
+            dispatchMutex = serviceDispatchMutex.get();
+        }
+        link->AddLocalReceiver(receiver, dispatchMutex);
 
         std::string msgSerdesName = SilKitMsgTraits<SilKitMessageT>::SerdesName();
         const std::string uniqueReceiverId = networkName + "/" + msgSerdesName;
@@ -347,48 +458,58 @@ private:
                 {
                     // Add pending subscriptions
                     PendingAcksIdentifier ackPair{peer.get(), subscriptionInfo};
-                    if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+                    if (registrationMode == RegistrationMode::Synchronous)
                     {
-                        _pendingSubscriptionAcknowledges.emplace_back(ackPair);
+                        _pendingSubscriptionAcknowledges.emplace(ackPair);
                     }
                     else
                     {
-                        _pendingAsyncSubscriptionAcknowledges.emplace_back(ackPair);
+                        _pendingAsyncSubscriptionAcknowledges.emplace(ackPair);
                     }
 
-                    peer->Subscribe(subscriptionInfo);
+                    QueueSubscription(peer.get(), subscriptionInfo, registrationMode);
                 }
             }
         }
     }
 
     template <class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const ServiceDescriptor& serviceDescriptor)
     {
+        const auto& networkName = serviceDescriptor.GetNetworkName();
+
         auto link = GetLinkByName<SilKitMessageT>(networkName);
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        auto&& senderLinks = std::get<SilKitSenderLinks<SilKitMessageT>>(_senderLinks);
+        const auto networkIndex = serviceDescriptor.GetNetworkIndex();
+        if (networkIndex >= senderLinks.size())
+        {
+            senderLinks.resize(networkIndex + 1);
+        }
+        senderLinks[networkIndex] = std::move(link);
     }
 
     template <class SilKitServiceT>
-    inline void RegisterSilKitServiceImpl(SilKitServiceT* service)
+    inline void RegisterSilKitServiceImpl(SilKitServiceT* service, RegistrationMode registrationMode)
     {
         typename SilKitServiceT::SilKitReceiveMessagesTypes receiveMessageTypes{};
         typename SilKitServiceT::SilKitSendMessagesTypes sendMessageTypes{};
 
-        Util::tuple_tools::for_each(receiveMessageTypes, [this, service](auto&& message) {
+        Util::tuple_tools::for_each(receiveMessageTypes, [this, service, registrationMode](auto&& message) {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgReceiver<SilKitMessageT, SilKitServiceT>(service);
+            this->RegisterSilKitMsgReceiver<SilKitMessageT>(service, registrationMode);
         });
 
         Util::tuple_tools::for_each(sendMessageTypes, [this, service](auto&& message) {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service));
         });
 
         // We could have registered a receiver that only uses already acknowledged senders, thus no new handshake is
         // triggered. In that case, the pending acks might be already empty and the subscription is completed.
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (registrationMode == RegistrationMode::Synchronous)
         {
             if (_pendingSubscriptionAcknowledges.empty())
             {
@@ -407,32 +528,58 @@ private:
     template <class SilKitMessageT>
     void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from->GetServiceDescriptor());
+        if (link == nullptr)
         {
-            throw SilKitError{"SendMsgImpl: sending on empty link for " + key};
+            throw SilKitError{"SendMsgImpl: sending on empty link for "
+                              + from->GetServiceDescriptor().GetNetworkName()};
         }
-        auto&& link = linkMap[key];
         link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
     }
 
+    template <class SilKitMessageT>
+    void SendMsgsImpl(const IServiceEndpoint* from, const std::vector<SilKitMessageT>& msgs)
+    {
+        auto* link = GetSenderLink<SilKitMessageT>(from->GetServiceDescriptor());
+        if (link == nullptr)
+        {
+            throw SilKitError{"SendMsgsImpl: sending on empty link for "
+                              + from->GetServiceDescriptor().GetNetworkName()};
+        }
+        link->DistributeLocalSilKitMessages(from, msgs);
+    }
+
     template <class SilKitMessageT>
     void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
                              SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from->GetServiceDescriptor());
+        if (link == nullptr)
         {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
+            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for "
+                              + from->GetServiceDescriptor().GetNetworkName()};
         }
-        auto&& link = linkMap[key];
         link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
+    template <class SilKitMessageT>
+    void SendMsgToTargetsImpl(const std::vector<MessageTarget>& targets, const SilKitMessageT& msg)
+    {
+        if (targets.empty())
+        {
+            return;
+        }
+
+        // All targets are sent from endpoints of the same network
+        auto* link = GetSenderLink<SilKitMessageT>(targets.front().from->GetServiceDescriptor());
+        if (link == nullptr)
+        {
+            throw SilKitError{"SendMsgToTargetsImpl: sending on empty link for "
+                              + targets.front().from->GetServiceDescriptor().GetNetworkName()};
+        }
+        link->DispatchSilKitMessageToTargets(targets, msg);
+    }
+
     template <typename... MethodArgs, typename... Args>
     inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
     {
@@ -461,6 +608,7 @@ private: // IConnectionMethods
 
     void HandleConnectedPeer(IVAsioPeer* peer) override;
     void AddPeer(std::unique_ptr<IVAsioPeer> peer) override;
+    void RemoveProxyPeer(const VAsioPeerInfo& peerInfo) override;
 
     auto TryRemoteConnectRequest(const VAsioPeerInfo& peerInfo) -> bool override;
     auto TryProxyConnect(const VAsioPeerInfo& peerInfo) -> bool override;
@@ -496,8 +644,16 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Links of the registered senders by the network index of their service descriptor. I/O thread only.
+    Util::tuple_tools::wrapped_tuple<SilKitSenderLinks, SilKitMessageTypes> _senderLinks;
+    //! \brief Network indices by network name, see ServiceDescriptor::GetNetworkIndex. Guarded by _linksMx.
+    std::unordered_map<std::string, uint32_t> _networkIndices;
 
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! One mutex per receiving service, which serializes the delivery of received messages to the service across all
+    //! of its links and message types (see SilKitLink::AddLocalReceiver). Only used with I/O worker threads and only
+    //! accessed when registering services.
+    std::unordered_map<const IServiceEndpoint*, std::unique_ptr<std::mutex>> _serviceDispatchMutexes;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
     std::mutex _participantAnnouncementReceiversMutex;
@@ -534,23 +690,41 @@ private:
     mutable std::mutex _mutex;
 
     // Keep track of the sent Subscriptions when Registering an SIL Kit Service
-    std::vector<PendingAcksIdentifier> _pendingSubscriptionAcknowledges;
+    std::unordered_set<PendingAcksIdentifier, PendingAcksIdentifierHash> _pendingSubscriptionAcknowledges;
     std::promise<void> _receivedAllSubscriptionAcknowledges;
 
     // Subscriptions for internal services that use async registration
-    std::vector<PendingAcksIdentifier> _pendingAsyncSubscriptionAcknowledges;
+    std::unordered_set<PendingAcksIdentifier, PendingAcksIdentifierHash> _pendingAsyncSubscriptionAcknowledges;
+
+    // Subscriptions which are not yet sent to the peers, only accessed by the I/O worker thread
+    std::unordered_map<IVAsioPeer*, std::vector<VAsioMsgSubscriber>> _queuedSubscriptions;
+    bool _sendQueuedSubscriptionsPosted{false};
     Util::SynchronizedHandlers<std::function<void()>> _asyncSubscriptionsCompletionHandlers;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
+    std::atomic<bool> _deferServiceRegistrations{false};
 
     // The worker thread should be the last members in this class. This ensures
     // that no callback is destroyed before the thread finishes.
     std::thread _ioWorker;
 
+    // Optional pool which deserializes and dispatches received SIL Kit messages, with one strand per peer. The peer
+    // strands are only accessed by the I/O worker thread.
+    std::unique_ptr<IoWorkerPool> _ioWorkerPool;
+    std::unordered_map<IVAsioPeer*, std::shared_ptr<IoWorkerPool::Strand>> _peerStrands;
+
+    // The service descriptors of the senders of received SIL Kit messages, per peer and remote service id. They are
+    // created once, instead of copying the service descriptor of the peer for every received message. Only accessed
+    // by the I/O worker thread.
+    std::unordered_map<IVAsioPeer*, std::unordered_map<EndpointId, std::shared_ptr<const RemoteServiceEndpoint>>>
+        _remoteServiceEndpoints;
+
     //We violate the strict layering architecture, so that we can cleanly shutdown without false error messages.
     std::atomic_bool _isShuttingDown{false};
 
     // Hold mapping from simulationName to mapping from participantName to peer
     std::unordered_map<std::string, std::unordered_map<std::string, IVAsioPeer*>> _participantNameToPeer;
+    // Participants whose proxy peer was removed in favor of a direct connection, until the direct peer is associated
+    std::unordered_set<std::string> _replacedProxyPeerNames;
 
     // Hold mapping from proxy source to all proxy destinations (used by registry for shutdown information)
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_set<std::string>>>
@@ -70,6 +70,17 @@ struct SubscriptionAcknowledge
     VAsioMsgSubscriber subscriber;
 };
 
+//! Multiple subscriptions to a single peer, acknowledged by a single SubscriptionAcknowledgeBatch
+struct SubscriptionAnnouncementBatch
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+};
+
+struct SubscriptionAcknowledgeBatch
+{
+    std::vector<SubscriptionAcknowledge> acknowledges;
+};
+
 struct ParticipantAnnouncement
 {
     RegistryMsgHeader messageHeader;
@@ -147,6 +158,13 @@ struct ProxyMessage
     std::vector<uint8_t> payload;
 };
 
+//! The source and destination of a ProxyMessage, which precede the payload in the wire format
+struct ProxyMessageRouting
+{
+    std::string source;
+    std::string destination;
+};
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -34,6 +34,10 @@ enum class VAsioMsgKind : uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SubscriptionAnnouncementBatch = 7, // with "subscription-batch" capability
+    SubscriptionAcknowledgeBatch = 8, // with "subscription-batch" capability
+    SilKitMessageChunk = 9, // with "message-chunks" capability, reassembled by VAsioPeer
+    LogMsgBatch = 10, // with "log-msg-batch" capability, several LogMsgs of the same sender
 };
 
 } // namespace Core
@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -28,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
 #include "VAsioConnection.hpp"
+#include "VAsioCapabilities.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
 
@@ -44,15 +47,43 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 using namespace std::chrono_literals;
 
 
+namespace {
+
+// Each queued message occupies up to two buffers (network headers and shared body). Keep the buffer sequence of a
+// single write operation well below the typical scatter/gather limits of the operating systems.
+constexpr size_t MAX_SEND_BATCH_MESSAGES{32};
+
+// Received messages are handed out as views into the receive buffer. A new receive buffer is only allocated if the
+// current one is still referenced by received messages, or if it is too small for the next message.
+constexpr size_t RECEIVE_BUFFER_SIZE{64 * 1024};
+// Move the trailing incomplete message to the front of the receive buffer if less space is left for the next read.
+constexpr size_t MIN_RECEIVE_SIZE{4096};
+// Upper limit of the size of a single message, messages received in chunks are only limited by their uint32 size
+constexpr uint32_t MAX_RECEIVE_MESSAGE_SIZE{1024 * 1024 * 1024};
+// Size of the headers preceding each chunk: [uint32 chunk size][VAsioMsgKind][uint32 size of the complete message]
+constexpr size_t CHUNK_HEADER_SIZE{2 * sizeof(uint32_t) + sizeof(uint8_t)};
+
+static_assert(SilKit::Core::MAX_MESSAGE_CHUNK_SIZE + CHUNK_HEADER_SIZE == MAX_RECEIVE_MESSAGE_SIZE,
+              "the frames of the largest chunks must be accepted by the receiving peer");
+
+auto GetStorageSize(const SilKit::Core::SerializedMessageStorage& storage) -> size_t
+{
+    return storage.data.size() + (storage.sharedBody == nullptr ? size_t{0} : storage.sharedBody->size());
+}
+
+} // namespace
+
+
 namespace SilKit {
 namespace Core {
 
 VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-                     Services::Logging::ILogger* logger)
+                     Services::Logging::ILogger* logger, const VAsioPeerSettings& settings)
     : _listener{listener}
     , _ioContext{ioContext}
     , _socket{std::move(stream)}
     , _logger{logger}
+    , _settings{settings}
 {
     _socket->SetListener(*this);
 }
@@ -84,6 +115,7 @@ auto VAsioPeer::GetInfo() const -> const VAsioPeerInfo&
 void VAsioPeer::SetInfo(VAsioPeerInfo peerInfo)
 {
     _info = std::move(peerInfo);
+    _remoteSupportsMessageChunks = VAsioCapabilities{_info.capabilities}.HasCapability(Capabilities::MessageChunks);
 }
 
 
@@ -115,7 +147,7 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
     {
         std::unique_lock<std::mutex> lock{_sendingQueueMutex};
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        _sendingQueue.push_back(buffer.ReleaseStorageWithSharedBody());
 
         lock.unlock();
 
@@ -125,28 +157,123 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
 
 void VAsioPeer::StartAsyncWrite()
 {
-    if (_sending)
+    if (_sending || _isShuttingDown)
         return;
 
     std::unique_lock<std::mutex> lock{_sendingQueueMutex};
-    if (_sendingQueue.empty())
+
+    // the chunked message is released after its last chunk has been written
+    if (_hasChunkedSendMessage && _chunkedSendOffset == GetStorageSize(_chunkedSendMessage))
+    {
+        _chunkedSendMessage = SerializedMessageStorage{};
+        _hasChunkedSendMessage = false;
+    }
+    if (!_hasChunkedSendMessage && !_sendingQueue.empty() && IsChunkingRequired(_sendingQueue.front()))
+    {
+        _chunkedSendMessage = std::move(_sendingQueue.front());
+        _sendingQueue.pop_front();
+        _chunkedSendOffset = 0;
+        _hasChunkedSendMessage = true;
+    }
+
+    if (_sendingQueue.empty() && !_hasChunkedSendMessage)
     {
         return;
     }
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
+    // Move as many queued messages as allowed into the current batch, which is written using a single gather write.
+    // The first message is always taken, even if it exceeds the batch size limit on its own. While a large message is
+    // sent in chunks, only the messages which may overtake it are taken, and the batch is completed by its next chunk.
+    _currentSendingBufferData.clear();
+    size_t batchSize{0};
+    while (!_sendingQueue.empty() && _currentSendingBufferData.size() < MAX_SEND_BATCH_MESSAGES)
+    {
+        const auto& storage = _sendingQueue.front();
+        if (_hasChunkedSendMessage ? !MayOvertakeChunkedMessage(storage) : IsChunkingRequired(storage))
+        {
+            break;
+        }
+        if (!_currentSendingBufferData.empty() && batchSize + GetStorageSize(storage) > _settings.maxSendBatchSize)
+        {
+            break;
+        }
+
+        batchSize += GetStorageSize(storage);
+        _currentSendingBufferData.emplace_back(std::move(_sendingQueue.front()));
+        _sendingQueue.pop_front();
+    }
     lock.unlock();
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
+    // the shared body of a sim message is written directly after its network headers
+    _currentSendingBuffers.clear();
+    for (const auto& storage : _currentSendingBufferData)
+    {
+        _currentSendingBuffers.emplace_back(storage.data.data(), storage.data.size());
+        if (storage.sharedBody != nullptr)
+        {
+            _currentSendingBuffers.emplace_back(storage.sharedBody->data(), storage.sharedBody->size());
+        }
+    }
+
+    if (_hasChunkedSendMessage)
+    {
+        AddNextChunkToSendingBuffers();
+    }
+
     WriteSomeAsync();
 }
 
+auto VAsioPeer::IsChunkingRequired(const SerializedMessageStorage& storage) const -> bool
+{
+    return _settings.messageChunkSize > 0 && _remoteSupportsMessageChunks
+           && GetStorageSize(storage) > _settings.messageChunkSize;
+}
+
+auto VAsioPeer::MayOvertakeChunkedMessage(const SerializedMessageStorage& storage) const -> bool
+{
+    // messages of the same link must arrive in order, and messages relevant to the synchronization must never arrive
+    // before the messages sent ahead of them
+    return storage.mayOvertakeChunkedMessages && _chunkedSendMessage.mayOvertakeChunkedMessages
+           && storage.remoteIndex != _chunkedSendMessage.remoteIndex && !IsChunkingRequired(storage);
+}
+
+void VAsioPeer::AddNextChunkToSendingBuffers()
+{
+    const auto messageSize = GetStorageSize(_chunkedSendMessage);
+    const auto chunkSize = std::min(_settings.messageChunkSize, messageSize - _chunkedSendOffset);
+
+    const auto frameSize = static_cast<uint32_t>(CHUNK_HEADER_SIZE + chunkSize);
+    const auto messageKind = static_cast<uint8_t>(VAsioMsgKind::SilKitMessageChunk);
+    const auto totalSize = static_cast<uint32_t>(messageSize);
+    memcpy(_chunkHeader.data(), &frameSize, sizeof(frameSize));
+    memcpy(_chunkHeader.data() + sizeof(frameSize), &messageKind, sizeof(messageKind));
+    memcpy(_chunkHeader.data() + sizeof(frameSize) + sizeof(messageKind), &totalSize, sizeof(totalSize));
+    _currentSendingBuffers.emplace_back(_chunkHeader.data(), _chunkHeader.size());
+
+    // the chunk may span the network headers and the shared body of the message
+    const auto& data = _chunkedSendMessage.data;
+    auto offset = _chunkedSendOffset;
+    auto remaining = chunkSize;
+    if (offset < data.size())
+    {
+        const auto size = std::min(remaining, data.size() - offset);
+        _currentSendingBuffers.emplace_back(data.data() + offset, size);
+        offset += size;
+        remaining -= size;
+    }
+    if (remaining > 0)
+    {
+        _currentSendingBuffers.emplace_back(_chunkedSendMessage.sharedBody->data() + (offset - data.size()), remaining);
+    }
+
+    _chunkedSendOffset += chunkSize;
+}
+
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data(), _currentSendingBuffers.size()});
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -161,7 +288,8 @@ void VAsioPeer::StartAsyncRead()
 {
     _currentMsgSize = 0u;
 
-    _msgBuffer.resize(4096);
+    _receiveBuffer = std::make_shared<std::vector<uint8_t>>(RECEIVE_BUFFER_SIZE);
+    _rPos = {0u};
     _wPos = {0u};
 
     ReadSomeAsync();
@@ -169,79 +297,175 @@ void VAsioPeer::StartAsyncRead()
 
 void VAsioPeer::ReadSomeAsync()
 {
-    SILKIT_ASSERT(_msgBuffer.size() > 0);
-    auto* wPtr = _msgBuffer.data() + _wPos;
-    auto size = _msgBuffer.size() - _wPos;
+    PrepareReceiveBuffer();
+
+    SILKIT_ASSERT(_receiveBuffer->size() > _wPos);
+    auto* wPtr = _receiveBuffer->data() + _wPos;
+    auto size = _receiveBuffer->size() - _wPos;
 
     _currentReceivingBuffer = MutableBuffer{wPtr, size};
 
     _socket->AsyncReadSome(MutableBufferSequence{&_currentReceivingBuffer, 1});
 }
 
+void VAsioPeer::PrepareReceiveBuffer()
+{
+    const auto pendingSize = _wPos - _rPos;
+    // the incomplete message must fit into the buffer, and we want to read a reasonable amount of data at once
+    const auto requiredSize = std::max<size_t>(_currentMsgSize, pendingSize + MIN_RECEIVE_SIZE);
+
+    if (_rPos + requiredSize <= _receiveBuffer->size())
+    {
+        return;
+    }
+
+    const auto bufferSize = std::max(RECEIVE_BUFFER_SIZE, requiredSize);
+
+    // the buffer can only be reused if no received message refers to it anymore, and should not stay oversized
+    const auto isReusable = _receiveBuffer.use_count() == 1
+                            && (_receiveBuffer->size() == bufferSize
+                                || (_receiveBuffer->size() > bufferSize && bufferSize != RECEIVE_BUFFER_SIZE));
+
+    if (isReusable)
+    {
+        std::memmove(_receiveBuffer->data(), _receiveBuffer->data() + _rPos, pendingSize);
+    }
+    else
+    {
+        auto newBuffer = std::make_shared<std::vector<uint8_t>>(bufferSize);
+        std::memcpy(newBuffer->data(), _receiveBuffer->data() + _rPos, pendingSize);
+        _receiveBuffer = std::move(newBuffer);
+    }
+
+    _rPos = 0u;
+    _wPos = pendingSize;
+}
+
 void VAsioPeer::DispatchBuffer()
 {
-    if (_currentMsgSize == 0)
+    for (;;)
     {
-        if (_isShuttingDown)
+        const auto pendingSize = _wPos - _rPos;
+
+        if (_currentMsgSize == 0)
         {
+            if (_isShuttingDown)
+            {
+                return;
+            }
+            if (pendingSize < sizeof(uint32_t))
+            {
+                // not enough data to even determine the message size
+                break;
+            }
+
+            uint32_t msgSize{0u};
+            memcpy(&msgSize, _receiveBuffer->data() + _rPos, sizeof msgSize);
+            _currentMsgSize = msgSize;
+        }
+
+        // validate the received size, it includes the message size header itself
+        if (_currentMsgSize < sizeof(uint32_t) || _currentMsgSize > MAX_RECEIVE_MESSAGE_SIZE)
+        {
+            SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
+            Shutdown();
             return;
         }
-        if (_wPos >= sizeof(uint32_t))
+
+        if (pendingSize < _currentMsgSize)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            // wait until we have more data
+            break;
         }
-        else
+
+        const auto msgOffset = _rPos;
+        const auto msgSize = _currentMsgSize.load();
+        _rPos += msgSize;
+        _currentMsgSize = 0u;
+
+        const auto kindOffset = msgOffset + sizeof(uint32_t);
+        if (msgSize > sizeof(uint32_t)
+            && static_cast<VAsioMsgKind>((*_receiveBuffer)[kindOffset]) == VAsioMsgKind::SilKitMessageChunk)
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096);
-            // and restart the async read operation
-            ReadSomeAsync();
-            return;
+            if (!ReceiveChunk(msgOffset, msgSize))
+            {
+                return;
+            }
+            continue;
         }
+
+        // the message refers to the receive buffer, which is kept alive as long as the message is in use
+        SerializedMessage message{_receiveBuffer, msgOffset, msgSize};
+        message.SetProtocolVersion(GetProtocolVersion());
+
+        _listener->OnSocketData(this, std::move(message));
     }
 
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
+    ReadSomeAsync();
+}
+
+auto VAsioPeer::ReceiveChunk(size_t offset, size_t size) -> bool
+{
+    if (size < CHUNK_HEADER_SIZE)
     {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
+        SilKit::Services::Logging::Error(_logger, "Received invalid message chunk of size {}", size);
         Shutdown();
+        return false;
     }
 
+    uint32_t messageSize{0u};
+    memcpy(&messageSize, _receiveBuffer->data() + offset + CHUNK_HEADER_SIZE - sizeof(uint32_t), sizeof messageSize);
+    const auto* chunkData = _receiveBuffer->data() + offset + CHUNK_HEADER_SIZE;
+    const auto chunkSize = size - CHUNK_HEADER_SIZE;
 
-    if (_wPos < _currentMsgSize)
+    const auto isFirstChunk = _chunkedReceiveBuffer == nullptr;
+    const auto receivedSize = isFirstChunk ? size_t{0} : _chunkedReceiveBuffer->size();
+    if (messageSize < sizeof(uint32_t) || (!isFirstChunk && messageSize != _chunkedReceiveSize)
+        || receivedSize + chunkSize > messageSize)
     {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
-        return;
+        SilKit::Services::Logging::Error(_logger, "Received invalid message chunk for a message of size {}",
+                                         messageSize);
+        Shutdown();
+        return false;
     }
-    else
+
+    if (isFirstChunk)
     {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
+        _chunkedReceiveBuffer = std::make_shared<std::vector<uint8_t>>();
+        _chunkedReceiveSize = messageSize;
+    }
 
-        // manually extract the message size so we can adjust the MessageBuffer size
-        uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
-        {
-            throw SilKitError{"DispatchBuffer: Received message is too small to contain message size header"};
-        }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
-        message.SetProtocolVersion(GetProtocolVersion());
-        _listener->OnSocketData(this, std::move(message));
+    // NB: The buffer grows with the received chunks and the announced size only caps its capacity, otherwise a single
+    //     small chunk announcing a message of up to 4 GiB would allocate all of it up front.
+    auto& buffer = *_chunkedReceiveBuffer;
+    const auto requiredCapacity = buffer.size() + chunkSize;
+    if (requiredCapacity > buffer.capacity())
+    {
+        buffer.reserve(std::min<size_t>(messageSize, std::max(requiredCapacity, 2 * buffer.capacity())));
+    }
+    buffer.insert(buffer.end(), chunkData, chunkData + chunkSize);
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+    if (_chunkedReceiveBuffer->size() < messageSize)
+    {
+        return true;
+    }
 
-        DispatchBuffer();
+    // the reassembled message starts with its own size, just like a message received in one piece
+    uint32_t reassembledSize{0u};
+    memcpy(&reassembledSize, _chunkedReceiveBuffer->data(), sizeof reassembledSize);
+    if (reassembledSize != messageSize)
+    {
+        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", reassembledSize);
+        Shutdown();
+        return false;
     }
+
+    SerializedMessage message{std::move(_chunkedReceiveBuffer), 0, messageSize};
+    message.SetProtocolVersion(GetProtocolVersion());
+    _chunkedReceiveBuffer = nullptr;
+
+    _listener->OnSocketData(this, std::move(message));
+    return true;
 }
 
 
@@ -263,9 +487,18 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred < _currentSendingBuffer.GetSize())
+    // drop the completely written buffers and slice off the written prefix of the first incomplete one
+    auto it = _currentSendingBuffers.begin();
+    while (it != _currentSendingBuffers.end() && bytesTransferred >= it->GetSize())
+    {
+        bytesTransferred -= it->GetSize();
+        ++it;
+    }
+    _currentSendingBuffers.erase(_currentSendingBuffers.begin(), it);
+
+    if (!_currentSendingBuffers.empty())
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
+        _currentSendingBuffers.front().SliceOff(bytesTransferred);
         WriteSomeAsync();
         return;
     }
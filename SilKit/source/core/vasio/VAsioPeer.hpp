@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <array>
+#include <memory>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -43,6 +45,19 @@ namespace SilKit {
 namespace Core {
 
 
+//! Largest chunk whose frame, i.e., the chunk and its 9 byte header, does not exceed the 1 GiB maximum message size.
+constexpr size_t MAX_MESSAGE_CHUNK_SIZE{1024 * 1024 * 1024 - 9};
+
+struct VAsioPeerSettings
+{
+    //! Queued messages are combined into a single write operation, until their total size would exceed this limit.
+    size_t maxSendBatchSize{64 * 1024};
+    //! Messages larger than this are sent in chunks of this size, if the remote peer supports it. 0 disables chunking.
+    //! Must not exceed MAX_MESSAGE_CHUNK_SIZE.
+    size_t messageChunkSize{0};
+};
+
+
 class VAsioPeer
     : public IVAsioPeer
     , private IRawByteStreamListener
@@ -62,7 +77,7 @@ public:
     VAsioPeer& operator=(VAsioPeer&& other) = delete; //implicitly deleted because of mutex
 
     VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-              Services::Logging::ILogger* logger);
+              Services::Logging::ILogger* logger, const VAsioPeerSettings& settings);
 
     ~VAsioPeer() override;
 
@@ -98,7 +113,13 @@ private:
     void StartAsyncWrite();
     void WriteSomeAsync();
     void ReadSomeAsync();
+    void PrepareReceiveBuffer();
     void DispatchBuffer();
+    auto IsChunkingRequired(const SerializedMessageStorage& storage) const -> bool;
+    auto MayOvertakeChunkedMessage(const SerializedMessageStorage& storage) const -> bool;
+    void AddNextChunkToSendingBuffers();
+    //! Append a received chunk to the reassembled message, returns false if the peer was shut down
+    auto ReceiveChunk(size_t offset, size_t size) -> bool;
 
 private: // IRawByteStreamListener
     void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
@@ -116,20 +137,32 @@ private:
     std::string _simulationName;
 
     Services::Logging::ILogger* _logger;
+    VAsioPeerSettings _settings;
 
     std::atomic_bool _isShuttingDown{false};
 
     // receiving
     std::atomic<uint32_t> _currentMsgSize{0u};
-    std::vector<uint8_t> _msgBuffer;
+    std::shared_ptr<std::vector<uint8_t>> _receiveBuffer;
+    size_t _rPos{0};
     size_t _wPos{0};
     MutableBuffer _currentReceivingBuffer;
+    // reassembly of a message received in chunks
+    std::shared_ptr<std::vector<uint8_t>> _chunkedReceiveBuffer;
+    uint32_t _chunkedReceiveSize{0u};
 
     // sending
     mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
+    std::deque<SerializedMessageStorage> _sendingQueue;
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    std::vector<SerializedMessageStorage> _currentSendingBufferData;
+    std::atomic_bool _remoteSupportsMessageChunks{false};
+    // the large message which is currently sent in chunks, see VAsioPeerSettings::messageChunkSize
+    SerializedMessageStorage _chunkedSendMessage;
+    bool _hasChunkedSendMessage{false};
+    size_t _chunkedSendOffset{0};
+    // [uint32 chunk size][VAsioMsgKind::SilKitMessageChunk][uint32 size of the complete message]
+    std::array<uint8_t, 2 * sizeof(uint32_t) + sizeof(uint8_t)> _chunkHeader{};
 
     std::atomic_bool _sending{false};
     Core::ServiceDescriptor _serviceDescriptor;
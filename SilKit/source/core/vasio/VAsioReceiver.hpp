@@ -44,9 +44,9 @@ struct RemoteServiceEndpoint : IServiceEndpoint
         return _serviceDescriptor;
     }
 
-    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
+    RemoteServiceEndpoint(ServiceDescriptor descriptor)
+        : _serviceDescriptor{std::move(descriptor)}
     {
-        _serviceDescriptor = descriptor;
     }
 
 private:
@@ -62,7 +62,8 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& remoteEndpoint,
+                               SerializedMessage&& buffer) = 0;
 };
 
 template <class MsgT>
@@ -80,7 +81,8 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& remoteEndpoint,
+                       SerializedMessage&& buffer) override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -119,15 +121,24 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor,
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const RemoteServiceEndpoint& remoteEndpoint,
                                         SerializedMessage&& buffer)
 {
+    if (buffer.GetMessageKind() == messageBatchKind<MsgT>())
+    {
+        // NB: The link does not move from the message, which is reused for the next message of the batch
+        buffer.DeserializeBatch<MsgT>([this, &remoteEndpoint](MsgT& msg) {
+            Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
+            _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
+        });
+        return;
+    }
+
     MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+    Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
 }
 
 } // namespace Core
@@ -81,6 +81,30 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledge&
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& batch)
+{
+    buffer << batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAnnouncementBatch& batch)
+{
+    buffer >> batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& batch)
+{
+    buffer << batch.acknowledges;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& batch)
+{
+    buffer >> batch.acknowledges;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const ParticipantAnnouncement& announcement)
 {
     // ParticipantAnnouncement is the first message sent during a handshake.
@@ -284,6 +308,16 @@ auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader
     return header;
 }
 
+auto PeekProxyMessageRouting(MessageBuffer& buffer) -> ProxyMessageRouting
+{
+    MessageBufferPeeker peeker{buffer};
+
+    ProxyMessageHeader header{};
+    ProxyMessageRouting routing{};
+    buffer >> header >> routing.source >> routing.destination;
+    return routing;
+}
+
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader
 {
     // NB: At the moment using the MessageBufferPeeker here -although correct- leads to an issue in the
@@ -356,6 +390,24 @@ void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledge& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAnnouncementBatch& out)
+{
+    buffer >> out;
+}
+
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& out)
+{
+    buffer >> out;
+}
+
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg)
 {
     buffer << msg;
@@ -42,6 +42,8 @@ auto ExtractRegistryMessageKind(MessageBuffer& buffer) -> RegistryMessageKind;
 
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader;
 auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader;
+//! Read the source and destination of a ProxyMessage without deserializing the payload
+auto PeekProxyMessageRouting(MessageBuffer& buffer) -> ProxyMessageRouting;
 
 auto ExtractEndpointId(MessageBuffer& buffer) -> EndpointId;
 auto ExtractEndpointAddress(MessageBuffer& buffer) -> EndpointAddress;
@@ -52,6 +54,8 @@ void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcemen
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
 void Serialize(MessageBuffer& buffer, const RemoteParticipantConnectRequest& msg);
@@ -60,6 +64,8 @@ void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer, ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, SubscriptionAnnouncementBatch&);
+void Deserialize(MessageBuffer&, SubscriptionAcknowledgeBatch&);
 void Deserialize(MessageBuffer& buffer, KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
 void Deserialize(MessageBuffer& buffer, RemoteParticipantConnectRequest& out);
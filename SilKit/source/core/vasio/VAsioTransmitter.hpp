@@ -22,15 +22,18 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <sstream>
+#include <unordered_map>
 
 #include "IVAsioPeer.hpp"
 #include <type_traits>
 
+#include "ILogger.hpp"
 #include "IMessageReceiver.hpp"
 #include "IServiceEndpoint.hpp"
 #include "traits/SilKitMsgTraits.hpp"
 
 #include "SerializedMessage.hpp"
+#include "VAsioCapabilities.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -87,6 +90,8 @@ struct RemoteReceiver
 {
     IVAsioPeer* peer;
     EndpointId remoteIdx;
+    //! The peer understands message batches of this message type, see messageBatchKind
+    bool acceptsMessageBatches{false};
 };
 
 template <class MsgT>
@@ -105,6 +110,12 @@ public:
         RemoteReceiver remoteReceiver;
         remoteReceiver.peer = peer;
         remoteReceiver.remoteIdx = remoteIdx;
+        // C++ 17 -> if constexpr
+        if (messageBatchKind<MsgT>() == VAsioMsgKind::LogMsgBatch)
+        {
+            remoteReceiver.acceptsMessageBatches =
+                VAsioCapabilities{peer->GetInfo().capabilities}.HasCapability(Capabilities::LogMsgBatch);
+        }
 
         if (_remoteReceivers.end() != std::find(_remoteReceivers.begin(), _remoteReceivers.end(), remoteReceiver))
             return;
@@ -112,6 +123,7 @@ public:
 
         _serviceDescriptor.SetParticipantNameAndComputeId(peer->GetInfo().participantName);
         _remoteReceivers.push_back(remoteReceiver);
+        _remoteReceiverIndices.emplace(peer->GetInfo().participantName, _remoteReceivers.size() - 1);
         _hist.NotifyPeer(peer, remoteIdx);
     }
 
@@ -125,6 +137,7 @@ public:
         if (it != _remoteReceivers.end())
         {
             _remoteReceivers.erase(it);
+            UpdateRemoteReceiverIndices();
         }
     }
 
@@ -146,19 +159,83 @@ public:
     void SendMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
     {
         _hist.Save(from, msg);
-        auto&& receiverIter =
-            std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [targetParticipantName](auto&& receiver) {
-            return receiver.peer->GetInfo().participantName == targetParticipantName;
-        });
-        if (receiverIter == _remoteReceivers.end())
+        auto&& receiver = GetRemoteReceiver(targetParticipantName);
+        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
+        receiver.peer->SendSilKitMsg(std::move(buffer));
+    }
+
+    //! Send a message to multiple remote participants, the message body is serialized only once.
+    //! Unknown targets are logged and skipped, the message is still sent to all other targets.
+    void SendMessageToTargets(const std::vector<MessageTarget>& targets, const MsgT& msg,
+                              Services::Logging::ILogger* logger)
+    {
+        SharedSerializedBody body;
+        for (const auto& target : targets)
         {
-            std::stringstream ss;
-            ss << "Error: Attempt to send targeted message to participant '" << targetParticipantName
-               << "', which is not a valid remote receiver.";
-            throw SilKitError{ss.str()};
+            // Targets on the participant itself are delivered by the link
+            if (target.from->GetServiceDescriptor().GetParticipantName() == target.participantName)
+            {
+                continue;
+            }
+
+            auto* receiver = FindRemoteReceiver(target.participantName);
+            if (receiver == nullptr)
+            {
+                Services::Logging::Warn(
+                    logger, "Dropping targeted message to participant '{}', which is not a valid remote receiver",
+                    target.participantName);
+                continue;
+            }
+
+            _hist.Save(target.from, msg);
+            if (body.data == nullptr)
+            {
+                body = MakeSharedSerializedBody(msg);
+            }
+            const auto endpointAddress = to_endpointAddress(target.from->GetServiceDescriptor());
+            receiver->peer->SendSilKitMsg(SerializedMessage(body, endpointAddress, receiver->remoteIdx));
+        }
+    }
+
+    //! Send several messages of the same sender. Peers which accept message batches receive all of them in a single
+    //! message, all other peers receive them one by one. Each message is serialized only once.
+    void SendMessageBatch(const IServiceEndpoint* from, const std::vector<MsgT>& msgs)
+    {
+        if (msgs.empty())
+        {
+            return;
+        }
+
+        _hist.Save(from, msgs.back());
+
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+        SharedSerializedBody batchBody;
+        std::vector<SharedSerializedBody> bodies;
+        for (auto& receiver : _remoteReceivers)
+        {
+            if (receiver.acceptsMessageBatches)
+            {
+                if (batchBody.data == nullptr)
+                {
+                    batchBody = MakeSharedSerializedBatch(msgs);
+                }
+                receiver.peer->SendSilKitMsg(SerializedMessage(batchBody, endpointAddress, receiver.remoteIdx));
+                continue;
+            }
+
+            if (bodies.empty())
+            {
+                bodies.reserve(msgs.size());
+                for (const auto& msg : msgs)
+                {
+                    bodies.emplace_back(MakeSharedSerializedBody(msg));
+                }
+            }
+            for (const auto& body : bodies)
+            {
+                receiver.peer->SendSilKitMsg(SerializedMessage(body, endpointAddress, receiver.remoteIdx));
+            }
         }
-        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiverIter->remoteIdx);
-        receiverIter->peer->SendSilKitMsg(std::move(buffer));
     }
 
     void SetHistoryLength(size_t historyLength)
@@ -172,10 +249,24 @@ public:
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+        if (_remoteReceivers.size() == 1 && GetSerializedBody(msg) == nullptr)
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
-            receiver.peer->SendSilKitMsg(std::move(buffer));
+            auto&& receiver = _remoteReceivers.front();
+            receiver.peer->SendSilKitMsg(SerializedMessage(msg, endpointAddress, receiver.remoteIdx));
+            return;
+        }
+
+        // Serialize the message body only once. Each receiver gets its own network headers, which are sent
+        // together with the shared body. Messages which carry their serialized body are not serialized at all.
+        if (!_remoteReceivers.empty())
+        {
+            const auto body = MakeSharedSerializedBody(msg);
+            for (auto& receiver : _remoteReceivers)
+            {
+                receiver.peer->SendSilKitMsg(SerializedMessage(body, endpointAddress, receiver.remoteIdx));
+            }
         }
     }
 
@@ -189,10 +280,47 @@ public:
         return _serviceDescriptor;
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+    auto GetRemoteReceiver(const std::string& targetParticipantName) -> RemoteReceiver&
+    {
+        auto* receiver = FindRemoteReceiver(targetParticipantName);
+        if (receiver == nullptr)
+        {
+            std::stringstream ss;
+            ss << "Error: Attempt to send targeted message to participant '" << targetParticipantName
+               << "', which is not a valid remote receiver.";
+            throw SilKitError{ss.str()};
+        }
+        return *receiver;
+    }
+
+    auto FindRemoteReceiver(const std::string& targetParticipantName) -> RemoteReceiver*
+    {
+        auto it = _remoteReceiverIndices.find(targetParticipantName);
+        if (it == _remoteReceiverIndices.end())
+        {
+            return nullptr;
+        }
+        return &_remoteReceivers[it->second];
+    }
+
+    void UpdateRemoteReceiverIndices()
+    {
+        _remoteReceiverIndices.clear();
+        for (size_t index = 0; index < _remoteReceivers.size(); ++index)
+        {
+            _remoteReceiverIndices.emplace(_remoteReceivers[index].peer->GetInfo().participantName, index);
+        }
+    }
+
 private:
     // ----------------------------------------
     // private members
     std::vector<RemoteReceiver> _remoteReceivers;
+    //! Index of the first remote receiver of each participant in _remoteReceivers
+    std::unordered_map<std::string, size_t> _remoteReceiverIndices;
     ServiceDescriptor _serviceDescriptor;
 };
 
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MakeSharedMemoryTransport.hpp"
+
+#include "impl/SharedMemoryAcceptor.hpp"
+#include "impl/SharedMemoryConnector.hpp"
+#include "impl/SharedMemorySegment.hpp"
+
+
+namespace VSilKit {
+
+
+auto IsSharedMemoryTransportSupported() -> bool
+{
+    return SharedMemorySegment::IsSupported();
+}
+
+
+auto MakeSharedMemoryAcceptorPath(const std::string& localPath) -> std::string
+{
+    return localPath + ".shm";
+}
+
+
+auto MakeSharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localAcceptor,
+                              SilKit::Services::Logging::ILogger* logger) -> std::unique_ptr<IAcceptor>
+{
+    return std::make_unique<SharedMemoryAcceptor>(ioContext, std::move(localAcceptor), logger);
+}
+
+
+auto MakeSharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localConnector,
+                               SilKit::Services::Logging::ILogger* logger) -> std::unique_ptr<IConnector>
+{
+    return std::make_unique<SharedMemoryConnector>(ioContext, std::move(localConnector), SHARED_MEMORY_RING_CAPACITY,
+                                                   logger);
+}
+
+
+} // namespace VSilKit
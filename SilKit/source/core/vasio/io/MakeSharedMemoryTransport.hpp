@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IIoContext.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+#include <string>
+
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+//! Capacity of each of the two rings of a shared-memory connection
+constexpr uint64_t SHARED_MEMORY_RING_CAPACITY{uint64_t{1} << 20};
+
+
+//! Returns true if the shared-memory transport is available on this platform.
+auto IsSharedMemoryTransportSupported() -> bool;
+
+//! Returns the path of the local-domain socket which accepts shared-memory connections on behalf of the local-domain
+//! acceptor listening on localPath. Both sides derive it, so it never has to be advertised.
+auto MakeSharedMemoryAcceptorPath(const std::string& localPath) -> std::string;
+
+//! Accepts connections on the given local-domain acceptor and transfers their data through shared memory.
+auto MakeSharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localAcceptor,
+                              SilKit::Services::Logging::ILogger* logger) -> std::unique_ptr<IAcceptor>;
+
+//! Connects via the given local-domain connector and transfers the data through shared memory.
+auto MakeSharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localConnector,
+                               SilKit::Services::Logging::ILogger* logger) -> std::unique_ptr<IConnector>;
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IsSharedMemoryTransportSupported;
+using VSilKit::MakeSharedMemoryAcceptorPath;
+using VSilKit::MakeSharedMemoryAcceptor;
+using VSilKit::MakeSharedMemoryConnector;
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,549 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+
+#include "MakeSharedMemoryTransport.hpp"
+
+#include "impl/SharedMemoryRing.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace VSilKit;
+
+
+// Executes posted functions on the calling thread, in the order they were posted
+struct TestIoContext final : IIoContext
+{
+    std::deque<std::function<void()>> functions;
+
+    void Run() override
+    {
+        while (!functions.empty())
+        {
+            auto function = std::move(functions.front());
+            functions.pop_front();
+            function();
+        }
+    }
+
+    void Post(std::function<void()> function) override
+    {
+        functions.emplace_back(std::move(function));
+    }
+
+    void Dispatch(std::function<void()> function) override
+    {
+        functions.emplace_back(std::move(function));
+    }
+
+    auto MakeTcpAcceptor(const std::string&, uint16_t) -> std::unique_ptr<IAcceptor> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    auto MakeLocalAcceptor(const std::string&) -> std::unique_ptr<IAcceptor> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    auto MakeTcpConnector(const std::string&, uint16_t) -> std::unique_ptr<IConnector> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    auto MakeLocalConnector(const std::string&) -> std::unique_ptr<IConnector> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    auto MakeTimer() -> std::unique_ptr<ITimer> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    auto Resolve(const std::string&) -> std::vector<std::string> override
+    {
+        throw std::logic_error{"not implemented"};
+    }
+
+    void SetLogger(SilKit::Services::Logging::ILogger&) override {}
+};
+
+
+// In-memory replacement of a connected pair of local-domain sockets
+struct LoopbackStream final : IRawByteStream
+{
+    TestIoContext* ioContext{nullptr};
+    LoopbackStream* peer{nullptr};
+    IRawByteStreamListener* listener{nullptr};
+
+    std::deque<uint8_t> received;
+    std::vector<MutableBuffer> readBuffers;
+    bool reading{false};
+    bool closed{false};
+    bool peerClosed{false};
+    bool shutdownPosted{false};
+
+    explicit LoopbackStream(TestIoContext& ioContext_)
+        : ioContext{&ioContext_}
+    {
+    }
+
+    static auto MakePair(TestIoContext& ioContext)
+        -> std::pair<std::unique_ptr<LoopbackStream>, std::unique_ptr<LoopbackStream>>
+    {
+        auto first = std::make_unique<LoopbackStream>(ioContext);
+        auto second = std::make_unique<LoopbackStream>(ioContext);
+        first->peer = second.get();
+        second->peer = first.get();
+        return {std::move(first), std::move(second)};
+    }
+
+    void SetListener(IRawByteStreamListener& listener_) override
+    {
+        listener = &listener_;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///tmp/loopback";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local://";
+    }
+
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+        reading = true;
+        ioContext->Post([this] { TryRead(); });
+    }
+
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        size_t size{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            if (!peerClosed)
+            {
+                peer->received.insert(peer->received.end(), data, data + buffer.GetSize());
+            }
+            size += buffer.GetSize();
+        }
+
+        ioContext->Post([this, size] { listener->OnAsyncWriteSomeDone(*this, size); });
+
+        if (!peerClosed)
+        {
+            ioContext->Post([peer = peer] { peer->TryRead(); });
+        }
+    }
+
+    void Shutdown() override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        closed = true;
+        reading = false;
+        PostShutdown();
+
+        if (!peerClosed)
+        {
+            peer->peerClosed = true;
+            ioContext->Post([peer = peer] { peer->TryRead(); });
+        }
+    }
+
+    void TryRead()
+    {
+        if (!reading)
+        {
+            return;
+        }
+
+        if (!received.empty())
+        {
+            size_t size{0};
+            for (auto& buffer : readBuffers)
+            {
+                auto* data = static_cast<uint8_t*>(buffer.GetData());
+                const auto count = std::min(buffer.GetSize(), received.size());
+                std::copy_n(received.begin(), count, data);
+                received.erase(received.begin(), received.begin() + static_cast<std::ptrdiff_t>(count));
+                size += count;
+            }
+
+            reading = false;
+            listener->OnAsyncReadSomeDone(*this, size);
+            return;
+        }
+
+        if (peerClosed)
+        {
+            closed = true;
+            reading = false;
+            PostShutdown();
+        }
+    }
+
+    void PostShutdown()
+    {
+        if (!shutdownPosted)
+        {
+            shutdownPosted = true;
+            ioContext->Post([this] { listener->OnShutdown(*this); });
+        }
+    }
+};
+
+
+struct LoopbackConnector final : IConnector
+{
+    IConnectorListener* listener{nullptr};
+    TestIoContext* ioContext{nullptr};
+    std::unique_ptr<IRawByteStream> stream;
+
+    void SetListener(IConnectorListener& listener_) override
+    {
+        listener = &listener_;
+    }
+
+    void AsyncConnect(std::chrono::milliseconds) override
+    {
+        ioContext->Post([this] { listener->OnAsyncConnectSuccess(*this, std::move(stream)); });
+    }
+
+    void Shutdown() override {}
+};
+
+
+struct LoopbackAcceptor final : IAcceptor
+{
+    IAcceptorListener* listener{nullptr};
+    TestIoContext* ioContext{nullptr};
+    std::deque<std::unique_ptr<IRawByteStream>> streams;
+    bool accepting{false};
+
+    void SetListener(IAcceptorListener& listener_) override
+    {
+        listener = &listener_;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///tmp/loopback";
+    }
+
+    void AsyncAccept(std::chrono::milliseconds) override
+    {
+        accepting = true;
+        ioContext->Post([this] { TryAccept(); });
+    }
+
+    void Shutdown() override {}
+
+    void TryAccept()
+    {
+        if (accepting && !streams.empty())
+        {
+            accepting = false;
+            auto stream = std::move(streams.front());
+            streams.pop_front();
+            listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+        }
+    }
+};
+
+
+struct StreamEndpoint
+    : IConnectorListener
+    , IAcceptorListener
+    , IRawByteStreamListener
+{
+    std::unique_ptr<IRawByteStream> stream;
+    bool connectFailed{false};
+    bool shutdown{false};
+
+    std::vector<uint8_t> sendData;
+    size_t sent{0};
+    ConstBuffer sendBuffer;
+
+    std::vector<uint8_t> receiveData;
+    std::vector<uint8_t> receiveBuffer = std::vector<uint8_t>(100000);
+    MutableBuffer receiveBufferSequence;
+
+    void Start()
+    {
+        stream->SetListener(*this);
+        ContinueReading();
+        ContinueWriting();
+    }
+
+    void ContinueReading()
+    {
+        receiveBufferSequence = MutableBuffer{receiveBuffer.data(), receiveBuffer.size()};
+        stream->AsyncReadSome(MutableBufferSequence{&receiveBufferSequence, 1});
+    }
+
+    void ContinueWriting()
+    {
+        if (sent == sendData.size())
+        {
+            return;
+        }
+
+        sendBuffer = ConstBuffer{sendData.data() + sent, sendData.size() - sent};
+        stream->AsyncWriteSome(ConstBufferSequence{&sendBuffer, 1});
+    }
+
+    void OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream_) override
+    {
+        stream = std::move(stream_);
+    }
+
+    void OnAsyncConnectFailure(IConnector&) override
+    {
+        connectFailed = true;
+    }
+
+    void OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream_) override
+    {
+        stream = std::move(stream_);
+    }
+
+    void OnAsyncAcceptFailure(IAcceptor&) override {}
+
+    void OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        receiveData.insert(receiveData.end(), receiveBuffer.begin(),
+                           receiveBuffer.begin() + static_cast<std::ptrdiff_t>(bytesTransferred));
+        ContinueReading();
+    }
+
+    void OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        sent += bytesTransferred;
+        ContinueWriting();
+    }
+
+    void OnShutdown(IRawByteStream&) override
+    {
+        shutdown = true;
+    }
+};
+
+
+auto MakePayload(size_t size, uint8_t seed) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), seed);
+    return data;
+}
+
+
+class Test_SharedMemoryTransport : public testing::Test
+{
+protected:
+    TestIoContext ioContext;
+    StreamEndpoint connecting;
+    StreamEndpoint accepting;
+
+    std::unique_ptr<IConnector> connector;
+    std::unique_ptr<IAcceptor> acceptor;
+
+    void Connect(std::unique_ptr<IRawByteStream> connectorStream, std::unique_ptr<IRawByteStream> acceptorStream)
+    {
+        auto localConnector = std::make_unique<LoopbackConnector>();
+        localConnector->ioContext = &ioContext;
+        localConnector->stream = std::move(connectorStream);
+
+        auto localAcceptor = std::make_unique<LoopbackAcceptor>();
+        localAcceptor->ioContext = &ioContext;
+        localAcceptor->streams.emplace_back(std::move(acceptorStream));
+
+        connector = MakeSharedMemoryConnector(ioContext, std::move(localConnector), nullptr);
+        connector->SetListener(connecting);
+        acceptor = MakeSharedMemoryAcceptor(ioContext, std::move(localAcceptor), nullptr);
+        acceptor->SetListener(accepting);
+
+        acceptor->AsyncAccept({});
+        connector->AsyncConnect({});
+        ioContext.Run();
+    }
+
+    void Connect()
+    {
+        auto pair = LoopbackStream::MakePair(ioContext);
+        Connect(std::move(pair.first), std::move(pair.second));
+
+        ASSERT_NE(connecting.stream, nullptr);
+        ASSERT_NE(accepting.stream, nullptr);
+    }
+};
+
+
+TEST(Test_SharedMemoryRing, data_wraps_around_the_end_of_the_ring)
+{
+    constexpr uint64_t capacity{4096};
+
+    SharedMemoryRingHeader header{};
+    std::vector<uint8_t> storage(capacity);
+    SharedMemoryRing ring{&header, storage.data(), capacity};
+
+    std::vector<uint8_t> received(3000);
+    MutableBuffer receiveBuffer{received.data(), received.size()};
+
+    for (uint8_t round = 0; round != 4; ++round)
+    {
+        const auto payload = MakePayload(3000, round);
+        ConstBuffer sendBuffer{payload.data(), payload.size()};
+
+        ASSERT_EQ(ring.Write(ConstBufferSequence{&sendBuffer, 1}), payload.size());
+        ASSERT_EQ(ring.Read(MutableBufferSequence{&receiveBuffer, 1}), payload.size());
+        ASSERT_EQ(received, payload);
+        ASSERT_TRUE(ring.IsEmpty());
+    }
+}
+
+TEST(Test_SharedMemoryRing, write_is_limited_by_the_free_space)
+{
+    constexpr uint64_t capacity{4096};
+
+    SharedMemoryRingHeader header{};
+    std::vector<uint8_t> storage(capacity);
+    SharedMemoryRing ring{&header, storage.data(), capacity};
+
+    const auto payload = MakePayload(3000, 0);
+    ConstBuffer sendBuffers[] = {{payload.data(), payload.size()}, {payload.data(), payload.size()}};
+
+    EXPECT_EQ(ring.Write(ConstBufferSequence{sendBuffers, 2}), capacity);
+    EXPECT_EQ(ring.Write(ConstBufferSequence{sendBuffers, 2}), 0u);
+
+    std::vector<uint8_t> received(100);
+    MutableBuffer receiveBuffer{received.data(), received.size()};
+    EXPECT_EQ(ring.Read(MutableBufferSequence{&receiveBuffer, 1}), received.size());
+    EXPECT_EQ(ring.Write(ConstBufferSequence{sendBuffers, 2}), received.size());
+}
+
+TEST(Test_SharedMemoryRing, waiting_flags_are_taken_once)
+{
+    SharedMemoryRingHeader header{};
+    std::vector<uint8_t> storage(4096);
+    SharedMemoryRing ring{&header, storage.data(), storage.size()};
+
+    EXPECT_FALSE(ring.TakeReaderWaiting());
+    ring.SetReaderWaiting();
+    EXPECT_TRUE(ring.TakeReaderWaiting());
+    EXPECT_FALSE(ring.TakeReaderWaiting());
+
+    EXPECT_FALSE(ring.TakeWriterWaiting());
+    ring.SetWriterWaiting();
+    EXPECT_TRUE(ring.TakeWriterWaiting());
+    EXPECT_FALSE(ring.TakeWriterWaiting());
+}
+
+TEST_F(Test_SharedMemoryTransport, transfers_more_data_than_the_ring_capacity_in_both_directions)
+{
+    if (!IsSharedMemoryTransportSupported())
+    {
+        return;
+    }
+
+    Connect();
+
+    EXPECT_EQ(connecting.stream->GetLocalEndpoint(), "shm:///tmp/loopback");
+    EXPECT_EQ(acceptor->GetLocalEndpoint(), "shm:///tmp/loopback");
+
+    connecting.sendData = MakePayload(5 * SHARED_MEMORY_RING_CAPACITY + 123, 1);
+    accepting.sendData = MakePayload(3 * SHARED_MEMORY_RING_CAPACITY + 45, 2);
+
+    connecting.Start();
+    accepting.Start();
+    ioContext.Run();
+
+    EXPECT_EQ(accepting.receiveData, connecting.sendData);
+    EXPECT_EQ(connecting.receiveData, accepting.sendData);
+}
+
+TEST_F(Test_SharedMemoryTransport, data_written_before_the_shutdown_is_delivered)
+{
+    if (!IsSharedMemoryTransportSupported())
+    {
+        return;
+    }
+
+    Connect();
+
+    connecting.sendData = MakePayload(1000, 3);
+    connecting.Start();
+    ioContext.Run();
+
+    // the accepting side starts reading after the connecting side shut down
+    connecting.stream->Shutdown();
+    ioContext.Run();
+    EXPECT_TRUE(connecting.shutdown);
+
+    accepting.Start();
+    ioContext.Run();
+
+    EXPECT_EQ(accepting.receiveData, connecting.sendData);
+    EXPECT_TRUE(accepting.shutdown);
+}
+
+TEST_F(Test_SharedMemoryTransport, connect_fails_if_the_acceptor_closes_the_connection)
+{
+    if (!IsSharedMemoryTransportSupported())
+    {
+        return;
+    }
+
+    auto pair = LoopbackStream::MakePair(ioContext);
+    // the accepting side is not part of the shared-memory transport and closes the connection right away
+    pair.second->SetListener(accepting);
+    pair.second->Shutdown();
+
+    auto localConnector = std::make_unique<LoopbackConnector>();
+    localConnector->ioContext = &ioContext;
+    localConnector->stream = std::move(pair.first);
+
+    connector = MakeSharedMemoryConnector(ioContext, std::move(localConnector), nullptr);
+    connector->SetListener(connecting);
+    connector->AsyncConnect({});
+    ioContext.Run();
+
+    EXPECT_TRUE(connecting.connectFailed);
+    EXPECT_EQ(connecting.stream, nullptr);
+}
+
+
+} // namespace
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryAcceptor.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <algorithm>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryAcceptor
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+namespace VSilKit {
+
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localAcceptor,
+                                           SilKit::Services::Logging::ILogger* logger)
+    : _ioContext{&ioContext}
+    , _localAcceptor{std::move(localAcceptor)}
+    , _logger{logger}
+{
+    _localAcceptor->SetListener(*this);
+}
+
+
+SharedMemoryAcceptor::~SharedMemoryAcceptor()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryAcceptor::SetListener(IAcceptorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+auto SharedMemoryAcceptor::GetLocalEndpoint() const -> std::string
+{
+    return MakeSharedMemoryEndpoint(_localAcceptor->GetLocalEndpoint());
+}
+
+
+void SharedMemoryAcceptor::AsyncAccept(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", timeout.count());
+
+    if (_acceptPending)
+    {
+        throw InvalidStateError{};
+    }
+
+    _acceptPending = true;
+    _timeout = timeout;
+
+    if (!_acceptedStreams.empty())
+    {
+        // never call the listener from within AsyncAccept
+        _ioContext->Post([this] { DeliverAcceptedStream(); });
+    }
+
+    if (!_accepting)
+    {
+        _accepting = true;
+        _localAcceptor->AsyncAccept(_timeout);
+    }
+}
+
+
+void SharedMemoryAcceptor::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _localAcceptor->Shutdown();
+
+    for (const auto& handshake : _handshakes)
+    {
+        handshake->Shutdown();
+    }
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    ISharedMemoryHandshakeListener& handshakeListener{*this};
+    _handshakes.emplace_back(std::make_unique<SharedMemoryHandshake>(
+        handshakeListener, *_ioContext, SharedMemoryRole::Acceptor, std::move(stream), nullptr, _logger));
+    _handshakes.back()->Start();
+
+    _localAcceptor->AsyncAccept(_timeout);
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptFailure(IAcceptor&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _accepting = false;
+
+    if (_acceptPending)
+    {
+        _acceptPending = false;
+        _listener->OnAsyncAcceptFailure(*this);
+    }
+}
+
+
+void SharedMemoryAcceptor::OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                                          std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    // the handshake is released when this function returns
+    auto releasedHandshake = ReleaseHandshake(handshake);
+
+    _acceptedStreams.emplace_back(std::move(stream));
+    DeliverAcceptedStream();
+}
+
+
+void SharedMemoryAcceptor::OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    Log::Debug(_logger, "SharedMemoryAcceptor: dropping connection after failed handshake");
+
+    auto releasedHandshake = ReleaseHandshake(handshake);
+}
+
+
+void SharedMemoryAcceptor::DeliverAcceptedStream()
+{
+    if (!_acceptPending || _acceptedStreams.empty())
+    {
+        return;
+    }
+
+    _acceptPending = false;
+
+    auto stream = std::move(_acceptedStreams.front());
+    _acceptedStreams.pop_front();
+
+    _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+}
+
+
+auto SharedMemoryAcceptor::ReleaseHandshake(SharedMemoryHandshake& handshake)
+    -> std::unique_ptr<SharedMemoryHandshake>
+{
+    auto it = std::find_if(_handshakes.begin(), _handshakes.end(),
+                           [needle = &handshake](const auto& hay) { return hay.get() == needle; });
+
+    if (it == _handshakes.end())
+    {
+        return nullptr;
+    }
+
+    auto released = std::move(*it);
+    _handshakes.erase(it);
+    return released;
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IAcceptor.hpp"
+#include "IIoContext.hpp"
+
+#include "SharedMemoryHandshake.hpp"
+
+#include "ILogger.hpp"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+//! Accepts connections on a local-domain acceptor and negotiates a shared-memory segment for each of them.
+//!
+//! The local-domain acceptor keeps accepting while handshakes are in progress, so a stalled peer cannot block other
+//! peers. Failed handshakes are dropped silently, the connecting side falls back to another acceptor.
+class SharedMemoryAcceptor final
+    : public IAcceptor
+    , private IAcceptorListener
+    , private ISharedMemoryHandshakeListener
+{
+    IAcceptorListener* _listener{nullptr};
+    IIoContext* _ioContext{nullptr};
+
+    std::unique_ptr<IAcceptor> _localAcceptor;
+    std::chrono::milliseconds _timeout{};
+    bool _accepting{false};
+    bool _acceptPending{false};
+
+    std::vector<std::unique_ptr<SharedMemoryHandshake>> _handshakes;
+    std::deque<std::unique_ptr<IRawByteStream>> _acceptedStreams;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    SharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localAcceptor,
+                         SilKit::Services::Logging::ILogger* logger);
+    ~SharedMemoryAcceptor() override;
+
+public: // IAcceptor
+    void SetListener(IAcceptorListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    void AsyncAccept(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IAcceptorListener
+    void OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncAcceptFailure(IAcceptor& acceptor) override;
+
+private: // ISharedMemoryHandshakeListener
+    void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                        std::unique_ptr<IRawByteStream> stream) override;
+    void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) override;
+
+private:
+    void DeliverAcceptedStream();
+    auto ReleaseHandshake(SharedMemoryHandshake& handshake) -> std::unique_ptr<SharedMemoryHandshake>;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryConnector.hpp"
+
+#include "SharedMemoryRing.hpp"
+
+#include "util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryConnector
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+namespace VSilKit {
+
+
+SharedMemoryConnector::SharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localConnector,
+                                             uint64_t ringCapacity, SilKit::Services::Logging::ILogger* logger)
+    : _ioContext{&ioContext}
+    , _localConnector{std::move(localConnector)}
+    , _ringCapacity{ringCapacity}
+    , _logger{logger}
+{
+    _localConnector->SetListener(*this);
+}
+
+
+SharedMemoryConnector::~SharedMemoryConnector()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryConnector::SetListener(IConnectorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+void SharedMemoryConnector::AsyncConnect(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", timeout.count());
+
+    _localConnector->AsyncConnect(timeout);
+}
+
+
+void SharedMemoryConnector::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _localConnector->Shutdown();
+
+    if (_handshake != nullptr)
+    {
+        _handshake->Shutdown();
+    }
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    try
+    {
+        auto segment = SharedMemorySegment::Create(GetSharedMemorySegmentSize(_ringCapacity));
+        InitializeSharedMemorySegment(*segment, _ringCapacity);
+
+        ISharedMemoryHandshakeListener& handshakeListener{*this};
+        _handshake = std::make_unique<SharedMemoryHandshake>(handshakeListener, *_ioContext,
+                                                             SharedMemoryRole::Connector, std::move(stream),
+                                                             std::move(segment), _logger);
+    }
+    catch (const std::exception& exception)
+    {
+        Log::Debug(_logger, "SharedMemoryConnector: unable to create the segment: {}", exception.what());
+        _listener->OnAsyncConnectFailure(*this);
+        return;
+    }
+
+    _handshake->Start();
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectFailure(IConnector&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+void SharedMemoryConnector::OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake&,
+                                                           std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    // the listener may destroy this object, the handshake is released when this function returns
+    auto handshake = std::move(_handshake);
+    _listener->OnAsyncConnectSuccess(*this, std::move(stream));
+}
+
+
+void SharedMemoryConnector::OnSharedMemoryHandshakeFailure(SharedMemoryHandshake&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    auto handshake = std::move(_handshake);
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IConnector.hpp"
+#include "IIoContext.hpp"
+
+#include "SharedMemoryHandshake.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+
+
+namespace VSilKit {
+
+
+//! Connects to a SharedMemoryAcceptor via a local-domain connector and negotiates a shared-memory segment.
+class SharedMemoryConnector final
+    : public IConnector
+    , private IConnectorListener
+    , private ISharedMemoryHandshakeListener
+{
+    IConnectorListener* _listener{nullptr};
+    IIoContext* _ioContext{nullptr};
+
+    std::unique_ptr<IConnector> _localConnector;
+    std::unique_ptr<SharedMemoryHandshake> _handshake;
+    uint64_t _ringCapacity{0};
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    SharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localConnector, uint64_t ringCapacity,
+                          SilKit::Services::Logging::ILogger* logger);
+    ~SharedMemoryConnector() override;
+
+public: // IConnector
+    void SetListener(IConnectorListener& listener) override;
+    void AsyncConnect(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IConnectorListener
+    void OnAsyncConnectSuccess(IConnector& connector, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncConnectFailure(IConnector& connector) override;
+
+private: // ISharedMemoryHandshakeListener
+    void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                        std::unique_ptr<IRawByteStream> stream) override;
+    void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) override;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryHandshake.hpp"
+
+#include "SharedMemoryRing.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <cstring>
+#include <string>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryHandshake
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+namespace VSilKit {
+
+
+namespace {
+
+constexpr size_t REQUEST_HEADER_SIZE{3 * sizeof(uint32_t)};
+constexpr size_t MAX_SEGMENT_NAME_SIZE{255};
+constexpr uint8_t RESPONSE_ACCEPTED{1};
+
+void PutUint32(std::vector<uint8_t>& data, uint32_t value)
+{
+    uint8_t bytes[sizeof(value)];
+    std::memcpy(bytes, &value, sizeof(value));
+    data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+auto GetUint32(const uint8_t* data) -> uint32_t
+{
+    uint32_t value{0};
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+
+SharedMemoryHandshake::SharedMemoryHandshake(ISharedMemoryHandshakeListener& listener, IIoContext& ioContext,
+                                             SharedMemoryRole role, std::unique_ptr<IRawByteStream> stream,
+                                             std::unique_ptr<SharedMemorySegment> segment,
+                                             SilKit::Services::Logging::ILogger* logger)
+    : _listener{&listener}
+    , _ioContext{&ioContext}
+    , _role{role}
+    , _state{role == SharedMemoryRole::Connector ? State::SendRequest : State::ReceiveRequestHeader}
+    , _stream{std::move(stream)}
+    , _segment{std::move(segment)}
+    , _logger{logger}
+{
+    _stream->SetListener(*this);
+}
+
+
+SharedMemoryHandshake::~SharedMemoryHandshake()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryHandshake::Start()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_role == SharedMemoryRole::Connector)
+    {
+        const auto& name = _segment->GetName();
+
+        std::vector<uint8_t> request;
+        PutUint32(request, SharedMemorySegmentHeader::MAGIC);
+        PutUint32(request, SharedMemorySegmentHeader::VERSION);
+        PutUint32(request, static_cast<uint32_t>(name.size()));
+        request.insert(request.end(), name.begin(), name.end());
+
+        Send(State::SendRequest, std::move(request));
+    }
+    else
+    {
+        Receive(State::ReceiveRequestHeader, REQUEST_HEADER_SIZE);
+    }
+}
+
+
+void SharedMemoryHandshake::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_state != State::Failed && _stream != nullptr)
+    {
+        HandleFailure("shutdown");
+    }
+}
+
+
+void SharedMemoryHandshake::OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    if (_state == State::Failed)
+    {
+        return;
+    }
+
+    _bufferPosition += bytesTransferred;
+
+    if (_bufferPosition < _buffer.size())
+    {
+        ContinueReceiving();
+        return;
+    }
+
+    HandleReceived();
+}
+
+
+void SharedMemoryHandshake::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    if (_state == State::Failed)
+    {
+        return;
+    }
+
+    _bufferPosition += bytesTransferred;
+
+    if (_bufferPosition < _buffer.size())
+    {
+        ContinueSending();
+        return;
+    }
+
+    HandleSent();
+}
+
+
+void SharedMemoryHandshake::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_state != State::Failed)
+    {
+        Log::Debug(_logger, "SharedMemoryHandshake: the peer closed the connection");
+    }
+
+    _state = State::Failed;
+    _listener->OnSharedMemoryHandshakeFailure(*this);
+}
+
+
+void SharedMemoryHandshake::Send(State state, std::vector<uint8_t> data)
+{
+    _state = state;
+    _buffer = std::move(data);
+    _bufferPosition = 0;
+
+    ContinueSending();
+}
+
+
+void SharedMemoryHandshake::Receive(State state, size_t size)
+{
+    _state = state;
+    _buffer.assign(size, 0);
+    _bufferPosition = 0;
+
+    ContinueReceiving();
+}
+
+
+void SharedMemoryHandshake::ContinueSending()
+{
+    _writeBuffer = ConstBuffer{_buffer.data() + _bufferPosition, _buffer.size() - _bufferPosition};
+    _stream->AsyncWriteSome(ConstBufferSequence{&_writeBuffer, 1});
+}
+
+
+void SharedMemoryHandshake::ContinueReceiving()
+{
+    // never read more than requested, the following bytes belong to the shared-memory stream
+    _readBuffer = MutableBuffer{_buffer.data() + _bufferPosition, _buffer.size() - _bufferPosition};
+    _stream->AsyncReadSome(MutableBufferSequence{&_readBuffer, 1});
+}
+
+
+void SharedMemoryHandshake::HandleReceived()
+{
+    switch (_state)
+    {
+    case State::ReceiveRequestHeader:
+    {
+        const auto magic = GetUint32(_buffer.data());
+        const auto version = GetUint32(_buffer.data() + sizeof(uint32_t));
+        const auto nameSize = GetUint32(_buffer.data() + 2 * sizeof(uint32_t));
+
+        if (magic != SharedMemorySegmentHeader::MAGIC || version != SharedMemorySegmentHeader::VERSION)
+        {
+            HandleFailure("invalid request");
+            return;
+        }
+
+        if (nameSize == 0 || nameSize > MAX_SEGMENT_NAME_SIZE)
+        {
+            HandleFailure("invalid segment name");
+            return;
+        }
+
+        Receive(State::ReceiveRequestName, nameSize);
+        return;
+    }
+
+    case State::ReceiveRequestName:
+    {
+        const std::string name{_buffer.begin(), _buffer.end()};
+
+        try
+        {
+            _segment = SharedMemorySegment::Open(name);
+            // the segment stays mapped in both processes, but must not outlive them
+            _segment->Unlink();
+            ValidateSharedMemorySegment(*_segment);
+        }
+        catch (const std::exception& exception)
+        {
+            Log::Debug(_logger, "SharedMemoryHandshake: {}", exception.what());
+            HandleFailure("unable to map the segment");
+            return;
+        }
+
+        Send(State::SendResponse, std::vector<uint8_t>{RESPONSE_ACCEPTED});
+        return;
+    }
+
+    case State::ReceiveResponse:
+        if (_buffer.front() != RESPONSE_ACCEPTED)
+        {
+            HandleFailure("rejected by the peer");
+            return;
+        }
+
+        _segment->Unlink();
+        HandleSuccess();
+        return;
+
+    default:
+        throw InvalidStateError{};
+    }
+}
+
+
+void SharedMemoryHandshake::HandleSent()
+{
+    switch (_state)
+    {
+    case State::SendRequest:
+        Receive(State::ReceiveResponse, 1);
+        return;
+
+    case State::SendResponse:
+        HandleSuccess();
+        return;
+
+    default:
+        throw InvalidStateError{};
+    }
+}
+
+
+void SharedMemoryHandshake::HandleSuccess()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_ptr<IRawByteStream> stream;
+
+    try
+    {
+        stream = std::make_unique<SharedMemoryRawByteStream>(*_ioContext, std::move(_segment), _role,
+                                                             std::move(_stream), _logger);
+    }
+    catch (const std::exception& exception)
+    {
+        Log::Debug(_logger, "SharedMemoryHandshake: {}", exception.what());
+
+        _state = State::Failed;
+        _listener->OnSharedMemoryHandshakeFailure(*this);
+        return;
+    }
+
+    // the listener may destroy this object
+    _listener->OnSharedMemoryHandshakeSuccess(*this, std::move(stream));
+}
+
+
+void SharedMemoryHandshake::HandleFailure(const char* reason)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", reason);
+
+    Log::Debug(_logger, "SharedMemoryHandshake: failed: {}", reason);
+
+    // the listener is informed after the stream was shut down
+    _state = State::Failed;
+    _stream->Shutdown();
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
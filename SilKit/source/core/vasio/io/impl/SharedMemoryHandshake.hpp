@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "IRawByteStream.hpp"
+
+#include "SharedMemoryRawByteStream.hpp"
+#include "SharedMemorySegment.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+struct ISharedMemoryHandshakeListener;
+
+
+//! Negotiates the shared-memory segment over a freshly established local-domain stream.
+//!
+//! The connecting side creates and initializes the segment and sends its name. The accepting side maps the segment,
+//! removes its name, and acknowledges with a single byte. Afterwards, both sides wrap the local-domain stream in a
+//! SharedMemoryRawByteStream.
+class SharedMemoryHandshake final : private IRawByteStreamListener
+{
+    enum class State
+    {
+        SendRequest,
+        ReceiveRequestHeader,
+        ReceiveRequestName,
+        SendResponse,
+        ReceiveResponse,
+        Failed,
+    };
+
+    ISharedMemoryHandshakeListener* _listener{nullptr};
+    IIoContext* _ioContext{nullptr};
+    SharedMemoryRole _role;
+    State _state;
+
+    std::unique_ptr<IRawByteStream> _stream;
+    std::unique_ptr<SharedMemorySegment> _segment;
+
+    std::vector<uint8_t> _buffer;
+    size_t _bufferPosition{0};
+    MutableBuffer _readBuffer;
+    ConstBuffer _writeBuffer;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    //! The connecting side passes the segment it created, the accepting side passes nullptr
+    SharedMemoryHandshake(ISharedMemoryHandshakeListener& listener, IIoContext& ioContext, SharedMemoryRole role,
+                          std::unique_ptr<IRawByteStream> stream, std::unique_ptr<SharedMemorySegment> segment,
+                          SilKit::Services::Logging::ILogger* logger);
+    ~SharedMemoryHandshake() override;
+
+    void Start();
+    void Shutdown();
+
+private: // IRawByteStreamListener
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private:
+    void Send(State state, std::vector<uint8_t> data);
+    void Receive(State state, size_t size);
+    void ContinueSending();
+    void ContinueReceiving();
+
+    void HandleReceived();
+    void HandleSent();
+    void HandleSuccess();
+    void HandleFailure(const char* reason);
+};
+
+
+struct ISharedMemoryHandshakeListener
+{
+    virtual ~ISharedMemoryHandshakeListener() = default;
+
+    //! The handshake object may be destroyed by the listener
+    virtual void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                                std::unique_ptr<IRawByteStream> stream) = 0;
+
+    //! The handshake object may be destroyed by the listener
+    virtual void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) = 0;
+};
+
+
+} // namespace VSilKit
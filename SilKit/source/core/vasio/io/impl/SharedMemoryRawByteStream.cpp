@@ -0,0 +1,385 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <new>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+namespace {
+
+auto GetHeader(const SharedMemorySegment& segment) -> SharedMemorySegmentHeader*
+{
+    return static_cast<SharedMemorySegmentHeader*>(segment.GetData());
+}
+
+auto MakeRing(const SharedMemorySegment& segment, size_t index) -> SharedMemoryRing
+{
+    auto* header = GetHeader(segment);
+    auto* data = static_cast<uint8_t*>(segment.GetData()) + GetSharedMemoryRingDataOffset()
+                 + index * static_cast<size_t>(header->ringCapacity);
+    return SharedMemoryRing{&header->rings[index], data, header->ringCapacity};
+}
+
+} // namespace
+
+
+void InitializeSharedMemorySegment(SharedMemorySegment& segment, uint64_t ringCapacity)
+{
+    if (!IsValidSharedMemoryRingCapacity(ringCapacity) || segment.GetSize() < GetSharedMemorySegmentSize(ringCapacity))
+    {
+        throw SharedMemoryError{"invalid ring capacity"};
+    }
+
+    auto* header = new (segment.GetData()) SharedMemorySegmentHeader{};
+    header->magic = SharedMemorySegmentHeader::MAGIC;
+    header->version = SharedMemorySegmentHeader::VERSION;
+    header->ringCapacity = ringCapacity;
+
+    for (auto& ring : header->rings)
+    {
+        ring.writePosition.store(0);
+        ring.readPosition.store(0);
+        ring.readerWaiting.store(0);
+        ring.writerWaiting.store(0);
+    }
+}
+
+
+void ValidateSharedMemorySegment(const SharedMemorySegment& segment)
+{
+    if (segment.GetSize() < GetSharedMemoryRingDataOffset())
+    {
+        throw SharedMemoryError{"segment is too small"};
+    }
+
+    const auto* header = GetHeader(segment);
+
+    if (header->magic != SharedMemorySegmentHeader::MAGIC || header->version != SharedMemorySegmentHeader::VERSION)
+    {
+        throw SharedMemoryError{"segment has an unknown format"};
+    }
+
+    if (!IsValidSharedMemoryRingCapacity(header->ringCapacity)
+        || segment.GetSize() < GetSharedMemorySegmentSize(header->ringCapacity))
+    {
+        throw SharedMemoryError{"segment has an invalid ring capacity"};
+    }
+}
+
+
+auto MakeSharedMemoryEndpoint(const std::string& localEndpoint) -> std::string
+{
+    static const std::string localPrefix{"local://"};
+
+    if (localEndpoint.compare(0, localPrefix.size(), localPrefix) == 0)
+    {
+        return "shm://" + localEndpoint.substr(localPrefix.size());
+    }
+
+    return localEndpoint;
+}
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(IIoContext& ioContext,
+                                                     std::unique_ptr<SharedMemorySegment> segment,
+                                                     SharedMemoryRole role,
+                                                     std::unique_ptr<IRawByteStream> notificationStream,
+                                                     SilKit::Services::Logging::ILogger* logger)
+    : _ioContext{&ioContext}
+    , _segment{std::move(segment)}
+    , _notificationStream{std::move(notificationStream)}
+    , _localEndpoint{MakeSharedMemoryEndpoint(_notificationStream->GetLocalEndpoint())}
+    , _remoteEndpoint{MakeSharedMemoryEndpoint(_notificationStream->GetRemoteEndpoint())}
+    , _notificationReadBufferSequence{_notificationReadBuffer.data(), _notificationReadBuffer.size()}
+    , _notificationWriteBufferSequence{&_notificationByte, 1}
+    , _logger{logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    ValidateSharedMemorySegment(*_segment);
+
+    const size_t sendIndex = role == SharedMemoryRole::Connector ? 0 : 1;
+    _sendRing = MakeRing(*_segment, sendIndex);
+    _receiveRing = MakeRing(*_segment, 1 - sendIndex);
+
+    _notificationStream->SetListener(*this);
+    _notificationStream->AsyncReadSome(MutableBufferSequence{&_notificationReadBufferSequence, 1});
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return _localEndpoint;
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return _remoteEndpoint;
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownPending)
+    {
+        return;
+    }
+
+    if (_reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    _reading = true;
+    _readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryCompleteRead();
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownPending)
+    {
+        return;
+    }
+
+    if (_writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    _writing = true;
+    _writeBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryCompleteWrite();
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    HandleShutdownOrError();
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream&, size_t)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownPending)
+    {
+        return;
+    }
+
+    // the content of the notification is irrelevant, the pending operations are simply retried
+    if (_reading)
+    {
+        TryCompleteRead();
+    }
+
+    if (_writing)
+    {
+        TryCompleteWrite();
+    }
+
+    if (!_shutdownPending)
+    {
+        _notificationStream->AsyncReadSome(MutableBufferSequence{&_notificationReadBufferSequence, 1});
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream&, size_t)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _notifying = false;
+
+    if (_notificationRequested && !_shutdownPending)
+    {
+        _notificationRequested = false;
+        Notify();
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(notification stream)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _notificationStreamClosed = true;
+
+    if (_shutdownPending)
+    {
+        HandleShutdownOrError();
+    }
+    else if (_reading)
+    {
+        // the data written by the peer before it closed the stream is still delivered
+        TryCompleteRead();
+    }
+    else if (_receiveRing.IsEmpty())
+    {
+        HandleShutdownOrError();
+    }
+}
+
+
+void SharedMemoryRawByteStream::TryCompleteRead()
+{
+    bool waiting{false};
+
+    while (true)
+    {
+        const auto bytesTransferred =
+            _receiveRing.Read(MutableBufferSequence{_readBufferSequence.data(), _readBufferSequence.size()});
+
+        if (bytesTransferred != 0 || _readBufferSequence.empty())
+        {
+            _reading = false;
+
+            if (_receiveRing.TakeWriterWaiting())
+            {
+                Notify();
+            }
+
+            _ioContext->Post([this, bytesTransferred] { _listener->OnAsyncReadSomeDone(*this, bytesTransferred); });
+            return;
+        }
+
+        if (_notificationStreamClosed)
+        {
+            _reading = false;
+            HandleShutdownOrError();
+            return;
+        }
+
+        if (waiting)
+        {
+            // the peer notifies us after it wrote more data
+            return;
+        }
+
+        _receiveRing.SetReaderWaiting();
+        waiting = true;
+    }
+}
+
+
+void SharedMemoryRawByteStream::TryCompleteWrite()
+{
+    bool waiting{false};
+
+    while (true)
+    {
+        const auto bytesTransferred =
+            _sendRing.Write(ConstBufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()});
+
+        if (bytesTransferred != 0 || _writeBufferSequence.empty())
+        {
+            _writing = false;
+
+            if (_sendRing.TakeReaderWaiting())
+            {
+                Notify();
+            }
+
+            _ioContext->Post([this, bytesTransferred] { _listener->OnAsyncWriteSomeDone(*this, bytesTransferred); });
+            return;
+        }
+
+        if (waiting)
+        {
+            // the peer notifies us after it read some data
+            return;
+        }
+
+        _sendRing.SetWriterWaiting();
+        waiting = true;
+    }
+}
+
+
+void SharedMemoryRawByteStream::Notify()
+{
+    if (_notifying)
+    {
+        _notificationRequested = true;
+        return;
+    }
+
+    _notifying = true;
+    _notificationStream->AsyncWriteSome(ConstBufferSequence{&_notificationWriteBufferSequence, 1});
+}
+
+
+void SharedMemoryRawByteStream::HandleShutdownOrError()
+{
+    SILKIT_TRACE_METHOD_(_logger, "() [shutdownPending={}, shutdownPosted={}, notificationStreamClosed={}]",
+                         _shutdownPending, _shutdownPosted, _notificationStreamClosed);
+
+    if (!_shutdownPending)
+    {
+        _shutdownPending = true;
+
+        // pending operations are abandoned, the listener is only informed about the shutdown
+        _reading = false;
+        _writing = false;
+
+        _notificationStream->Shutdown();
+    }
+
+    // the listener is informed after the notification stream stopped calling us
+    if (_notificationStreamClosed && !_shutdownPosted)
+    {
+        _shutdownPosted = true;
+        _ioContext->Post([this] { _listener->OnShutdown(*this); });
+    }
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
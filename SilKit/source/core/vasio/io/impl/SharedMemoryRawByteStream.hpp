@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "IRawByteStream.hpp"
+
+#include "SharedMemoryRing.hpp"
+#include "SharedMemorySegment.hpp"
+
+#include "ILogger.hpp"
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+enum class SharedMemoryRole
+{
+    Connector,
+    Acceptor,
+};
+
+
+//! Byte stream which transfers the data through a pair of rings in a shared-memory segment.
+//!
+//! The local-domain stream which was used to negotiate the segment stays open. A single byte is written to it to wake
+//! up the peer when it waits for data or free space. When either side closes it, the stream is shut down, which also
+//! detects peers which terminated unexpectedly.
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+{
+    IRawByteStreamListener* _listener{nullptr};
+    IIoContext* _ioContext{nullptr};
+
+    std::unique_ptr<SharedMemorySegment> _segment;
+    SharedMemoryRing _receiveRing;
+    SharedMemoryRing _sendRing;
+
+    std::unique_ptr<IRawByteStream> _notificationStream;
+    std::string _localEndpoint;
+    std::string _remoteEndpoint;
+
+    std::mutex _mutex;
+    bool _shutdownPending{false};
+    bool _shutdownPosted{false};
+    bool _notificationStreamClosed{false};
+    bool _reading{false};
+    bool _writing{false};
+    bool _notifying{false};
+    bool _notificationRequested{false};
+
+    std::vector<MutableBuffer> _readBufferSequence;
+    std::vector<ConstBuffer> _writeBufferSequence;
+
+    std::array<uint8_t, 64> _notificationReadBuffer{};
+    MutableBuffer _notificationReadBufferSequence;
+    uint8_t _notificationByte{0};
+    ConstBuffer _notificationWriteBufferSequence;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    //! The segment must have been validated and initialized by the connecting side
+    SharedMemoryRawByteStream(IIoContext& ioContext, std::unique_ptr<SharedMemorySegment> segment,
+                              SharedMemoryRole role, std::unique_ptr<IRawByteStream> notificationStream,
+                              SilKit::Services::Logging::ILogger* logger);
+    ~SharedMemoryRawByteStream() override;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+
+private: // IRawByteStreamListener (notification stream)
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private:
+    void TryCompleteRead();
+    void TryCompleteWrite();
+    void Notify();
+    void HandleShutdownOrError();
+};
+
+
+//! Writes the segment header and resets both rings. Called by the connecting side after creating the segment.
+void InitializeSharedMemorySegment(SharedMemorySegment& segment, uint64_t ringCapacity);
+
+//! Throws SharedMemoryError if the segment was not initialized by a compatible peer.
+void ValidateSharedMemorySegment(const SharedMemorySegment& segment);
+
+//! Turns local://path endpoints into shm://path endpoints.
+auto MakeSharedMemoryEndpoint(const std::string& localEndpoint) -> std::string;
+
+
+} // namespace VSilKit
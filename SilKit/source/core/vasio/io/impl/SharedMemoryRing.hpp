@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "util/Buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace VSilKit {
+
+
+// The atomics are shared between processes, which requires them to be lock-free
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings require lock-free 64 bit atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings require lock-free 32 bit atomics");
+
+
+//! Control block of a single-producer single-consumer byte ring, placed in shared memory.
+struct SharedMemoryRingHeader
+{
+    //! Total number of bytes ever written, only modified by the producer
+    alignas(64) std::atomic<uint64_t> writePosition;
+    //! Total number of bytes ever read, only modified by the consumer
+    alignas(64) std::atomic<uint64_t> readPosition;
+    //! Set by the consumer before it waits for data, cleared by the producer which wakes it up
+    alignas(64) std::atomic<uint32_t> readerWaiting;
+    //! Set by the producer before it waits for free space, cleared by the consumer which wakes it up
+    std::atomic<uint32_t> writerWaiting;
+};
+
+
+//! Layout of a shared-memory segment: the header is followed by the data of both rings.
+struct SharedMemorySegmentHeader
+{
+    static constexpr uint32_t MAGIC{0x534b534d}; // 'SKSM'
+    static constexpr uint32_t VERSION{1};
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringCapacity;
+
+    //! rings[0] carries the data from the connecting to the accepting side, rings[1] the opposite direction
+    SharedMemoryRingHeader rings[2];
+};
+
+
+inline auto GetSharedMemoryRingDataOffset() -> size_t
+{
+    return (sizeof(SharedMemorySegmentHeader) + 63u) & ~size_t{63u};
+}
+
+inline auto GetSharedMemorySegmentSize(uint64_t ringCapacity) -> size_t
+{
+    return GetSharedMemoryRingDataOffset() + 2u * static_cast<size_t>(ringCapacity);
+}
+
+inline auto IsValidSharedMemoryRingCapacity(uint64_t ringCapacity) -> bool
+{
+    return ringCapacity >= 4096u && ringCapacity <= (uint64_t{1} << 30)
+           && (ringCapacity & (ringCapacity - 1u)) == 0u;
+}
+
+
+//! View of a ring in shared memory. The producer calls Write, the consumer calls Read.
+//!
+//! A side which cannot make progress sets its waiting flag and checks the ring again before it waits. The other side
+//! takes the flag after it moved the position, and notifies the waiting side if it was set. Both sides use
+//! sequentially consistent operations, so that a wake-up cannot get lost between checking and waiting.
+class SharedMemoryRing
+{
+    SharedMemoryRingHeader* _header{nullptr};
+    uint8_t* _data{nullptr};
+    uint64_t _capacity{0};
+
+public:
+    SharedMemoryRing() = default;
+
+    SharedMemoryRing(SharedMemoryRingHeader* header, uint8_t* data, uint64_t capacity)
+        : _header{header}
+        , _data{data}
+        , _capacity{capacity}
+    {
+    }
+
+    //! Copies as many bytes of the buffers as fit into the ring and returns their number
+    auto Write(ConstBufferSequence bufferSequence) -> size_t
+    {
+        const auto writePosition = _header->writePosition.load(std::memory_order_relaxed);
+        const auto readPosition = _header->readPosition.load(std::memory_order_acquire);
+        const auto used = std::min(writePosition - readPosition, _capacity);
+
+        auto position = writePosition;
+        auto remaining = _capacity - used;
+
+        for (const auto& buffer : bufferSequence)
+        {
+            if (remaining == 0)
+            {
+                break;
+            }
+
+            const auto* source = static_cast<const uint8_t*>(buffer.GetData());
+            const auto size = std::min<uint64_t>(buffer.GetSize(), remaining);
+
+            Copy(position, source, size);
+
+            position += size;
+            remaining -= size;
+        }
+
+        const auto written = static_cast<size_t>(position - writePosition);
+        if (written != 0)
+        {
+            _header->writePosition.store(position, std::memory_order_seq_cst);
+        }
+
+        return written;
+    }
+
+    //! Copies as many bytes from the ring into the buffers as are available and returns their number
+    auto Read(MutableBufferSequence bufferSequence) -> size_t
+    {
+        const auto readPosition = _header->readPosition.load(std::memory_order_relaxed);
+        const auto writePosition = _header->writePosition.load(std::memory_order_acquire);
+
+        auto position = readPosition;
+        auto remaining = std::min(writePosition - readPosition, _capacity);
+
+        for (const auto& buffer : bufferSequence)
+        {
+            if (remaining == 0)
+            {
+                break;
+            }
+
+            auto* target = static_cast<uint8_t*>(buffer.GetData());
+            const auto size = std::min<uint64_t>(buffer.GetSize(), remaining);
+
+            Copy(target, position, size);
+
+            position += size;
+            remaining -= size;
+        }
+
+        const auto read = static_cast<size_t>(position - readPosition);
+        if (read != 0)
+        {
+            _header->readPosition.store(position, std::memory_order_seq_cst);
+        }
+
+        return read;
+    }
+
+    auto IsEmpty() const -> bool
+    {
+        return _header->writePosition.load(std::memory_order_seq_cst)
+               == _header->readPosition.load(std::memory_order_seq_cst);
+    }
+
+    void SetReaderWaiting()
+    {
+        _header->readerWaiting.store(1, std::memory_order_seq_cst);
+    }
+
+    auto TakeReaderWaiting() -> bool
+    {
+        return _header->readerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+
+    void SetWriterWaiting()
+    {
+        _header->writerWaiting.store(1, std::memory_order_seq_cst);
+    }
+
+    auto TakeWriterWaiting() -> bool
+    {
+        return _header->writerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+
+private:
+    void Copy(uint64_t position, const uint8_t* source, uint64_t size)
+    {
+        const auto offset = position & (_capacity - 1u);
+        const auto first = std::min(size, _capacity - offset);
+
+        std::memcpy(_data + offset, source, static_cast<size_t>(first));
+        std::memcpy(_data, source + first, static_cast<size_t>(size - first));
+    }
+
+    void Copy(uint8_t* target, uint64_t position, uint64_t size) const
+    {
+        const auto offset = position & (_capacity - 1u);
+        const auto first = std::min(size, _capacity - offset);
+
+        std::memcpy(target, _data + offset, static_cast<size_t>(first));
+        std::memcpy(target + first, _data, static_cast<size_t>(size - first));
+    }
+};
+
+
+} // namespace VSilKit
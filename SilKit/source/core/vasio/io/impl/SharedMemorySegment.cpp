@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemorySegment.hpp"
+
+#include "util/Exceptions.hpp"
+
+#include <atomic>
+#include <random>
+#include <sstream>
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SILKIT_HAVE_POSIX_SHARED_MEMORY 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define SILKIT_HAVE_POSIX_SHARED_MEMORY 0
+#endif
+
+
+namespace VSilKit {
+
+
+#if SILKIT_HAVE_POSIX_SHARED_MEMORY
+
+namespace {
+
+auto MakeErrorMessage(const char* operation, const std::string& name, int error) -> std::string
+{
+    std::ostringstream ss;
+    ss << operation << "(" << name << ") failed: " << std::strerror(error);
+    return ss.str();
+}
+
+auto MakeUniqueName() -> std::string
+{
+    static std::atomic<uint32_t> counter{0};
+    static const uint32_t random = std::random_device{}();
+
+    // NB: macOS limits the names of shared-memory objects to 31 characters
+    std::ostringstream ss;
+    ss << "/silkit-" << std::hex << static_cast<uint32_t>(::getpid()) << "-" << counter++ << "-" << random;
+    return ss.str();
+}
+
+auto Map(int fd, size_t size, const std::string& name) -> void*
+{
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        const auto error = errno;
+        ::close(fd);
+        throw SharedMemoryError{MakeErrorMessage("mmap", name, error)};
+    }
+
+    ::close(fd);
+    return data;
+}
+
+#if defined(__linux__)
+
+constexpr const char* RESERVE_OPERATION = "posix_fallocate";
+
+// Allocates the pages up front, so that an exhausted /dev/shm fails here instead of raising SIGBUS on first access
+auto Reserve(int fd, size_t size) -> int
+{
+    int error;
+    do
+    {
+        // NB: posix_fallocate returns the error code and does not set errno
+        error = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+    } while (error == EINTR);
+    return error;
+}
+
+#else
+
+constexpr const char* RESERVE_OPERATION = "ftruncate";
+
+// NB: macOS does not implement posix_fallocate, so the size is only set via ftruncate
+auto Reserve(int fd, size_t size) -> int
+{
+    return ::ftruncate(fd, static_cast<off_t>(size)) == 0 ? 0 : errno;
+}
+
+#endif
+
+} // namespace
+
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return true;
+}
+
+
+auto SharedMemorySegment::Create(size_t size) -> std::unique_ptr<SharedMemorySegment>
+{
+    const auto name = MakeUniqueName();
+
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0660);
+    if (fd == -1)
+    {
+        throw SharedMemoryError{MakeErrorMessage("shm_open", name, errno)};
+    }
+
+    const auto error = Reserve(fd, size);
+    if (error != 0)
+    {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw SharedMemoryError{MakeErrorMessage(RESERVE_OPERATION, name, error)};
+    }
+
+    try
+    {
+        auto* data = Map(fd, size, name);
+        return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{name, data, size, true}};
+    }
+    catch (...)
+    {
+        ::shm_unlink(name.c_str());
+        throw;
+    }
+}
+
+
+auto SharedMemorySegment::Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>
+{
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd == -1)
+    {
+        throw SharedMemoryError{MakeErrorMessage("shm_open", name, errno)};
+    }
+
+    struct stat status = {};
+    if (::fstat(fd, &status) != 0)
+    {
+        const auto error = errno;
+        ::close(fd);
+        throw SharedMemoryError{MakeErrorMessage("fstat", name, error)};
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+    if (size == 0)
+    {
+        ::close(fd);
+        throw SharedMemoryError{"segment " + name + " is empty"};
+    }
+
+    auto* data = Map(fd, size, name);
+    return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{name, data, size, true}};
+}
+
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    Unlink();
+    ::munmap(_data, _size);
+}
+
+
+void SharedMemorySegment::Unlink()
+{
+    if (_linked)
+    {
+        _linked = false;
+        ::shm_unlink(_name.c_str());
+    }
+}
+
+#else
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return false;
+}
+
+
+auto SharedMemorySegment::Create(size_t) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SharedMemoryError{"not supported on this platform"};
+}
+
+
+auto SharedMemorySegment::Open(const std::string&) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SharedMemoryError{"not supported on this platform"};
+}
+
+
+SharedMemorySegment::~SharedMemorySegment() = default;
+
+
+void SharedMemorySegment::Unlink()
+{
+}
+
+#endif
+
+
+SharedMemorySegment::SharedMemorySegment(std::string name, void* data, size_t size, bool linked)
+    : _name{std::move(name)}
+    , _data{data}
+    , _size{size}
+    , _linked{linked}
+{
+}
+
+
+auto SharedMemorySegment::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+
+auto SharedMemorySegment::GetData() const -> void*
+{
+    return _data;
+}
+
+
+auto SharedMemorySegment::GetSize() const -> size_t
+{
+    return _size;
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_HAVE_POSIX_SHARED_MEMORY
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+namespace VSilKit {
+
+
+//! A named shared-memory segment, mapped into the address space of this process.
+class SharedMemorySegment
+{
+    std::string _name;
+    void* _data{nullptr};
+    size_t _size{0};
+    bool _linked{false};
+
+public:
+    //! Returns true if shared-memory segments are available on this platform
+    static auto IsSupported() -> bool;
+
+    //! Creates a new zero-initialized segment with a unique name, throws SharedMemoryError on failure
+    static auto Create(size_t size) -> std::unique_ptr<SharedMemorySegment>;
+
+    //! Maps an existing segment, throws SharedMemoryError on failure
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>;
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    ~SharedMemorySegment();
+
+    auto GetName() const -> const std::string&;
+    auto GetData() const -> void*;
+    auto GetSize() const -> size_t;
+
+    //! Removes the name of the segment. The memory stays mapped until the segment is destroyed.
+    void Unlink();
+
+private:
+    SharedMemorySegment(std::string name, void* data, size_t size, bool linked);
+};
+
+
+} // namespace VSilKit
@@ -6,6 +6,7 @@
 
 #include "silkit/participant/exception.hpp"
 #include <exception>
+#include <string>
 
 
 namespace VSilKit {
@@ -29,6 +30,15 @@ struct InvalidAsioEndpointProtocolFamily : SilKit::SilKitError
 };
 
 
+struct SharedMemoryError : SilKit::SilKitError
+{
+    explicit SharedMemoryError(const std::string& message)
+        : SilKit::SilKitError{"shared memory: " + message}
+    {
+    }
+};
+
+
 } // namespace VSilKit
 
 
@@ -36,5 +46,6 @@ namespace SilKit {
 namespace Core {
 using VSilKit::InvalidStateError;
 using VSilKit::InvalidAsioEndpointProtocolFamily;
+using VSilKit::SharedMemoryError;
 } // namespace Core
 } // namespace SilKit
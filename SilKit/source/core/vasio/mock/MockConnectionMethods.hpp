@@ -40,6 +40,7 @@ struct MockConnectionMethods : IConnectionMethods
 
     MOCK_METHOD(void, HandleConnectedPeer, (SilKit::Core::IVAsioPeer *), (override));
     MOCK_METHOD(void, AddPeer, (std::unique_ptr<SilKit::Core::IVAsioPeer>), (override));
+    MOCK_METHOD(void, RemoveProxyPeer, (VAsioPeerInfo const &), (override));
 
     MOCK_METHOD(bool, TryRemoteConnectRequest, (VAsioPeerInfo const &), (override));
     MOCK_METHOD(bool, TryProxyConnect, (VAsioPeerInfo const &), (override));
@@ -208,6 +208,22 @@ void DashboardSystemServiceClient::SetSimulationEnd(oatpp::UInt64 simulationId,
     Log(response, "setting simulation end");
 }
 
+bool DashboardSystemServiceClient::UpdateSimulation(oatpp::UInt64 simulationId,
+                                                    oatpp::Object<BulkSimulationDto> bulkSimulation)
+{
+    auto response = _dashboardSystemApiClient->updateSimulation(simulationId, bulkSimulation);
+    if (response
+        && (response->getStatusCode() == 404 || response->getStatusCode() == 405
+            || response->getStatusCode() == 501))
+    {
+        Services::Logging::Debug(_logger, "Dashboard: updating simulation returned {}, bulk updates are unsupported",
+                                 response->getStatusCode());
+        return false;
+    }
+    Log(response, "updating simulation");
+    return true;
+}
+
 void DashboardSystemServiceClient::Log(std::shared_ptr<oatpp::web::client::RequestExecutor::Response> response,
                                        const std::string& message)
 {
@@ -106,6 +106,8 @@ public:
 
     void SetSimulationEnd(oatpp::UInt64 simulationId, oatpp::Object<SimulationEndDto> simulation) override;
 
+    bool UpdateSimulation(oatpp::UInt64 simulationId, oatpp::Object<BulkSimulationDto> bulkSimulation) override;
+
 private:
     void Log(std::shared_ptr<oatpp::web::client::RequestExecutor::Response> response, const std::string& message);
 
@@ -31,6 +31,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcClientDto.hpp"
 #include "RpcServerDto.hpp"
 #include "SimulationEndDto.hpp"
+#include "BulkUpdateDto.hpp"
 
 namespace SilKit {
 namespace Dashboard {
@@ -105,6 +106,9 @@ public:
                                                  oatpp::Object<SystemStatusDto> systemStatus) = 0;
 
     virtual void SetSimulationEnd(oatpp::UInt64 simulationId, oatpp::Object<SimulationEndDto> simulation) = 0;
+
+    // returns false if the server does not provide the bulk update endpoint
+    virtual bool UpdateSimulation(oatpp::UInt64 simulationId, oatpp::Object<BulkSimulationDto> bulkSimulation) = 0;
 };
 
 } // namespace Dashboard
@@ -81,6 +81,8 @@ public:
     MOCK_METHOD(void, UpdateSystemStatusForSimulation, (oatpp::UInt64, oatpp::Object<SystemStatusDto>), (override));
 
     MOCK_METHOD(void, SetSimulationEnd, (oatpp::UInt64, oatpp::Object<SimulationEndDto>), (override));
+
+    MOCK_METHOD(bool, UpdateSimulation, (oatpp::UInt64, oatpp::Object<BulkSimulationDto>), (override));
 };
 } // namespace Dashboard
 } // namespace SilKit
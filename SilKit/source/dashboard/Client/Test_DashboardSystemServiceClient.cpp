@@ -201,5 +201,54 @@ TEST_F(Test_DashboardSystemServiceClient, SetSimulationEnd_Failure)
     ASSERT_STREQ(actualPath->c_str(), "system-service/v1.0/simulations/123");
 }
 
+TEST_F(Test_DashboardSystemServiceClient, UpdateSimulation_Success)
+{
+    // Arrange
+    EXPECT_CALL(*_mockObjectMapper, write);
+    oatpp::String actualPath;
+    oatpp::String actualMethod;
+    SetupExecuteRequest(Status::CODE_204,
+                        [&actualPath, &actualMethod](auto currentMethod, auto pathTemplate, auto map) {
+        actualMethod = currentMethod;
+        actualPath = pathTemplate.format(map);
+    });
+    EXPECT_CALL(_dummyLogger, Log(Services::Logging::Level::Debug, "Dashboard: updating simulation returned 204"));
+
+    // Act
+    bool supported{false};
+    {
+        const auto service = CreateService();
+        const oatpp::UInt64 expectedSimulationId = 123;
+        auto request = BulkSimulationDto::createShared();
+        supported = service->UpdateSimulation(expectedSimulationId, request);
+    }
+
+    // Assert
+    ASSERT_TRUE(supported);
+    ASSERT_STREQ(actualMethod->c_str(), "POST");
+    ASSERT_STREQ(actualPath->c_str(), "system-service/v1.1/simulations/123/updates");
+}
+
+TEST_F(Test_DashboardSystemServiceClient, UpdateSimulation_Unsupported)
+{
+    // Arrange
+    EXPECT_CALL(*_mockObjectMapper, write);
+    SetupExecuteRequest(Status::CODE_404, [](auto, auto, auto) {});
+    EXPECT_CALL(_dummyLogger, Log(Services::Logging::Level::Debug,
+                                  "Dashboard: updating simulation returned 404, bulk updates are unsupported"));
+
+    // Act
+    bool supported{true};
+    {
+        const auto service = CreateService();
+        const oatpp::UInt64 expectedSimulationId = 123;
+        auto request = BulkSimulationDto::createShared();
+        supported = service->UpdateSimulation(expectedSimulationId, request);
+    }
+
+    // Assert
+    ASSERT_FALSE(supported);
+}
+
 } // namespace Dashboard
 } // namespace SilKit
@@ -14,6 +14,8 @@
 #include "SilKitEventQueue.hpp"
 #include "SilKitToOatppMapper.hpp"
 
+#include <map>
+
 
 namespace Log = SilKit::Services::Logging;
 
@@ -21,6 +23,12 @@ namespace Log = SilKit::Services::Logging;
 namespace {
 
 
+// events are collected for this long and then sent as one update per simulation
+constexpr std::chrono::milliseconds UPDATE_INTERVAL{100};
+// bounds the memory used while the dashboard server falls behind
+constexpr size_t EVENT_QUEUE_CAPACITY{100000};
+
+
 uint64_t GetCurrentTime()
 {
     auto now = std::chrono::system_clock::now().time_since_epoch();
@@ -106,7 +114,7 @@ void DashboardInstance::SetupDashboardConnection(std::string const &dashboardUri
 
     _silKitEventHandler =
         std::make_shared<SilKit::Dashboard::SilKitEventHandler>(_logger, serviceClient, _silKitToOatppMapper);
-    _silKitEventQueue = std::make_shared<SilKit::Dashboard::SilKitEventQueue>();
+    _silKitEventQueue = std::make_shared<SilKit::Dashboard::SilKitEventQueue>(EVENT_QUEUE_CAPACITY);
 
     RunEventQueueWorkerThread();
 }
@@ -126,17 +134,14 @@ struct EventQueueWorkerThread
         using SilKitEventType = SilKit::Dashboard::SilKitEventType;
 
         std::unordered_map<std::string, uint64_t> simulationNameToId;
+        std::map<uint64_t, std::vector<SilKit::Dashboard::SilKitEvent>> pendingEventsBySimulationId;
+        size_t reportedDroppedEventCount{0};
 
         std::vector<SilKit::Dashboard::SilKitEvent> events;
         while (eventQueue->DequeueAllInto(events))
         {
-            for (const auto &event : events)
+            for (auto &event : events)
             {
-                if (!abort.valid() || abort.wait_for(std::chrono::seconds{}) != std::future_status::timeout)
-                {
-                    return;
-                }
-
                 // process OnSimulationStart separately, since it does
 
                 if (event.Type() == SilKitEventType::OnSimulationStart)
@@ -175,56 +180,43 @@ struct EventQueueWorkerThread
 
                 const auto simulationId{it->second};
 
-                // process all event types, except OnSimulationStart
+                // collect all event types, except OnSimulationStart, into one update per simulation
 
-                switch (event.Type())
-                {
-                case SilKitEventType::OnParticipantConnected:
-                {
-                    const auto &participantConnectionInformation = event.GetParticipantConnectionInformation();
-                    eventHandler->OnParticipantConnected(simulationId, participantConnectionInformation);
-                }
-                break;
+                const auto isSimulationEnd{event.Type() == SilKitEventType::OnSimulationEnd};
+                pendingEventsBySimulationId[simulationId].emplace_back(std::move(event));
 
-                case SilKitEventType::OnSystemStateChanged:
+                if (isSimulationEnd)
                 {
-                    const auto &systemState = event.GetSystemState();
-                    eventHandler->OnSystemStateChanged(simulationId, systemState);
+                    // the name can be reused by the next simulation
+                    simulationNameToId.erase(it);
                 }
-                break;
+            }
+            events.clear();
 
-                case SilKitEventType::OnParticipantStatusChanged:
-                {
-                    const auto &participantStatus = event.GetParticipantStatus();
-                    eventHandler->OnParticipantStatusChanged(simulationId, participantStatus);
-                }
-                break;
+            const auto droppedEventCount{eventQueue->GetDroppedEventCount()};
+            if (droppedEventCount != reportedDroppedEventCount)
+            {
+                Log::Warn(logger, "Dashboard: dropped {} events because the event queue was full",
+                          droppedEventCount - reportedDroppedEventCount);
+                reportedDroppedEventCount = droppedEventCount;
+            }
 
-                case SilKitEventType::OnServiceDiscoveryEvent:
+            for (const auto &pendingEvents : pendingEventsBySimulationId)
+            {
+                if (!abort.valid() || abort.wait_for(std::chrono::seconds{}) != std::future_status::timeout)
                 {
-                    const auto &serviceData = event.GetServiceData();
-                    eventHandler->OnServiceDiscoveryEvent(simulationId, serviceData.discoveryType,
-                                                          serviceData.serviceDescriptor);
+                    return;
                 }
-                break;
-
-                case SilKitEventType::OnSimulationEnd:
-                {
-                    const auto &simulationEnd = event.GetSimulationEnd();
-                    eventHandler->OnSimulationEnd(simulationId, simulationEnd.time);
 
-                    simulationNameToId.erase(it);
-                }
-                break;
+                eventHandler->OnSimulationUpdate(pendingEvents.first, pendingEvents.second);
+            }
+            pendingEventsBySimulationId.clear();
 
-                default:
-                {
-                    Log::Error(logger, "Dashboard: unexpected SilKitEventType");
-                }
-                break;
-                }
+            // events arriving in the meantime are sent with the next update
+            if (!abort.valid() || abort.wait_for(UPDATE_INTERVAL) != std::future_status::timeout)
+            {
+                return;
             }
-            events.clear();
         }
     }
     catch (const std::exception &exception)
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "OatppHeaders.hpp"
+
+#include "DataSpecDto.hpp"
+#include "ParticipantStatusDto.hpp"
+#include "RpcSpecDto.hpp"
+#include "SystemStatusDto.hpp"
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+namespace SilKit {
+namespace Dashboard {
+
+class BulkServiceDto : public oatpp::DTO
+{
+    DTO_INIT(BulkServiceDto, DTO)
+
+    DTO_FIELD_INFO(serviceId)
+    {
+        info->description = "Id of the service";
+    }
+    DTO_FIELD(UInt64, serviceId);
+
+    DTO_FIELD_INFO(serviceType)
+    {
+        info->description = "Type of the service, e.g. cancontroller or datapublisher";
+    }
+    DTO_FIELD(String, serviceType);
+
+    DTO_FIELD_INFO(parentServiceId)
+    {
+        info->description = "Id of the parent service, only set for internal services";
+    }
+    DTO_FIELD(String, parentServiceId);
+
+    DTO_FIELD_INFO(name)
+    {
+        info->description = "Name of the service";
+    }
+    DTO_FIELD(String, name);
+
+    DTO_FIELD_INFO(networkName)
+    {
+        info->description = "Name of the network";
+    }
+    DTO_FIELD(String, networkName);
+
+    DTO_FIELD_INFO(dataSpec)
+    {
+        info->description = "Data spec, only set for data publishers and subscribers";
+    }
+    DTO_FIELD(Object<DataSpecDto>, dataSpec);
+
+    DTO_FIELD_INFO(rpcSpec)
+    {
+        info->description = "Rpc spec, only set for rpc clients and servers";
+    }
+    DTO_FIELD(Object<RpcSpecDto>, rpcSpec);
+};
+
+class BulkLinkDto : public oatpp::DTO
+{
+    DTO_INIT(BulkLinkDto, DTO)
+
+    DTO_FIELD_INFO(type)
+    {
+        info->description = "Type of the network, e.g. can or ethernet";
+    }
+    DTO_FIELD(String, type);
+
+    DTO_FIELD_INFO(name)
+    {
+        info->description = "Name of the network";
+    }
+    DTO_FIELD(String, name);
+};
+
+class BulkParticipantDto : public oatpp::DTO
+{
+    DTO_INIT(BulkParticipantDto, DTO)
+
+    DTO_FIELD_INFO(name)
+    {
+        info->description = "Name of the participant";
+    }
+    DTO_FIELD(String, name);
+
+    DTO_FIELD_INFO(connected)
+    {
+        info->description = "Participant connected since the previous update";
+    }
+    DTO_FIELD(Boolean, connected);
+
+    DTO_FIELD_INFO(statuses)
+    {
+        info->description = "States entered since the previous update, in order";
+    }
+    DTO_FIELD(Vector<Object<ParticipantStatusDto>>, statuses);
+
+    DTO_FIELD_INFO(services)
+    {
+        info->description = "Services created since the previous update";
+    }
+    DTO_FIELD(Vector<Object<BulkServiceDto>>, services);
+
+    DTO_FIELD_INFO(links)
+    {
+        info->description = "Networks created since the previous update";
+    }
+    DTO_FIELD(Vector<Object<BulkLinkDto>>, links);
+};
+
+class BulkSimulationDto : public oatpp::DTO
+{
+    DTO_INIT(BulkSimulationDto, DTO)
+
+    DTO_FIELD_INFO(participants)
+    {
+        info->description = "Participants with changes since the previous update";
+    }
+    DTO_FIELD(Vector<Object<BulkParticipantDto>>, participants);
+
+    DTO_FIELD_INFO(systemStatuses)
+    {
+        info->description = "System states entered since the previous update, in order";
+    }
+    DTO_FIELD(Vector<Object<SystemStatusDto>>, systemStatuses);
+
+    DTO_FIELD_INFO(stopped)
+    {
+        info->description = "Time when simulation ended, only set if it ended since the previous update";
+    }
+    DTO_FIELD(UInt64, stopped);
+};
+
+} // namespace Dashboard
+} // namespace SilKit
+
+#include OATPP_CODEGEN_END(DTO)
@@ -33,6 +33,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "OatppHeaders.hpp"
 
+#include "BulkUpdateDto.hpp"
 #include "DataPublisherDto.hpp"
 #include "DataSubscriberDto.hpp"
 #include "ParticipantStatusDto.hpp"
@@ -380,6 +381,64 @@ public:
         return createResponse(Status::CODE_204, "");
     }
 
+    ENDPOINT("POST", "system-service/v1.1/simulations/{simulationId}/updates", updateSimulation,
+             PATH(UInt64, simulationId), BODY_DTO(Object<SilKit::Dashboard::BulkSimulationDto>, bulkSimulation))
+    {
+        std::this_thread::sleep_for(_updateTimeout);
+        OATPP_ASSERT_HTTP(simulationId <= _simulationId, Status::CODE_404, "simulationId not found");
+        OATPP_ASSERT_HTTP(bulkSimulation, Status::CODE_400, "bulkSimulation not set");
+        std::unique_lock<decltype(_mutex)> lock(_mutex);
+        auto& data = _data[simulationId];
+        for (auto& participant : *bulkSimulation->participants)
+        {
+            std::string participantName = participant->name;
+            if (participant->connected && *participant->connected)
+            {
+                data.participants.insert(participantName);
+            }
+            for (auto& participantStatus : *participant->statuses)
+            {
+                data.statesByParticipant[participantName].insert(
+                    oatpp::Enum<ParticipantState>::getEntryByValue(participantStatus->state).name.toString());
+            }
+            for (auto& service : *participant->services)
+            {
+                Spec spec{};
+                if (service->dataSpec)
+                {
+                    spec = {service->dataSpec->topic, "", service->dataSpec->mediaType,
+                            GetLabels(service->dataSpec->labels)};
+                }
+                else if (service->rpcSpec)
+                {
+                    spec = {"", service->rpcSpec->functionName, service->rpcSpec->mediaType,
+                            GetLabels(service->rpcSpec->labels)};
+                }
+                std::string parentServiceId = service->parentServiceId ? *service->parentServiceId : "";
+                std::string networkName = service->networkName ? *service->networkName : "";
+                data.servicesByParticipant[participantName].insert(std::pair<uint64_t, Service>(
+                    service->serviceId, {parentServiceId, service->serviceType, service->name, networkName, spec}));
+            }
+            for (auto& link : *participant->links)
+            {
+                data.linksByParticipant[participantName].insert({link->type, link->name});
+            }
+        }
+        for (auto& systemStatus : *bulkSimulation->systemStatuses)
+        {
+            data.systemStates.insert(oatpp::Enum<SystemState>::getEntryByValue(systemStatus->state).name.toString());
+        }
+        if (bulkSimulation->stopped != nullptr)
+        {
+            data.stopped = true;
+            if (static_cast<uint64_t>(CountFinishedSimulations()) == _expectedSimulationsCount)
+            {
+                _allSimulationsFinishedPromise.set_value();
+            }
+        }
+        return createResponse(Status::CODE_204, "");
+    }
+
     int CountFinishedSimulations()
     {
         auto finishedSimulationsCount = 0;
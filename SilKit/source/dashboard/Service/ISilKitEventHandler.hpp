@@ -23,6 +23,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 #include "ServiceDatatypes.hpp"
+#include "SilKitEvent.hpp"
+
+#include <vector>
 
 namespace SilKit {
 namespace Dashboard {
@@ -41,6 +44,8 @@ public:
     virtual void OnServiceDiscoveryEvent(uint64_t simulationId,
                                          Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
                                          const Core::ServiceDescriptor& serviceDescriptor) = 0;
+    // sends the events of one simulation, except OnSimulationStart, as a single update
+    virtual void OnSimulationUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events) = 0;
 };
 } // namespace Dashboard
 } // namespace SilKit
@@ -34,6 +34,7 @@ public:
     virtual void Enqueue(const SilKitEvent& obj) = 0;
     virtual bool DequeueAllInto(std::vector<SilKitEvent>& events) = 0;
     virtual void Stop() = 0;
+    virtual size_t GetDroppedEventCount() = 0;
 };
 
 } // namespace Dashboard
@@ -33,6 +33,7 @@ public:
     MOCK_METHOD(void, Enqueue, (const SilKitEvent&), (override));
     MOCK_METHOD(bool, DequeueAllInto, (std::vector<SilKitEvent>&), (override));
     MOCK_METHOD(void, Stop, (), (override));
+    MOCK_METHOD(size_t, GetDroppedEventCount, (), (override));
 };
 
 } // namespace Dashboard
@@ -26,6 +26,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKit.hpp"
 #include "Uri.hpp"
 
+#include <map>
+#include <set>
+#include <utility>
+
 namespace SilKit {
 namespace Dashboard {
 
@@ -105,89 +109,154 @@ void SilKitEventHandler::OnServiceDiscoveryEvent(uint64_t simulationId,
     }
 }
 
-void SilKitEventHandler::OnControllerCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor)
+namespace {
+
+enum class ControllerKind
 {
-    Services::Logging::Debug(_logger, "Dashboard: adding service for simulation {} {}", simulationId,
-                             serviceDescriptor);
-    std::string controllerType;
-    if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, controllerType))
+    Unknown,
+    Can,
+    Ethernet,
+    Flexray,
+    Lin,
+    DataPublisher,
+    DataSubscriber,
+    DataSubscriberInternal,
+    RpcClient,
+    RpcServer,
+    RpcServerInternal,
+};
+
+struct ControllerInfo
+{
+    ControllerKind kind{ControllerKind::Unknown};
+    std::string parentServiceId;
+};
+
+std::string GetRequiredSupplementalDataItem(const Core::ServiceDescriptor& serviceDescriptor, const std::string& key)
+{
+    std::string value;
+    if (!serviceDescriptor.GetSupplementalDataItem(key, value))
     {
-        throw SilKitError{"Missing key" + Core::Discovery::controllerType + " in supplementalData"};
+        throw SilKitError{"Missing key" + key + " in supplementalData"};
     }
-    auto participantName = SilKit::Core::Uri::UrlEncode(serviceDescriptor.GetParticipantName());
+    return value;
+}
+
+// Shared by the single event and the bulk update path, so both report the same services
+ControllerInfo GetControllerInfo(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    const auto controllerType = GetRequiredSupplementalDataItem(serviceDescriptor, Core::Discovery::controllerType);
+
+    ControllerInfo info;
     if (controllerType == Core::Discovery::controllerTypeCan)
     {
-        _dashboardSystemServiceClient->AddCanControllerForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        info.kind = ControllerKind::Can;
     }
     else if (controllerType == Core::Discovery::controllerTypeEthernet)
     {
-        _dashboardSystemServiceClient->AddEthernetControllerForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        info.kind = ControllerKind::Ethernet;
     }
     else if (controllerType == Core::Discovery::controllerTypeFlexray)
     {
-        _dashboardSystemServiceClient->AddFlexrayControllerForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        info.kind = ControllerKind::Flexray;
     }
     else if (controllerType == Core::Discovery::controllerTypeLin)
     {
-        _dashboardSystemServiceClient->AddLinControllerForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        info.kind = ControllerKind::Lin;
     }
     else if (controllerType == Core::Discovery::controllerTypeDataPublisher)
     {
-        _dashboardSystemServiceClient->AddDataPublisherForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateDataPublisherDto(serviceDescriptor));
+        info.kind = ControllerKind::DataPublisher;
     }
     else if (controllerType == Core::Discovery::controllerTypeDataSubscriber)
     {
-        _dashboardSystemServiceClient->AddDataSubscriberForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateDataSubscriberDto(serviceDescriptor));
+        info.kind = ControllerKind::DataSubscriber;
     }
     else if (controllerType == Core::Discovery::controllerTypeDataSubscriberInternal)
     {
-        std::string parentServiceId;
-        if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyDataSubscriberInternalParentServiceID,
-                                                       parentServiceId))
-        {
-            throw SilKitError{"Missing key" + Core::Discovery::supplKeyDataSubscriberInternalParentServiceID
-                              + " in supplementalData"};
-        }
-        _dashboardSystemServiceClient->AddDataSubscriberInternalForParticipantOfSimulation(
-            simulationId, participantName, parentServiceId, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        info.kind = ControllerKind::DataSubscriberInternal;
+        info.parentServiceId = GetRequiredSupplementalDataItem(
+            serviceDescriptor, Core::Discovery::supplKeyDataSubscriberInternalParentServiceID);
     }
     else if (controllerType == Core::Discovery::controllerTypeRpcClient)
     {
-        _dashboardSystemServiceClient->AddRpcClientForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateRpcClientDto(serviceDescriptor));
+        info.kind = ControllerKind::RpcClient;
     }
     else if (controllerType == Core::Discovery::controllerTypeRpcServer)
     {
-        _dashboardSystemServiceClient->AddRpcServerForParticipantOfSimulation(
-            simulationId, participantName, serviceDescriptor.GetServiceId(),
-            _silKitToOatppMapper->CreateRpcServerDto(serviceDescriptor));
+        info.kind = ControllerKind::RpcServer;
     }
     else if (controllerType == Core::Discovery::controllerTypeRpcServerInternal)
     {
-        std::string parentServiceId;
-        if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyRpcServerInternalParentServiceID,
-                                                       parentServiceId))
-        {
-            throw SilKitError{"Missing key" + Core::Discovery::supplKeyRpcServerInternalParentServiceID
-                              + " in supplementalData"};
-        }
+        info.kind = ControllerKind::RpcServerInternal;
+        info.parentServiceId = GetRequiredSupplementalDataItem(
+            serviceDescriptor, Core::Discovery::supplKeyRpcServerInternalParentServiceID);
+    }
+    return info;
+}
+
+} // namespace
+
+void SilKitEventHandler::OnControllerCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor)
+{
+    Services::Logging::Debug(_logger, "Dashboard: adding service for simulation {} {}", simulationId,
+                             serviceDescriptor);
+    const auto controllerInfo = GetControllerInfo(serviceDescriptor);
+    auto participantName = SilKit::Core::Uri::UrlEncode(serviceDescriptor.GetParticipantName());
+    switch (controllerInfo.kind)
+    {
+    case ControllerKind::Can:
+        _dashboardSystemServiceClient->AddCanControllerForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::Ethernet:
+        _dashboardSystemServiceClient->AddEthernetControllerForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::Flexray:
+        _dashboardSystemServiceClient->AddFlexrayControllerForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::Lin:
+        _dashboardSystemServiceClient->AddLinControllerForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::DataPublisher:
+        _dashboardSystemServiceClient->AddDataPublisherForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateDataPublisherDto(serviceDescriptor));
+        break;
+    case ControllerKind::DataSubscriber:
+        _dashboardSystemServiceClient->AddDataSubscriberForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateDataSubscriberDto(serviceDescriptor));
+        break;
+    case ControllerKind::DataSubscriberInternal:
+        _dashboardSystemServiceClient->AddDataSubscriberInternalForParticipantOfSimulation(
+            simulationId, participantName, controllerInfo.parentServiceId, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::RpcClient:
+        _dashboardSystemServiceClient->AddRpcClientForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateRpcClientDto(serviceDescriptor));
+        break;
+    case ControllerKind::RpcServer:
+        _dashboardSystemServiceClient->AddRpcServerForParticipantOfSimulation(
+            simulationId, participantName, serviceDescriptor.GetServiceId(),
+            _silKitToOatppMapper->CreateRpcServerDto(serviceDescriptor));
+        break;
+    case ControllerKind::RpcServerInternal:
         _dashboardSystemServiceClient->AddRpcServerInternalForParticipantOfSimulation(
-            simulationId, participantName, parentServiceId, serviceDescriptor.GetServiceId(),
+            simulationId, participantName, controllerInfo.parentServiceId, serviceDescriptor.GetServiceId(),
             _silKitToOatppMapper->CreateServiceDto(serviceDescriptor));
+        break;
+    case ControllerKind::Unknown:
+        break;
     }
 }
 
@@ -216,5 +285,273 @@ void SilKitEventHandler::OnLinkCreated(uint64_t simulationId, const Core::Servic
     }
 }
 
+void SilKitEventHandler::OnSimulationUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events)
+{
+    if (events.empty())
+    {
+        return;
+    }
+
+    if (!_bulkUpdatesUnsupported)
+    {
+        Services::Logging::Debug(_logger, "Dashboard: updating simulation {} with {} events", simulationId,
+                                 events.size());
+        if (_dashboardSystemServiceClient->UpdateSimulation(simulationId, CreateBulkSimulationDto(events)))
+        {
+            return;
+        }
+
+        Services::Logging::Info(_logger, "Dashboard: server does not support bulk updates, sending events one by one");
+        _bulkUpdatesUnsupported = true;
+    }
+
+    for (const auto& event : events)
+    {
+        OnEvent(simulationId, event);
+    }
+}
+
+void SilKitEventHandler::OnEvent(uint64_t simulationId, const SilKitEvent& event)
+{
+    switch (event.Type())
+    {
+    case SilKitEventType::OnParticipantConnected:
+        OnParticipantConnected(simulationId, event.GetParticipantConnectionInformation());
+        break;
+    case SilKitEventType::OnSystemStateChanged:
+        OnSystemStateChanged(simulationId, event.GetSystemState());
+        break;
+    case SilKitEventType::OnParticipantStatusChanged:
+        OnParticipantStatusChanged(simulationId, event.GetParticipantStatus());
+        break;
+    case SilKitEventType::OnServiceDiscoveryEvent:
+        OnServiceDiscoveryEvent(simulationId, event.GetServiceData().discoveryType,
+                                event.GetServiceData().serviceDescriptor);
+        break;
+    case SilKitEventType::OnSimulationEnd:
+        OnSimulationEnd(simulationId, event.GetSimulationEnd().time);
+        break;
+    default:
+        Services::Logging::Error(_logger, "Dashboard: unexpected SilKitEventType in simulation update");
+        break;
+    }
+}
+
+namespace {
+
+struct ParticipantUpdate
+{
+    oatpp::Object<BulkParticipantDto> dto;
+    bool hasState{false};
+    Services::Orchestration::ParticipantState lastState{};
+    std::map<uint64_t, size_t> serviceIndexById;
+    std::set<std::pair<std::string, std::string>> links;
+};
+
+const char* GetLinkType(Config::NetworkType networkType)
+{
+    switch (networkType)
+    {
+    case Config::NetworkType::CAN:
+        return "can";
+    case Config::NetworkType::Ethernet:
+        return "ethernet";
+    case Config::NetworkType::FlexRay:
+        return "flexray";
+    case Config::NetworkType::LIN:
+        return "lin";
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
+oatpp::Object<BulkSimulationDto> SilKitEventHandler::CreateBulkSimulationDto(const std::vector<SilKitEvent>& events)
+{
+    auto bulkSimulation = BulkSimulationDto::createShared();
+    bulkSimulation->participants = oatpp::Vector<oatpp::Object<BulkParticipantDto>>::createShared();
+    bulkSimulation->systemStatuses = oatpp::Vector<oatpp::Object<SystemStatusDto>>::createShared();
+
+    std::map<std::string, ParticipantUpdate> participantUpdates;
+    auto getParticipantUpdate = [&participantUpdates, &bulkSimulation](const std::string& participantName) -> auto& {
+        auto it = participantUpdates.find(participantName);
+        if (it == participantUpdates.end())
+        {
+            ParticipantUpdate participantUpdate;
+            participantUpdate.dto = BulkParticipantDto::createShared();
+            participantUpdate.dto->name = participantName;
+            participantUpdate.dto->connected = false;
+            participantUpdate.dto->statuses = oatpp::Vector<oatpp::Object<ParticipantStatusDto>>::createShared();
+            participantUpdate.dto->services = oatpp::Vector<oatpp::Object<BulkServiceDto>>::createShared();
+            participantUpdate.dto->links = oatpp::Vector<oatpp::Object<BulkLinkDto>>::createShared();
+            bulkSimulation->participants->push_back(participantUpdate.dto);
+            it = participantUpdates.emplace(participantName, std::move(participantUpdate)).first;
+        }
+        return it->second;
+    };
+
+    bool hasSystemState{false};
+    Services::Orchestration::SystemState lastSystemState{};
+
+    for (const auto& event : events)
+    {
+        switch (event.Type())
+        {
+        case SilKitEventType::OnParticipantConnected:
+        {
+            const auto& participantInformation = event.GetParticipantConnectionInformation();
+            getParticipantUpdate(participantInformation.participantName).dto->connected = true;
+        }
+        break;
+
+        case SilKitEventType::OnParticipantStatusChanged:
+        {
+            const auto& participantStatus = event.GetParticipantStatus();
+            auto& participantUpdate = getParticipantUpdate(participantStatus.participantName);
+            auto statusDto = _silKitToOatppMapper->CreateParticipantStatusDto(participantStatus);
+            // a repeated state supersedes the previous report of the same state
+            if (participantUpdate.hasState && participantUpdate.lastState == participantStatus.state)
+            {
+                participantUpdate.dto->statuses->back() = statusDto;
+            }
+            else
+            {
+                participantUpdate.dto->statuses->push_back(statusDto);
+            }
+            participantUpdate.hasState = true;
+            participantUpdate.lastState = participantStatus.state;
+        }
+        break;
+
+        case SilKitEventType::OnSystemStateChanged:
+        {
+            const auto systemState = event.GetSystemState();
+            if (!hasSystemState || lastSystemState != systemState)
+            {
+                bulkSimulation->systemStatuses->push_back(_silKitToOatppMapper->CreateSystemStatusDto(systemState));
+            }
+            hasSystemState = true;
+            lastSystemState = systemState;
+        }
+        break;
+
+        case SilKitEventType::OnServiceDiscoveryEvent:
+        {
+            const auto& serviceDescriptor = event.GetServiceData().serviceDescriptor;
+            auto& participantUpdate = getParticipantUpdate(serviceDescriptor.GetParticipantName());
+            if (serviceDescriptor.GetServiceType() == Core::ServiceType::Controller)
+            {
+                auto serviceDto = CreateBulkServiceDto(serviceDescriptor);
+                if (serviceDto == nullptr)
+                {
+                    break;
+                }
+                // a service announced again replaces its earlier description
+                const auto index = participantUpdate.dto->services->size();
+                const auto it = participantUpdate.serviceIndexById.emplace(serviceDescriptor.GetServiceId(), index);
+                if (it.second)
+                {
+                    participantUpdate.dto->services->push_back(serviceDto);
+                }
+                else
+                {
+                    participantUpdate.dto->services->at(it.first->second) = serviceDto;
+                }
+            }
+            else if (serviceDescriptor.GetServiceType() == Core::ServiceType::Link)
+            {
+                const auto linkType = GetLinkType(serviceDescriptor.GetNetworkType());
+                if (linkType == nullptr
+                    || !participantUpdate.links.emplace(linkType, serviceDescriptor.GetNetworkName()).second)
+                {
+                    break;
+                }
+                auto linkDto = BulkLinkDto::createShared();
+                linkDto->type = linkType;
+                linkDto->name = serviceDescriptor.GetNetworkName();
+                participantUpdate.dto->links->push_back(linkDto);
+            }
+        }
+        break;
+
+        case SilKitEventType::OnSimulationEnd:
+            bulkSimulation->stopped = event.GetSimulationEnd().time;
+            break;
+
+        default:
+            Services::Logging::Error(_logger, "Dashboard: unexpected SilKitEventType in simulation update");
+            break;
+        }
+    }
+
+    return bulkSimulation;
+}
+
+oatpp::Object<BulkServiceDto> SilKitEventHandler::CreateBulkServiceDto(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    const auto controllerInfo = GetControllerInfo(serviceDescriptor);
+    if (controllerInfo.kind == ControllerKind::Unknown)
+    {
+        return nullptr;
+    }
+
+    auto service = BulkServiceDto::createShared();
+    service->serviceId = serviceDescriptor.GetServiceId();
+    service->name = serviceDescriptor.GetServiceName();
+
+    switch (controllerInfo.kind)
+    {
+    case ControllerKind::Can:
+        service->serviceType = "cancontroller";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::Ethernet:
+        service->serviceType = "ethernetcontroller";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::Flexray:
+        service->serviceType = "flexraycontroller";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::Lin:
+        service->serviceType = "lincontroller";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::DataPublisher:
+        service->serviceType = "datapublisher";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        service->dataSpec = _silKitToOatppMapper->CreateDataPublisherDto(serviceDescriptor)->spec;
+        break;
+    case ControllerKind::DataSubscriber:
+        service->serviceType = "datasubscriber";
+        service->dataSpec = _silKitToOatppMapper->CreateDataSubscriberDto(serviceDescriptor)->spec;
+        break;
+    case ControllerKind::DataSubscriberInternal:
+        service->serviceType = "datasubscriberinternal";
+        service->parentServiceId = controllerInfo.parentServiceId;
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::RpcClient:
+        service->serviceType = "rpcclient";
+        service->networkName = serviceDescriptor.GetNetworkName();
+        service->rpcSpec = _silKitToOatppMapper->CreateRpcClientDto(serviceDescriptor)->spec;
+        break;
+    case ControllerKind::RpcServer:
+        service->serviceType = "rpcserver";
+        service->rpcSpec = _silKitToOatppMapper->CreateRpcServerDto(serviceDescriptor)->spec;
+        break;
+    case ControllerKind::RpcServerInternal:
+        service->serviceType = "rpcserverinternal";
+        service->parentServiceId = controllerInfo.parentServiceId;
+        service->networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ControllerKind::Unknown:
+        break;
+    }
+
+    return service;
+}
+
 } // namespace Dashboard
 } // namespace SilKit
@@ -52,15 +52,20 @@ public: //methods
     void OnSystemStateChanged(uint64_t simulationId, Services::Orchestration::SystemState systemState) override;
     void OnServiceDiscoveryEvent(uint64_t simulationId, Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
                                  const Core::ServiceDescriptor& serviceDescriptor) override;
+    void OnSimulationUpdate(uint64_t simulationId, const std::vector<SilKitEvent>& events) override;
 
 private: //methods
     void OnControllerCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor);
     void OnLinkCreated(uint64_t simulationId, const Core::ServiceDescriptor& serviceDescriptor);
+    void OnEvent(uint64_t simulationId, const SilKitEvent& event);
+    oatpp::Object<BulkSimulationDto> CreateBulkSimulationDto(const std::vector<SilKitEvent>& events);
+    oatpp::Object<BulkServiceDto> CreateBulkServiceDto(const Core::ServiceDescriptor& serviceDescriptor);
 
 private: //member
     Services::Logging::ILogger* _logger;
     std::shared_ptr<IDashboardSystemServiceClient> _dashboardSystemServiceClient;
     std::shared_ptr<ISilKitToOatppMapper> _silKitToOatppMapper;
+    bool _bulkUpdatesUnsupported{false};
 };
 
 } // namespace Dashboard
@@ -21,11 +21,42 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SilKitEventQueue.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace SilKit {
 
 namespace Dashboard {
 
-SilKitEventQueue::SilKitEventQueue() {}
+namespace {
+
+bool IsStatusEvent(const SilKitEvent& event)
+{
+    return event.Type() == SilKitEventType::OnParticipantStatusChanged
+           || event.Type() == SilKitEventType::OnSystemStateChanged;
+}
+
+// the system status key is the bare simulation name, participant keys always contain the separator
+std::string GetStatusKey(const SilKitEvent& event)
+{
+    if (event.Type() == SilKitEventType::OnParticipantStatusChanged)
+    {
+        return event.GetSimulationName() + '\n' + event.GetParticipantStatus().participantName;
+    }
+    return event.GetSimulationName();
+}
+
+bool IsLifecycleEvent(const SilKitEvent& event)
+{
+    return event.Type() == SilKitEventType::OnSimulationStart || event.Type() == SilKitEventType::OnSimulationEnd;
+}
+
+} // namespace
+
+SilKitEventQueue::SilKitEventQueue(size_t capacity)
+    : _capacity{capacity}
+{
+}
 
 SilKitEventQueue::~SilKitEventQueue() {}
 
@@ -33,9 +64,47 @@ void SilKitEventQueue::Enqueue(const SilKitEvent& obj)
 {
     {
         std::lock_guard<decltype(_mutex)> lock{_mutex};
-        if (!_stop)
+        if (_stop)
+        {
+            return;
+        }
+
+        const auto isStatusEvent = IsStatusEvent(obj);
+        const auto statusKey = isStatusEvent ? GetStatusKey(obj) : std::string{};
+
+        if (_capacity != 0 && _queue.size() >= _capacity)
         {
-            _queue.push_back(obj);
+            // only a status with a newer status for the same participant is evicted, no update is lost
+            if (!_supersededStatuses.empty())
+            {
+                _queue.erase(_supersededStatuses.front());
+                _supersededStatuses.pop_front();
+                ++_droppedEventCount;
+            }
+            else if (isStatusEvent && _latestStatuses.count(statusKey) != 0)
+            {
+                // the incoming status supersedes the queued one
+                _queue.erase(_latestStatuses[statusKey]);
+                _latestStatuses.erase(statusKey);
+                ++_droppedEventCount;
+            }
+            else if (!IsLifecycleEvent(obj))
+            {
+                // simulations must always be created and ended, everything else is dropped
+                ++_droppedEventCount;
+                return;
+            }
+        }
+
+        const auto it = _queue.insert(_queue.end(), obj);
+        if (isStatusEvent)
+        {
+            const auto latestStatus = _latestStatuses.emplace(statusKey, it);
+            if (!latestStatus.second)
+            {
+                _supersededStatuses.push_back(latestStatus.first->second);
+                latestStatus.first->second = it;
+            }
         }
     }
     _cv.notify_one();
@@ -47,6 +116,8 @@ bool SilKitEventQueue::DequeueAllInto(std::vector<SilKitEvent>& events)
     _cv.wait(lock, [this] { return !_queue.empty() || _stop; });
     std::move(_queue.begin(), _queue.end(), std::back_inserter(events));
     _queue.clear();
+    _latestStatuses.clear();
+    _supersededStatuses.clear();
     return !events.empty();
 }
 
@@ -59,5 +130,11 @@ void SilKitEventQueue::Stop()
     _cv.notify_one();
 }
 
+size_t SilKitEventQueue::GetDroppedEventCount()
+{
+    std::lock_guard<decltype(_mutex)> lock{_mutex};
+    return _droppedEventCount;
+}
+
 } // namespace Dashboard
 } // namespace SilKit
\ No newline at end of file
@@ -23,9 +23,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "ISilKitEventQueue.hpp"
 
-#include <queue>
+#include <deque>
+#include <list>
 #include <mutex>
 #include <condition_variable>
+#include <string>
+#include <unordered_map>
 
 
 namespace SilKit {
@@ -35,17 +38,27 @@ namespace Dashboard {
 class SilKitEventQueue : public ISilKitEventQueue
 {
 public:
-    SilKitEventQueue();
+    // a capacity of 0 leaves the queue unbounded
+    explicit SilKitEventQueue(size_t capacity = 0);
     ~SilKitEventQueue();
 
     void Enqueue(const SilKitEvent& obj) override;
     bool DequeueAllInto(std::vector<SilKitEvent>& events) override;
     void Stop() override;
+    size_t GetDroppedEventCount() override;
 
 protected:
+    using EventList = std::list<SilKitEvent>;
+
+    size_t _capacity;
     std::mutex _mutex;
     std::condition_variable _cv;
-    std::deque<SilKitEvent> _queue;
+    EventList _queue;
+    // the latest queued status per participant and system status, keyed by simulation
+    std::unordered_map<std::string, EventList::iterator> _latestStatuses;
+    // queued statuses which a later status for the same key supersedes, oldest first
+    std::deque<EventList::iterator> _supersededStatuses;
+    size_t _droppedEventCount{0};
     bool _stop{false};
 };
 
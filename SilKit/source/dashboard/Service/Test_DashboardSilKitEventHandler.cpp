@@ -691,5 +691,106 @@ TEST_F(Test_DashboardSilKitEventHandler, OnServiceDiscoveryEvent_Invalid_Ignore)
                                      descriptor);
 }
 
+TEST_F(Test_DashboardSilKitEventHandler, OnSimulationUpdate_CoalescedUpdateSent)
+{
+    using participantStatus = Services::Orchestration::ParticipantStatus;
+    using connectionInfo = Services::Orchestration::ParticipantConnectionInformation;
+    using systemState = Services::Orchestration::SystemState;
+
+    // Arrange
+    const oatpp::UInt64 expectedSimulationId = 123;
+    const auto service = CreateService();
+
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateParticipantStatusDto)
+        .WillRepeatedly(Invoke([](const participantStatus& status) {
+        auto dto = ParticipantStatusDto::createShared();
+        dto->enterReason = status.enterReason;
+        return dto;
+    }));
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateSystemStatusDto).WillRepeatedly(Invoke([](systemState) {
+        return SystemStatusDto::createShared();
+    }));
+
+    oatpp::UInt64 actualSimulationId;
+    oatpp::Object<BulkSimulationDto> actualUpdate;
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, UpdateSimulation)
+        .WillOnce(DoAll(WithArgs<0, 1>([&](auto simulationId, auto bulkSimulation) {
+        actualSimulationId = simulationId;
+        actualUpdate = bulkSimulation;
+    }),
+                        Return(true)));
+
+    auto makeStatus = [](auto state, const std::string& enterReason) {
+        participantStatus status;
+        status.participantName = "my Participant";
+        status.state = state;
+        status.enterReason = enterReason;
+        return status;
+    };
+    auto controller = BuildDescriptor(Core::Discovery::controllerTypeCan, 456, "my Participant");
+    controller.SetNetworkName("CAN1");
+    Core::ServiceDescriptor link;
+    link.SetServiceType(Core::ServiceType::Link);
+    link.SetParticipantNameAndComputeId("my Participant");
+    link.SetNetworkType(Config::NetworkType::CAN);
+    link.SetNetworkName("CAN1");
+    const auto created = Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated;
+
+    std::vector<SilKitEvent> events;
+    events.emplace_back("sim", connectionInfo{"my Participant"});
+    events.emplace_back("sim", makeStatus(Services::Orchestration::ParticipantState::ServicesCreated, "first"));
+    events.emplace_back("sim", makeStatus(Services::Orchestration::ParticipantState::ServicesCreated, "second"));
+    events.emplace_back("sim", makeStatus(Services::Orchestration::ParticipantState::Running, "third"));
+    events.emplace_back("sim", systemState::Running);
+    events.emplace_back("sim", systemState::Running);
+    events.emplace_back("sim", ServiceData{created, controller});
+    events.emplace_back("sim", ServiceData{created, controller});
+    events.emplace_back("sim", ServiceData{created, link});
+    events.emplace_back("sim", ServiceData{created, link});
+    events.emplace_back("sim", SimulationEnd{789});
+
+    // Act
+    service->OnSimulationUpdate(expectedSimulationId, events);
+
+    // Assert
+    ASSERT_EQ(actualSimulationId, expectedSimulationId);
+    ASSERT_EQ(actualUpdate->participants->size(), 1u);
+    const auto& participant = actualUpdate->participants->front();
+    ASSERT_STREQ(participant->name->c_str(), "my Participant");
+    ASSERT_TRUE(*participant->connected);
+    ASSERT_EQ(participant->statuses->size(), 2u);
+    ASSERT_STREQ(participant->statuses->at(0)->enterReason->c_str(), "second");
+    ASSERT_STREQ(participant->statuses->at(1)->enterReason->c_str(), "third");
+    ASSERT_EQ(participant->services->size(), 1u);
+    ASSERT_EQ(participant->services->at(0)->serviceId, 456u);
+    ASSERT_STREQ(participant->services->at(0)->serviceType->c_str(), "cancontroller");
+    ASSERT_STREQ(participant->services->at(0)->networkName->c_str(), "CAN1");
+    ASSERT_EQ(participant->links->size(), 1u);
+    ASSERT_STREQ(participant->links->at(0)->type->c_str(), "can");
+    ASSERT_EQ(actualUpdate->systemStatuses->size(), 1u);
+    ASSERT_EQ(actualUpdate->stopped, 789u);
+}
+
+TEST_F(Test_DashboardSilKitEventHandler, OnSimulationUpdate_BulkUpdatesUnsupported_SingleRequestsSent)
+{
+    using connectionInfo = Services::Orchestration::ParticipantConnectionInformation;
+
+    // Arrange
+    const oatpp::UInt64 expectedSimulationId = 123;
+    const auto service = CreateService();
+
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, UpdateSimulation).WillOnce(Return(false));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, AddParticipantToSimulation(expectedSimulationId, _)).Times(2);
+    auto request = SimulationEndDto::createShared();
+    EXPECT_CALL(*_mockSilKitToOatppMapper, CreateSimulationEndDto).WillOnce(Return(request));
+    EXPECT_CALL(*_mockDashboardSystemServiceClient, SetSimulationEnd(expectedSimulationId, request));
+
+    // Act
+    service->OnSimulationUpdate(expectedSimulationId, {SilKitEvent{"sim", connectionInfo{"my Participant"}}});
+    // the server is not asked again
+    service->OnSimulationUpdate(expectedSimulationId, {SilKitEvent{"sim", connectionInfo{"my Participant"}},
+                                                       SilKitEvent{"sim", SimulationEnd{789}}});
+}
+
 } // namespace Dashboard
 } // namespace SilKit
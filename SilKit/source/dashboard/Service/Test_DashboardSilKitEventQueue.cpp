@@ -91,5 +91,79 @@ TEST_F(Test_DashboardSilKitEventQueue, ManyProducersAndOneConsumer)
     ASSERT_EQ(eventCount, 103u) << "Wrong event count!";
 }
 
+namespace {
+
+Services::Orchestration::ParticipantStatus MakeParticipantStatus(const std::string& participantName,
+                                                                 Services::Orchestration::ParticipantState state)
+{
+    Services::Orchestration::ParticipantStatus participantStatus{};
+    participantStatus.participantName = participantName;
+    participantStatus.state = state;
+    return participantStatus;
+}
+
+} // namespace
+
+TEST_F(Test_DashboardSilKitEventQueue, FullQueueDropsSupersededStatusUpdatesFirst)
+{
+    // Arrange
+    SilKitEventQueue service{4};
+
+    // Act
+    service.Enqueue(SilKitEvent({}, SimulationStart{"silkit://localhost:8500", 123456}));
+    service.Enqueue(
+        SilKitEvent({}, MakeParticipantStatus("P1", Services::Orchestration::ParticipantState::ServicesCreated)));
+    service.Enqueue(
+        SilKitEvent({}, MakeParticipantStatus("P2", Services::Orchestration::ParticipantState::ServicesCreated)));
+    service.Enqueue(SilKitEvent({}, MakeParticipantStatus("P1", Services::Orchestration::ParticipantState::Running)));
+    // evicts the superseded status of P1
+    service.Enqueue(SilKitEvent({}, Services::Orchestration::ParticipantConnectionInformation{}));
+    // the latest status of each participant is kept, dropped
+    service.Enqueue(SilKitEvent({}, Services::Orchestration::ParticipantConnectionInformation{}));
+    // the end of a simulation is never dropped
+    service.Enqueue(SilKitEvent({}, SimulationEnd{456789}));
+
+    std::vector<SilKitEvent> events;
+    service.DequeueAllInto(events);
+
+    // Assert
+    ASSERT_EQ(service.GetDroppedEventCount(), 2u) << "Wrong dropped event count!";
+    ASSERT_EQ(events.size(), 5u) << "Wrong event count!";
+    ASSERT_EQ(events[0].Type(), SilKitEventType::OnSimulationStart);
+    ASSERT_EQ(events[1].Type(), SilKitEventType::OnParticipantStatusChanged);
+    ASSERT_EQ(events[1].GetParticipantStatus().participantName, "P2");
+    ASSERT_EQ(events[2].Type(), SilKitEventType::OnParticipantStatusChanged);
+    ASSERT_EQ(events[2].GetParticipantStatus().participantName, "P1");
+    ASSERT_EQ(events[2].GetParticipantStatus().state, Services::Orchestration::ParticipantState::Running);
+    ASSERT_EQ(events[3].Type(), SilKitEventType::OnParticipantConnected);
+    ASSERT_EQ(events[4].Type(), SilKitEventType::OnSimulationEnd);
+}
+
+TEST_F(Test_DashboardSilKitEventQueue, FullQueueReplacesQueuedStatusOfSameParticipant)
+{
+    // Arrange
+    SilKitEventQueue service{2};
+
+    // Act
+    service.Enqueue(SilKitEvent({}, Services::Orchestration::SystemState::ServicesCreated));
+    service.Enqueue(
+        SilKitEvent({}, MakeParticipantStatus("P1", Services::Orchestration::ParticipantState::ServicesCreated)));
+    // replaces the queued system state
+    service.Enqueue(SilKitEvent({}, Services::Orchestration::SystemState::Running));
+    // no newer status for P2 is queued, dropped
+    service.Enqueue(SilKitEvent({}, MakeParticipantStatus("P2", Services::Orchestration::ParticipantState::Running)));
+
+    std::vector<SilKitEvent> events;
+    service.DequeueAllInto(events);
+
+    // Assert
+    ASSERT_EQ(service.GetDroppedEventCount(), 2u) << "Wrong dropped event count!";
+    ASSERT_EQ(events.size(), 2u) << "Wrong event count!";
+    ASSERT_EQ(events[0].Type(), SilKitEventType::OnParticipantStatusChanged);
+    ASSERT_EQ(events[0].GetParticipantStatus().participantName, "P1");
+    ASSERT_EQ(events[1].Type(), SilKitEventType::OnSystemStateChanged);
+    ASSERT_EQ(events[1].GetSystemState(), Services::Orchestration::SystemState::Running);
+}
+
 } // namespace Dashboard
 } // namespace SilKit
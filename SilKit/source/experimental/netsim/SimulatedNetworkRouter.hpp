@@ -73,12 +73,14 @@ public:
     template <typename SilKitMessageT>
     void SendMsg(SilKitMessageT&& msg, const SilKit::Util::Span<const ControllerDescriptor>& receivers)
     {
+        std::vector<Core::MessageTarget> targets;
+        targets.reserve(receivers.size());
         for (const auto& receiver : receivers)
         {
             auto targetController = _targetControllers.find(receiver);
             if (targetController != _targetControllers.end())
             {
-                _participant->SendMsg(targetController->second.get(), targetController->second->participantName, msg);
+                targets.push_back({targetController->second.get(), targetController->second->participantName});
             }
             else
             {
@@ -86,6 +88,16 @@ public:
                                                 + "'");
             }
         }
+
+        if (targets.size() == 1)
+        {
+            _participant->SendMsg(targets.front().from, targets.front().participantName, msg);
+        }
+        else if (!targets.empty())
+        {
+            // Send to all receivers at once, the message is serialized only once
+            _participant->SendMsg(std::move(targets), msg);
+        }
     }
 
     // IServiceEndpoint
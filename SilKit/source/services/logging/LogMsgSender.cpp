@@ -40,6 +40,11 @@ void LogMsgSender::SendLogMsg(LogMsg&& msg)
     _participant->SendMsg(this, std::move(msg));
 }
 
+void LogMsgSender::SendLogMsgs(std::vector<LogMsg>&& msgs)
+{
+    _participant->SendMsg(this, std::move(msgs));
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
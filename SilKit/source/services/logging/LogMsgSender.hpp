@@ -41,6 +41,8 @@ public:
 public:
     void SendLogMsg(const LogMsg& msg);
     void SendLogMsg(LogMsg&& msg);
+    //! \brief Sends the records in order, handing them to the connection as a single unit.
+    void SendLogMsgs(std::vector<LogMsg>&& msgs);
 
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
@@ -19,6 +19,7 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -36,6 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "spdlog/sinks/basic_file_sink.h"
 
 #include "SpdlogTypeConversion.hpp"
+#include "RemoteLogBuffer.hpp"
 
 
 namespace SilKit {
@@ -47,14 +49,46 @@ class SilKitRemoteSink : public spdlog::sinks::base_sink<spdlog::details::null_m
 {
 public:
     SilKitRemoteSink() = delete;
-    SilKitRemoteSink(const Logger::LogMsgHandler& handler)
+    SilKitRemoteSink(const Logger::LogMsgHandler& handler, uint32_t rateLimit)
         : _logMsgHandler{handler}
+        , _rateLimiter{rateLimit}
+    {
+    }
+
+    SilKitRemoteSink(std::unique_ptr<RemoteLogBuffer> buffer, uint32_t rateLimit)
+        : _buffer{std::move(buffer)}
+        , _rateLimiter{rateLimit}
     {
     }
 
     void Disable()
     {
         _is_disabled = true;
+        if (_buffer)
+        {
+            _buffer->Stop();
+        }
+    }
+
+    void Flush()
+    {
+        if (_buffer)
+        {
+            _buffer->Flush();
+        }
+    }
+
+    auto GetStatistics() const -> Logger::RemoteLoggingStatistics
+    {
+        Logger::RemoteLoggingStatistics statistics;
+        statistics.rateLimitedRecords = _rateLimitedRecords.load();
+        if (_buffer)
+        {
+            statistics.queueDepth = _buffer->GetQueueDepth();
+            statistics.droppedRecords = _buffer->GetDroppedRecordCount();
+            statistics.sentBatches = _buffer->GetSentBatchCount();
+        }
+        return statistics;
     }
 
 protected:
@@ -64,6 +98,19 @@ protected:
         if (_is_disabled)
             return;
 
+        if (!_rateLimiter.TryAcquire())
+        {
+            ++_rateLimitedRecords;
+            return;
+        }
+
+        if (_buffer)
+        {
+            // the buffer ignores records logged by its own flusher thread
+            _buffer->Push(from_spdlog(msg));
+            return;
+        }
+
         _is_disabled = true;
         _logMsgHandler(from_spdlog(msg));
         _is_disabled = false;
@@ -73,7 +120,10 @@ protected:
 
 private:
     Logger::LogMsgHandler _logMsgHandler;
-    bool _is_disabled{false};
+    std::unique_ptr<RemoteLogBuffer> _buffer;
+    LogRateLimiter _rateLimiter;
+    std::atomic<std::size_t> _rateLimitedRecords{0};
+    std::atomic<bool> _is_disabled{false};
 };
 } // anonymous namespace
 
@@ -181,12 +231,47 @@ void Logger::RegisterRemoteLogging(const LogMsgHandler& handler)
 
     if (remoteSinkRef != _config.sinks.end())
     {
-        _remoteSink = std::make_shared<SilKitRemoteSink>(handler);
+        _remoteSink = std::make_shared<SilKitRemoteSink>(handler, remoteSinkRef->rateLimit);
         _remoteSink->set_level(to_spdlog(remoteSinkRef->level));
         _logger->sinks().push_back(_remoteSink);
     }
 }
 
+void Logger::RegisterBatchedRemoteLogging(const LogMsgBatchHandler& handler)
+{
+    auto remoteSinkRef = std::find_if(_config.sinks.begin(), _config.sinks.end(),
+                                      [](const Config::Sink& sink) { return sink.type == Config::Sink::Type::Remote; });
+
+    if (remoteSinkRef == _config.sinks.end())
+    {
+        return;
+    }
+
+    if (remoteSinkRef->queueSize == 0)
+    {
+        RegisterRemoteLogging([handler](LogMsg msg) {
+            std::vector<LogMsg> batch;
+            batch.emplace_back(std::move(msg));
+            handler(std::move(batch));
+        });
+        return;
+    }
+
+    auto buffer = std::make_unique<RemoteLogBuffer>(handler, remoteSinkRef->queueSize);
+    _remoteSink = std::make_shared<SilKitRemoteSink>(std::move(buffer), remoteSinkRef->rateLimit);
+    _remoteSink->set_level(to_spdlog(remoteSinkRef->level));
+    _logger->sinks().push_back(_remoteSink);
+}
+
+void Logger::FlushRemoteLogging()
+{
+    auto* remoteSink = dynamic_cast<SilKitRemoteSink*>(_remoteSink.get());
+    if (remoteSink)
+    {
+        remoteSink->Flush();
+    }
+}
+
 void Logger::DisableRemoteLogging()
 {
     for (auto sink : _logger->sinks())
@@ -199,6 +284,16 @@ void Logger::DisableRemoteLogging()
     }
 }
 
+auto Logger::GetRemoteLoggingStatistics() const -> RemoteLoggingStatistics
+{
+    auto* remoteSink = dynamic_cast<SilKitRemoteSink*>(_remoteSink.get());
+    if (remoteSink)
+    {
+        return remoteSink->GetStatistics();
+    }
+    return {};
+}
+
 void Logger::LogReceivedMsg(const LogMsg& msg)
 {
     auto spdlog_msg = to_spdlog(msg);
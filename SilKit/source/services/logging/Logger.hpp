@@ -21,8 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <functional>
+#include <vector>
 
 #include "silkit/services/logging/LoggingDatatypes.hpp"
 
@@ -46,6 +48,19 @@ class Logger : public ILogger
 {
 public:
     using LogMsgHandler = std::function<void(LogMsg)>;
+    using LogMsgBatchHandler = std::function<void(std::vector<LogMsg>)>;
+
+    struct RemoteLoggingStatistics
+    {
+        //! Records waiting for the background sender
+        std::size_t queueDepth{0};
+        //! Records discarded because the send queue was full
+        std::size_t droppedRecords{0};
+        //! Records discarded because they exceeded the configured rate limit
+        std::size_t rateLimitedRecords{0};
+        //! Batches handed to the batch handler
+        std::size_t sentBatches{0};
+    };
 
 public:
     // ----------------------------------------
@@ -70,8 +85,16 @@ public:
 
     void Critical(const std::string& msg) override;
 
+    //! \brief Sends every record synchronously from the logging thread.
     void RegisterRemoteLogging(const LogMsgHandler& handler);
+    //! \brief Queues records and sends them in batches from a background thread, unless the remote sink's QueueSize
+    //         is 0, in which case every record is sent synchronously as a batch of one.
+    void RegisterBatchedRemoteLogging(const LogMsgBatchHandler& handler);
+    //! \brief Blocks until all queued records have been handed to the batch handler.
+    void FlushRemoteLogging();
+    //! \brief Sends the queued records and stops remote logging.
     void DisableRemoteLogging();
+    auto GetRemoteLoggingStatistics() const -> RemoteLoggingStatistics;
     void LogReceivedMsg(const LogMsg& msg);
 
     Level GetLogLevel() const override;
@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "RemoteLogBuffer.hpp"
+
+#include <algorithm>
+
+#include "fmt/format.h"
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+namespace {
+
+// Set on a flusher thread: records logged while a batch is sent must not feed back into the same buffer.
+thread_local const RemoteLogBuffer* tlsFlushingBuffer{nullptr};
+
+} // namespace
+
+LogRateLimiter::LogRateLimiter(uint32_t recordsPerSecond)
+    : _recordsPerSecond{static_cast<double>(recordsPerSecond)}
+    , _tokens{static_cast<double>(recordsPerSecond)}
+    , _lastRefill{Clock::now()}
+{
+}
+
+bool LogRateLimiter::TryAcquire()
+{
+    if (_recordsPerSecond <= 0.0)
+    {
+        return true;
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    const auto now = Clock::now();
+    const std::chrono::duration<double> elapsed = now - _lastRefill;
+    _lastRefill = now;
+    _tokens = std::min(_recordsPerSecond, _tokens + elapsed.count() * _recordsPerSecond);
+
+    if (_tokens < 1.0)
+    {
+        return false;
+    }
+
+    _tokens -= 1.0;
+    return true;
+}
+
+RemoteLogBuffer::RemoteLogBuffer(BatchHandler handler, std::size_t capacity, std::chrono::milliseconds flushInterval)
+    : _handler{std::move(handler)}
+    , _flushInterval{flushInterval}
+    , _ring(std::max<std::size_t>(capacity, 1))
+{
+    _flusherThread = std::thread{[this] { FlusherLoop(); }};
+}
+
+RemoteLogBuffer::~RemoteLogBuffer()
+{
+    Stop();
+}
+
+void RemoteLogBuffer::Push(LogMsg msg)
+{
+    if (tlsFlushingBuffer == this)
+    {
+        return;
+    }
+
+    bool wakeFlusher{false};
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_stopped)
+        {
+            return;
+        }
+
+        if (_count == _ring.size())
+        {
+            ++_droppedRecords;
+            return;
+        }
+
+        _ring[(_head + _count) % _ring.size()] = std::move(msg);
+        ++_count;
+        _queueDepth = _count;
+
+        // the flusher waits for the first record, and is woken early once half of the buffer is used
+        wakeFlusher = _count == 1 || _count == _ring.size() / 2;
+    }
+
+    if (wakeFlusher)
+    {
+        _recordsAvailable.notify_one();
+    }
+}
+
+void RemoteLogBuffer::Flush()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (tlsFlushingBuffer == this)
+    {
+        return;
+    }
+
+    ++_flushWaiters;
+    _recordsAvailable.notify_one();
+    _drained.wait(lock, [this] { return _stopped || (_count == 0 && !_batchInFlight); });
+    --_flushWaiters;
+}
+
+void RemoteLogBuffer::Stop()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_stopped)
+        {
+            return;
+        }
+        _stopped = true;
+    }
+
+    _recordsAvailable.notify_all();
+
+    if (_flusherThread.joinable())
+    {
+        _flusherThread.join();
+    }
+
+    _drained.notify_all();
+}
+
+auto RemoteLogBuffer::GetQueueDepth() const -> std::size_t
+{
+    return _queueDepth.load();
+}
+
+auto RemoteLogBuffer::GetDroppedRecordCount() const -> std::size_t
+{
+    return _droppedRecords.load();
+}
+
+auto RemoteLogBuffer::GetSentBatchCount() const -> std::size_t
+{
+    return _sentBatches.load();
+}
+
+void RemoteLogBuffer::FlusherLoop()
+{
+    tlsFlushingBuffer = this;
+
+    while (true)
+    {
+        std::vector<LogMsg> batch;
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _recordsAvailable.wait(lock, [this] { return _stopped || _count > 0; });
+
+            // let a burst of records accumulate, so it is sent as one batch
+            _recordsAvailable.wait_for(lock, _flushInterval, [this] {
+                return _stopped || _flushWaiters > 0 || _count >= _ring.size() / 2;
+            });
+
+            if (_count == 0)
+            {
+                // stopped and drained
+                return;
+            }
+
+            batch = TakeBatch();
+            _batchInFlight = true;
+        }
+
+        AppendDropNotice(batch);
+
+        try
+        {
+            _handler(std::move(batch));
+        }
+        catch (...)
+        {
+            // the records are lost, reporting the error through the logger would end up here again
+        }
+        ++_sentBatches;
+
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _batchInFlight = false;
+        }
+        _drained.notify_all();
+    }
+}
+
+auto RemoteLogBuffer::TakeBatch() -> std::vector<LogMsg>
+{
+    std::vector<LogMsg> batch;
+    batch.reserve(_count + 1);
+
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+        batch.emplace_back(std::move(_ring[(_head + i) % _ring.size()]));
+    }
+
+    _head = (_head + _count) % _ring.size();
+    _count = 0;
+    _queueDepth = 0;
+
+    return batch;
+}
+
+void RemoteLogBuffer::AppendDropNotice(std::vector<LogMsg>& batch)
+{
+    const auto droppedRecords = _droppedRecords.load();
+    if (droppedRecords == _reportedDroppedRecords || batch.empty())
+    {
+        return;
+    }
+
+    LogMsg notice;
+    notice.logger_name = batch.back().logger_name;
+    notice.level = Level::Warn;
+    notice.time = log_clock::now();
+    notice.payload = fmt::format("Remote logging dropped {} log messages because the send queue was full",
+                                 droppedRecords - _reportedDroppedRecords);
+    batch.emplace_back(std::move(notice));
+
+    _reportedDroppedRecords = droppedRecords;
+}
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
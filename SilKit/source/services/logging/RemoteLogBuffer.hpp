@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LoggingDatatypesInternal.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+//! \brief Token bucket limiting the number of records per second, with a burst of one second's worth of records.
+class LogRateLimiter
+{
+public:
+    //! \brief A rate of 0 lets every record pass.
+    explicit LogRateLimiter(uint32_t recordsPerSecond);
+
+    //! \brief Returns false if the record exceeds the rate and must be discarded.
+    bool TryAcquire();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const double _recordsPerSecond;
+    std::mutex _mutex;
+    double _tokens;
+    Clock::time_point _lastRefill;
+};
+
+//! \brief Bounded ring buffer of log records, drained in batches by a background flusher thread.
+//         Logging never waits for the network: records that do not fit into the buffer are dropped and counted.
+class RemoteLogBuffer
+{
+public:
+    using BatchHandler = std::function<void(std::vector<LogMsg>)>;
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    RemoteLogBuffer(BatchHandler handler, std::size_t capacity,
+                    std::chrono::milliseconds flushInterval = std::chrono::milliseconds{10});
+    RemoteLogBuffer(const RemoteLogBuffer&) = delete;
+    RemoteLogBuffer& operator=(const RemoteLogBuffer&) = delete;
+    ~RemoteLogBuffer();
+
+    // ----------------------------------------
+    // Public methods
+
+    //! \brief Queues the record, or drops it if the buffer is full or stopped.
+    void Push(LogMsg msg);
+
+    //! \brief Blocks until all records queued so far have been handed to the batch handler.
+    void Flush();
+
+    //! \brief Hands the remaining records to the batch handler and stops the flusher thread. Further records are
+    //         ignored.
+    void Stop();
+
+    auto GetQueueDepth() const -> std::size_t;
+    auto GetDroppedRecordCount() const -> std::size_t;
+    auto GetSentBatchCount() const -> std::size_t;
+
+private:
+    // ----------------------------------------
+    // Private methods
+    void FlusherLoop();
+    auto TakeBatch() -> std::vector<LogMsg>;
+    void AppendDropNotice(std::vector<LogMsg>& batch);
+
+private:
+    // ----------------------------------------
+    // Private members
+    BatchHandler _handler;
+    const std::chrono::milliseconds _flushInterval;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _recordsAvailable;
+    std::condition_variable _drained;
+    std::vector<LogMsg> _ring;
+    std::size_t _head{0};
+    std::size_t _count{0};
+    std::size_t _flushWaiters{0};
+    bool _batchInFlight{false};
+    bool _stopped{false};
+
+    std::atomic<std::size_t> _queueDepth{0};
+    std::atomic<std::size_t> _droppedRecords{0};
+    std::atomic<std::size_t> _sentBatches{0};
+    std::size_t _reportedDroppedRecords{0};
+
+    std::thread _flusherThread;
+};
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -20,8 +20,11 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -126,6 +129,145 @@ TEST(Test_Logger, send_log_message_from_logger)
     logger.Critical(payload);
 }
 
+// Collects the batches handed over by the remote sink; sending can be held back to let the queue fill up.
+struct BatchRecorder
+{
+    void Receive(std::vector<LogMsg> batch)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        batches.emplace_back(std::move(batch));
+        batchReceived.notify_all();
+        sendAllowed.wait(lock, [this] { return !holdSends; });
+    }
+
+    void WaitForBatches(std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        batchReceived.wait(lock, [this, count] { return batches.size() >= count; });
+    }
+
+    void ReleaseSends()
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            holdSends = false;
+        }
+        sendAllowed.notify_all();
+    }
+
+    auto Payloads() -> std::vector<std::string>
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        std::vector<std::string> payloads;
+        for (const auto& batch : batches)
+        {
+            for (const auto& msg : batch)
+            {
+                payloads.push_back(msg.payload);
+            }
+        }
+        return payloads;
+    }
+
+    std::mutex mutex;
+    std::condition_variable batchReceived;
+    std::condition_variable sendAllowed;
+    bool holdSends{false};
+    std::vector<std::vector<LogMsg>> batches;
+};
+
+auto MakeRemoteLoggingConfig(uint32_t queueSize, uint32_t rateLimit) -> Config::Logging
+{
+    Config::Logging config;
+    auto sink = Config::Sink{};
+    sink.level = Level::Debug;
+    sink.type = Config::Sink::Type::Remote;
+    sink.queueSize = queueSize;
+    sink.rateLimit = rateLimit;
+    config.sinks.push_back(sink);
+    return config;
+}
+
+TEST(Test_Logger, send_log_messages_in_batches_from_logger)
+{
+    Logger logger{"ParticipantAndLogger", MakeRemoteLoggingConfig(1024, 0)};
+
+    BatchRecorder recorder;
+    logger.RegisterBatchedRemoteLogging([&recorder](std::vector<LogMsg> batch) { recorder.Receive(std::move(batch)); });
+
+    std::vector<std::string> expectedPayloads;
+    for (auto i = 0; i < 100; ++i)
+    {
+        expectedPayloads.push_back("Test log message " + std::to_string(i));
+        logger.Info(expectedPayloads.back());
+    }
+    logger.FlushRemoteLogging();
+
+    EXPECT_EQ(recorder.Payloads(), expectedPayloads);
+
+    const auto statistics = logger.GetRemoteLoggingStatistics();
+    EXPECT_EQ(statistics.sentBatches, recorder.batches.size());
+    EXPECT_LT(statistics.sentBatches, expectedPayloads.size());
+    EXPECT_EQ(statistics.queueDepth, 0u);
+    EXPECT_EQ(statistics.droppedRecords, 0u);
+
+    logger.DisableRemoteLogging();
+}
+
+TEST(Test_Logger, full_queue_drops_log_messages_and_reports_them)
+{
+    Logger logger{"ParticipantAndLogger", MakeRemoteLoggingConfig(4, 0)};
+
+    BatchRecorder recorder;
+    recorder.holdSends = true;
+    logger.RegisterBatchedRemoteLogging([&recorder](std::vector<LogMsg> batch) { recorder.Receive(std::move(batch)); });
+
+    logger.Info("first");
+    recorder.WaitForBatches(1);
+
+    // the flusher is blocked sending the first batch, only four of these fit into the queue
+    for (auto i = 0; i < 10; ++i)
+    {
+        logger.Info("burst");
+    }
+    EXPECT_EQ(logger.GetRemoteLoggingStatistics().queueDepth, 4u);
+    EXPECT_EQ(logger.GetRemoteLoggingStatistics().droppedRecords, 6u);
+
+    recorder.ReleaseSends();
+    logger.FlushRemoteLogging();
+
+    ASSERT_EQ(recorder.batches.size(), 2u);
+    ASSERT_EQ(recorder.batches[1].size(), 5u);
+    const auto& notice = recorder.batches[1].back();
+    EXPECT_EQ(notice.level, Level::Warn);
+    EXPECT_EQ(notice.logger_name, "ParticipantAndLogger");
+    EXPECT_THAT(notice.payload, HasSubstr("dropped 6 log messages"));
+
+    logger.DisableRemoteLogging();
+}
+
+TEST(Test_Logger, rate_limit_discards_log_messages)
+{
+    // a queue size of 0 sends synchronously, as batches of one record
+    Logger logger{"ParticipantAndLogger", MakeRemoteLoggingConfig(0, 5)};
+
+    BatchRecorder recorder;
+    logger.RegisterBatchedRemoteLogging([&recorder](std::vector<LogMsg> batch) { recorder.Receive(std::move(batch)); });
+
+    const std::size_t numMessages = 50;
+    for (std::size_t i = 0; i < numMessages; ++i)
+    {
+        logger.Info("Test log message");
+    }
+
+    const auto statistics = logger.GetRemoteLoggingStatistics();
+    const auto sentMessages = recorder.Payloads().size();
+    EXPECT_GE(sentMessages, 5u);
+    EXPECT_LT(sentMessages, numMessages);
+    EXPECT_EQ(sentMessages, recorder.batches.size());
+    EXPECT_EQ(sentMessages + statistics.rateLimitedRecords, numMessages);
+}
+
 TEST(Test_Logger, get_log_level)
 {
     std::string loggerName{"ParticipantAndLogger"};
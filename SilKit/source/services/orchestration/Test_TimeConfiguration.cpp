@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "MockLogger.hpp"
+
+#include "TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace testing;
+
+using namespace SilKit::Services::Orchestration;
+
+using SilKit::Services::Logging::MockLogger;
+
+auto MakeNextSimTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+TEST(Test_TimeConfiguration, lowest_other_time_point_blocks_time_advance)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration timeConfiguration{&logger};
+    timeConfiguration.SetStepDuration(1ms);
+
+    EXPECT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.AddSynchronizedParticipant("A");
+    timeConfiguration.AddSynchronizedParticipant("B");
+
+    // the initial time point of other participants is unknown
+    timeConfiguration.AdvanceTimeStep();
+    EXPECT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("A", MakeNextSimTask(1ms));
+    EXPECT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("B", MakeNextSimTask(3ms));
+    EXPECT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.AdvanceTimeStep();
+    EXPECT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("A", MakeNextSimTask(2ms));
+    EXPECT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, removed_participant_does_not_block_time_advance)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration timeConfiguration{&logger};
+    timeConfiguration.SetStepDuration(1ms);
+
+    timeConfiguration.AddSynchronizedParticipant("A");
+    timeConfiguration.AddSynchronizedParticipant("B");
+    timeConfiguration.AdvanceTimeStep();
+    timeConfiguration.OnReceiveNextSimStep("B", MakeNextSimTask(5ms));
+    EXPECT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    EXPECT_TRUE(timeConfiguration.RemoveSynchronizedParticipant("A"));
+    EXPECT_FALSE(timeConfiguration.RemoveSynchronizedParticipant("A"));
+    EXPECT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+    EXPECT_THAT(timeConfiguration.GetSynchronizedParticipantNames(), ElementsAre("B"));
+
+    // a participant which joins again starts with an unknown time point
+    timeConfiguration.AddSynchronizedParticipant("C");
+    timeConfiguration.AddSynchronizedParticipant("A");
+    EXPECT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+    EXPECT_THAT(timeConfiguration.GetSynchronizedParticipantNames(), ElementsAre("A", "B", "C"));
+}
+
+TEST(Test_TimeConfiguration, unknown_participant_is_ignored)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration timeConfiguration{&logger};
+    timeConfiguration.SetStepDuration(1ms);
+    timeConfiguration.AdvanceTimeStep();
+
+    EXPECT_CALL(logger, Log(SilKit::Services::Logging::Level::Error, _)).Times(1);
+    timeConfiguration.OnReceiveNextSimStep("Unknown", MakeNextSimTask(0ms));
+    EXPECT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, matches_linear_scan_for_many_participants)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration timeConfiguration{&logger};
+    timeConfiguration.SetStepDuration(1ms);
+
+    std::mt19937 random{42};
+    std::map<std::string, std::chrono::nanoseconds> otherTimePoints;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto name = "P" + std::to_string(i);
+        timeConfiguration.AddSynchronizedParticipant(name);
+        otherTimePoints[name] = -1ns;
+    }
+
+    for (int step = 0; step < 5000; ++step)
+    {
+        auto it = std::next(otherTimePoints.begin(), random() % otherTimePoints.size());
+
+        switch (random() % 20)
+        {
+        case 0:
+            // re-join with an unknown time point
+            timeConfiguration.RemoveSynchronizedParticipant(it->first);
+            timeConfiguration.AddSynchronizedParticipant(it->first);
+            it->second = -1ns;
+            break;
+        case 1:
+            timeConfiguration.AdvanceTimeStep();
+            break;
+        default:
+            it->second = std::max(it->second, 0ns) + std::chrono::milliseconds{random() % 3};
+            timeConfiguration.OnReceiveNextSimStep(it->first, MakeNextSimTask(it->second));
+            break;
+        }
+
+        const auto myNextTimePoint = timeConfiguration.NextSimStep().timePoint;
+        const auto expected = std::any_of(otherTimePoints.begin(), otherTimePoints.end(), [&](const auto& entry) {
+            return myNextTimePoint > entry.second;
+        });
+        ASSERT_EQ(timeConfiguration.OtherParticipantHasLowerTimepoint(), expected) << "step " << step;
+    }
+}
+
+} // namespace
@@ -19,9 +19,11 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <string>
+#include <thread>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -66,4 +68,57 @@ TEST(Test_TimeProvider, check_handlers)
     timeProvider.SetTime(2ms, 0ms); //implicitly invoke handler
     ASSERT_EQ(invocationCount, 1) << "Only the first SetTime should trigger the handler";
 }
+
+TEST(Test_TimeProvider, now_follows_the_current_provider)
+{
+    TimeProvider timeProvider{};
+    EXPECT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+    std::chrono::nanoseconds nowInHandler{};
+    timeProvider.AddNextSimStepHandler([&timeProvider, &nowInHandler](auto, auto) {
+        nowInHandler = timeProvider.Now();
+    });
+    timeProvider.SetTime(5ms, 1ms);
+    EXPECT_EQ(nowInHandler, 5ms) << "The new time must be visible to the handlers";
+    EXPECT_EQ(timeProvider.Now(), 5ms);
+
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::WallClock);
+    EXPECT_GT(timeProvider.Now(), 5ms);
+
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::NoSync);
+    EXPECT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+}
+
+TEST(Test_TimeProvider, now_is_monotonic_while_time_advances_concurrently)
+{
+    TimeProvider timeProvider{};
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+    timeProvider.SetTime(0ms, 1ms);
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> monotonic{true};
+    std::thread reader{[&] {
+        auto last = timeProvider.Now();
+        while (!done)
+        {
+            const auto now = timeProvider.Now();
+            if (now < last)
+            {
+                monotonic = false;
+            }
+            last = now;
+        }
+    }};
+
+    for (auto i = 1; i <= 10000; ++i)
+    {
+        timeProvider.SetTime(std::chrono::milliseconds{i}, 1ms);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(timeProvider.Now(), 10000ms);
+}
 } // namespace
@@ -19,9 +19,12 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <string>
+#include <thread>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -161,4 +164,36 @@ TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
     ASSERT_EQ(numAsyncTaskCalled, 3) << "Calling too many CompleteSimulationStep() should not wreak havoc";
 }
 
+TEST_F(Test_TimeSyncService, sim_step_thread_executes_simtask)
+{
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), true);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    std::atomic<int> numSimTaskCalled{0};
+    std::promise<std::thread::id> simTaskThreadId;
+    timeSyncService->SetSimulationStepHandler(
+        [&numSimTaskCalled, &simTaskThreadId](auto now, auto) {
+        numSimTaskCalled++;
+        if (now == 0ms)
+        {
+            simTaskThreadId.set_value(std::this_thread::get_id());
+        }
+    }, 1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+
+    auto simTaskThreadIdFuture = simTaskThreadId.get_future();
+    ASSERT_EQ(simTaskThreadIdFuture.wait_for(5s), std::future_status::ready);
+    EXPECT_NE(simTaskThreadIdFuture.get(), std::this_thread::get_id())
+        << "The SimulationStepHandler should not be executed on the thread which receives the NextSimTask messages";
+
+    // no sim steps are executed after the sim step thread was stopped
+    timeSyncService->StopSimStepThread();
+    timeSyncService->ReceiveMsg(&endpoint, {1ms});
+    EXPECT_EQ(numSimTaskCalled, 1);
+}
+
 } // namespace
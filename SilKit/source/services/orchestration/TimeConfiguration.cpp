@@ -22,10 +22,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TimeConfiguration.hpp"
 #include "ILogger.hpp"
 
+#include <algorithm>
+
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+constexpr size_t TimeConfiguration::InvalidHeapPosition;
+
 TimeConfiguration::TimeConfiguration(Logging::ILogger* logger)
     : _blocking(false)
     , _logger(logger)
@@ -44,25 +48,46 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
 void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         // ignore already known participants
         return;
     }
-    NextSimTask task;
-    task.timePoint = -1ns;
-    task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+
+    size_t index;
+    if (_freeIndices.empty())
+    {
+        index = _otherParticipants.size();
+        _otherParticipants.emplace_back();
+    }
+    else
+    {
+        index = _freeIndices.back();
+        _freeIndices.pop_back();
+    }
+
+    auto& otherParticipant = _otherParticipants[index];
+    otherParticipant.name = otherParticipantName;
+    otherParticipant.nextTask.timePoint = -1ns;
+    otherParticipant.nextTask.duration = 0ns;
+
+    _otherParticipantIndices.emplace(otherParticipantName, index);
+    HeapInsert(index);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _otherParticipantIndices.find(otherParticipantName);
+    if (it != _otherParticipantIndices.end())
     {
-        _otherNextTasks.erase(it);
+        const auto index = it->second;
+        _otherParticipantIndices.erase(it);
+
+        HeapErase(index);
+        _otherParticipants[index].name.clear();
+        _freeIndices.push_back(index);
         return true;
     }
     return false;
@@ -70,11 +95,14 @@ bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherPa
 
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
+    Lock lock{_mx};
     std::vector<std::string> participantNames;
-    for (auto const& it : _otherNextTasks)
+    participantNames.reserve(_otherParticipantIndices.size());
+    for (auto const& it : _otherParticipantIndices)
     {
         participantNames.push_back(it.first);
     }
+    std::sort(participantNames.begin(), participantNames.end());
     return participantNames;
 }
 
@@ -82,23 +110,28 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    auto&& itIndex = _otherParticipantIndices.find(participantName);
+    if (itIndex == _otherParticipantIndices.end())
     {
         Logging::Error(_logger, "Received NextSimTask from unknown participant {}", participantName);
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    const auto index = itIndex->second;
+    auto& otherNextTask = _otherParticipants[index].nextTask;
+
+    if (nextStep.timePoint < otherNextTask.timePoint)
     {
         Logging::Error(
             _logger,
             "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
             "known timePoint {}",
-            participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+            participantName, nextStep.timePoint.count(), otherNextTask.timePoint.count());
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
+    otherNextTask = nextStep;
+    HeapUpdate(index);
+
     Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
                    nextStep.timePoint.count());
 }
@@ -106,16 +139,11 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
-    {
-        _otherNextTasks.erase(it);
-    }
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 {
@@ -146,14 +174,13 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    // the participant with the lowest next time point is at the top of the heap
+    if (!_nextTaskHeap.empty() && _myNextTask.timePoint > HeapTimePoint(0))
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-        {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
-            return true;
-        }
+        const auto& otherParticipant = _otherParticipants[_nextTaskHeap.front()];
+        Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherParticipant.name,
+              otherParticipant.nextTask.timePoint.count());
+        return true;
     }
     return false;
 }
@@ -182,15 +209,16 @@ bool TimeConfiguration::HandleHopOn()
         if (_currentTask.timePoint == -1ns) // On initial time
         {
             std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-            for (const auto& otherTask : _otherNextTasks)
+            for (const auto index : _nextTaskHeap)
             {
+                const auto& otherTask = _otherParticipants[index].nextTask;
                 // Any other participant has already advanced further that its duration -> HopOn
-                if (otherTask.second.timePoint > otherTask.second.duration)
+                if (otherTask.timePoint > otherTask.duration)
                 {
                     _hoppedOn = true;
-                    if (otherTask.second.timePoint < minimalOtherTime)
+                    if (otherTask.timePoint < minimalOtherTime)
                     {
-                        minimalOtherTime = otherTask.second.timePoint;
+                        minimalOtherTime = otherTask.timePoint;
                     }
                 }
             }
@@ -206,6 +234,88 @@ bool TimeConfiguration::HandleHopOn()
     return false;
 }
 
+void TimeConfiguration::HeapInsert(size_t index)
+{
+    _otherParticipants[index].heapPosition = _nextTaskHeap.size();
+    _nextTaskHeap.push_back(index);
+    HeapSiftUp(_nextTaskHeap.size() - 1);
+}
+
+void TimeConfiguration::HeapErase(size_t index)
+{
+    const auto position = _otherParticipants[index].heapPosition;
+    const auto last = _nextTaskHeap.size() - 1;
+
+    HeapSwap(position, last);
+    _nextTaskHeap.pop_back();
+    _otherParticipants[index].heapPosition = InvalidHeapPosition;
+
+    if (position < _nextTaskHeap.size())
+    {
+        HeapSiftUp(position);
+        HeapSiftDown(_otherParticipants[_nextTaskHeap[position]].heapPosition);
+    }
+}
+
+void TimeConfiguration::HeapUpdate(size_t index)
+{
+    // time points usually increase, but the chronology is not enforced
+    const auto position = _otherParticipants[index].heapPosition;
+    HeapSiftUp(position);
+    HeapSiftDown(_otherParticipants[index].heapPosition);
+}
+
+void TimeConfiguration::HeapSiftUp(size_t position)
+{
+    while (position > 0)
+    {
+        const auto parent = (position - 1) / 2;
+        if (HeapTimePoint(parent) <= HeapTimePoint(position))
+        {
+            return;
+        }
+        HeapSwap(parent, position);
+        position = parent;
+    }
+}
+
+void TimeConfiguration::HeapSiftDown(size_t position)
+{
+    const auto size = _nextTaskHeap.size();
+    while (true)
+    {
+        auto smallest = position;
+        const auto left = 2 * position + 1;
+        const auto right = left + 1;
+        if (left < size && HeapTimePoint(left) < HeapTimePoint(smallest))
+        {
+            smallest = left;
+        }
+        if (right < size && HeapTimePoint(right) < HeapTimePoint(smallest))
+        {
+            smallest = right;
+        }
+        if (smallest == position)
+        {
+            return;
+        }
+        HeapSwap(position, smallest);
+        position = smallest;
+    }
+}
+
+void TimeConfiguration::HeapSwap(size_t lhs, size_t rhs)
+{
+    std::swap(_nextTaskHeap[lhs], _nextTaskHeap[rhs]);
+    _otherParticipants[_nextTaskHeap[lhs]].heapPosition = lhs;
+    _otherParticipants[_nextTaskHeap[rhs]].heapPosition = rhs;
+}
+
+auto TimeConfiguration::HeapTimePoint(size_t position) const -> std::chrono::nanoseconds
+{
+    return _otherParticipants[_nextTaskHeap[position]].nextTask.timePoint;
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
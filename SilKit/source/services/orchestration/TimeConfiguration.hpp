@@ -21,8 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <string>
 #include <chrono>
-#include <map>
+#include <limits>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -57,12 +59,37 @@ public: //Methods
     // Returns true (only once) in the step the actual hop-on happened
     bool HandleHopOn();
 
+private: //Types
+    static constexpr size_t InvalidHeapPosition = std::numeric_limits<size_t>::max();
+
+    struct OtherParticipant
+    {
+        std::string name;
+        NextSimTask nextTask;
+        //! Position of this participant in _nextTaskHeap, InvalidHeapPosition if the slot is unused
+        size_t heapPosition{InvalidHeapPosition};
+    };
+
+private: //Methods
+    void HeapInsert(size_t index);
+    void HeapErase(size_t index);
+    void HeapUpdate(size_t index);
+    void HeapSiftUp(size_t position);
+    void HeapSiftDown(size_t position);
+    void HeapSwap(size_t lhs, size_t rhs);
+    auto HeapTimePoint(size_t position) const -> std::chrono::nanoseconds;
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    //! Synchronized participants, indexed by a dense id which is reused after a participant was removed
+    std::vector<OtherParticipant> _otherParticipants;
+    std::vector<size_t> _freeIndices;
+    std::unordered_map<std::string, size_t> _otherParticipantIndices;
+    //! Binary min-heap of the indices in _otherParticipants, ordered by the time point of their next task
+    std::vector<size_t> _nextTaskHeap;
     bool _blocking;
 
     bool _hoppedOn = false;
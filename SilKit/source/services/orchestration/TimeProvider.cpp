@@ -66,6 +66,16 @@ public:
     }
 
 protected:
+    void NotifyListenerAboutTimeChange(std::chrono::nanoseconds now)
+    {
+        if (!_active)
+        {
+            return;
+        }
+
+        _listener->OnTimeChanged(now);
+    }
+
     void NotifyListenerAboutTick(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
     {
         if (!_active)
@@ -97,10 +107,14 @@ public:
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) { NotifyListenerAboutTick(now, _tickPeriod); });
     }
 
+    bool IsWallclock() const override
+    {
+        return true;
+    }
+
     auto Now() const -> std::chrono::nanoseconds override
     {
-        const auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-        return now;
+        return WallclockNow();
     }
 
     void SetTime(std::chrono::nanoseconds, std::chrono::nanoseconds) override {}
@@ -124,6 +138,11 @@ public:
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) { NotifyListenerAboutTick(now, _tickPeriod); });
     }
 
+    bool IsWallclock() const override
+    {
+        return false;
+    }
+
     auto Now() const -> std::chrono::nanoseconds override
     {
         return DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC;
@@ -149,6 +168,11 @@ public:
 
     void OnHandlerAdded() override {}
 
+    bool IsWallclock() const override
+    {
+        return false;
+    }
+
     auto Now() const -> std::chrono::nanoseconds override
     {
         return _now;
@@ -157,6 +181,8 @@ public:
     void SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) override
     {
         _now = now;
+        // the new time must be visible to the handlers of the next simulation step
+        NotifyListenerAboutTimeChange(now);
         // tell our users about the next simulation step
         NotifyListenerAboutTick(now, duration);
     }
@@ -171,6 +197,7 @@ private:
 
 TimeProvider::TimeProvider()
     : _currentProvider{std::make_unique<NoSyncProvider>(static_cast<ITimeProviderImplListener&>(*this))}
+    , _now{DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC.count()}
 {
 }
 
@@ -210,6 +237,8 @@ void TimeProvider::ConfigureTimeProvider(Orchestration::TimeProviderKind timePro
             swap(_currentProvider, providerPtr);
 
             _currentProvider->SetActive(true);
+
+            PublishCurrentProvider();
         }
     }
 }
@@ -220,6 +249,24 @@ void TimeProvider::OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds
     _handlers.InvokeAll(now, duration);
 }
 
+void TimeProvider::OnTimeChanged(std::chrono::nanoseconds now)
+{
+    _now.store(now.count(), std::memory_order_release);
+}
+
+void TimeProvider::PublishCurrentProvider()
+{
+    if (_currentProvider->IsWallclock())
+    {
+        _nowIsWallclock.store(true, std::memory_order_release);
+        return;
+    }
+
+    // the time must be published before readers stop following the wall clock
+    _now.store(_currentProvider->Now().count(), std::memory_order_release);
+    _nowIsWallclock.store(false, std::memory_order_release);
+}
+
 
 } // namespace Orchestration
 } // namespace Services
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <memory>
@@ -42,6 +43,9 @@ struct ITimeProviderImpl
 
     virtual auto TimeProviderName() const -> const std::string& = 0;
 
+    //! \brief True if Now() follows the wall clock, instead of returning the last published time.
+    virtual bool IsWallclock() const = 0;
+
     virtual void SetActive(bool value) = 0;
 
     virtual void OnHandlerAdded() = 0;
@@ -56,8 +60,17 @@ struct ITimeProviderImplListener
     virtual ~ITimeProviderImplListener() = default;
 
     virtual void OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) = 0;
+
+    //! \brief Called by the active provider before its time is observable through Now().
+    virtual void OnTimeChanged(std::chrono::nanoseconds now) = 0;
 };
 
+//! \brief The current time of the wall clock provider.
+inline auto WallclockNow() -> std::chrono::nanoseconds
+{
+    return std::chrono::high_resolution_clock::now().time_since_epoch();
+}
+
 class TimeProvider
     : public ITimeProvider
     , private ITimeProviderImplListener
@@ -80,12 +93,20 @@ public:
 
 private:
     void OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) final;
+    void OnTimeChanged(std::chrono::nanoseconds now) final;
+
+    //! \brief Publishes the time of the current provider for Now(), must be called with the lock held.
+    void PublishCurrentProvider();
 
 private: //Members
     mutable std::recursive_mutex _mutex;
     Util::Handlers<NextSimStepHandler> _handlers;
-    bool _isSynchronizingVirtualTime{false};
+    std::atomic<bool> _isSynchronizingVirtualTime{false};
     std::unique_ptr<ITimeProviderImpl> _currentProvider;
+
+    // Snapshot of the current provider, so Now() neither locks nor calls into the provider
+    std::atomic<bool> _nowIsWallclock{false};
+    std::atomic<std::chrono::nanoseconds::rep> _now;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -95,8 +116,13 @@ private: //Members
 
 auto TimeProvider::Now() const -> std::chrono::nanoseconds
 {
-    std::unique_lock<decltype(_mutex)> lock{_mutex};
-    return _currentProvider->Now();
+    // NB: A provider switch publishes the time before the wall clock flag, the time read below is never older than
+    //     the provider which was observed.
+    if (_nowIsWallclock.load(std::memory_order_acquire))
+    {
+        return WallclockNow();
+    }
+    return std::chrono::nanoseconds{_now.load(std::memory_order_acquire)};
 }
 
 auto TimeProvider::TimeProviderName() const -> const std::string&
@@ -127,14 +153,12 @@ void TimeProvider::SetTime(std::chrono::nanoseconds now, std::chrono::nanosecond
 
 void TimeProvider::SetSynchronizeVirtualTime(bool isSynchronizingVirtualTime)
 {
-    std::unique_lock<decltype(_mutex)> lock{_mutex};
     _isSynchronizingVirtualTime = isSynchronizingVirtualTime;
 }
 
 bool TimeProvider::IsSynchronizingVirtualTime() const
 {
-    std::unique_lock<decltype(_mutex)> lock{_mutex};
-    return _isSynchronizingVirtualTime;
+    return _isSynchronizingVirtualTime.load(std::memory_order_acquire);
 }
 
 } // namespace Orchestration
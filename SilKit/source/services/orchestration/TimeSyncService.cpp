@@ -22,6 +22,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <functional>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "silkit/services/orchestration/string_utils.hpp"
 #include "silkit/services/orchestration/ISystemMonitor.hpp"
@@ -32,6 +35,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SynchronizedHandlers.hpp"
 #include "Assert.hpp"
 #include "VAsioCapabilities.hpp"
+#include "SetThreadName.hpp"
 
 using namespace std::chrono_literals;
 namespace SilKit {
@@ -47,6 +51,7 @@ public:
     virtual void SetSimStepCompleted() = 0;
     virtual void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) = 0;
     virtual void ProcessSimulationTimeUpdate() = 0;
+    virtual void StopSimStepThread() = 0;
 };
 
 //! brief Synchronization policy for unsynchronized participants
@@ -59,6 +64,7 @@ public:
     void SetSimStepCompleted() override {}
     void ReceiveNextSimTask(const Core::IServiceEndpoint* /*from*/, const NextSimTask& /*task*/) override {}
     void ProcessSimulationTimeUpdate() override {};
+    void StopSimStepThread() override {}
 };
 
 //! brief Synchronization policy of the VAsio middleware
@@ -66,11 +72,21 @@ struct SynchronizedPolicy : public ITimeSyncPolicy
 {
 public:
     SynchronizedPolicy(TimeSyncService& controller, Core::IParticipantInternal* participant,
-                       TimeConfiguration* configuration)
+                       TimeConfiguration* configuration, bool enableSimStepThread)
         : _controller(controller)
         , _participant(participant)
         , _configuration(configuration)
+        , _useSimStepThread(enableSimStepThread)
     {
+        if (_useSimStepThread)
+        {
+            _simStepThread = std::thread{[this] { RunSimStepThread(); }};
+        }
+    }
+
+    ~SynchronizedPolicy() override
+    {
+        StopSimStepThread();
     }
 
     void Initialize() override
@@ -127,6 +143,43 @@ public:
     }
 
     void ProcessSimulationTimeUpdate() override
+    {
+        if (_useSimStepThread)
+        {
+            // The sim step thread checks the conditions and executes the sim step, the caller (usually the I/O thread)
+            // continues to receive the messages for the next sim step in the meantime.
+            {
+                std::unique_lock<decltype(_simStepThreadMx)> lock{_simStepThreadMx};
+                if (_simStepThreadStopping)
+                {
+                    return;
+                }
+                _simulationTimeUpdatePending = true;
+            }
+            _simStepThreadCv.notify_one();
+            return;
+        }
+
+        ProcessSimulationTimeUpdateImpl();
+    }
+
+    void StopSimStepThread() override
+    {
+        {
+            std::unique_lock<decltype(_simStepThreadMx)> lock{_simStepThreadMx};
+            _simStepThreadStopping = true;
+        }
+        _simStepThreadCv.notify_one();
+
+        // a sim step which is currently executed is completed before the thread terminates
+        if (_simStepThread.joinable() && _simStepThread.get_id() != std::this_thread::get_id())
+        {
+            _simStepThread.join();
+        }
+    }
+
+private:
+    void ProcessSimulationTimeUpdateImpl()
     {
         // Check if we meet the conditions to trigger our local time advancement
         if (IsTimeAdvancePossible())
@@ -142,7 +195,36 @@ public:
         }
     }
 
-private:
+    void RunSimStepThread()
+    {
+        SilKit::Util::SetThreadName("SilKit-SimStep");
+
+        std::unique_lock<decltype(_simStepThreadMx)> lock{_simStepThreadMx};
+        while (true)
+        {
+            _simStepThreadCv.wait(lock, [this] { return _simulationTimeUpdatePending || _simStepThreadStopping; });
+            if (_simStepThreadStopping)
+            {
+                return;
+            }
+
+            // multiple updates signaled during a sim step are handled by a single check
+            _simulationTimeUpdatePending = false;
+            lock.unlock();
+
+            try
+            {
+                ProcessSimulationTimeUpdateImpl();
+            }
+            catch (const std::exception& error)
+            {
+                Logging::Error(_participant->GetLogger(), "SilKit-SimStep: Something went wrong: {}", error.what());
+            }
+
+            lock.lock();
+        }
+    }
+
     bool IsSimStepSync() const
     {
         return _configuration->IsBlocking();
@@ -234,16 +316,26 @@ private:
     TimeSyncService& _controller;
     Core::IParticipantInternal* _participant;
     TimeConfiguration* _configuration;
+    const bool _useSimStepThread;
+
+    // Optional thread which executes the sim steps instead of the thread which processes the time updates
+    std::mutex _simStepThreadMx;
+    std::condition_variable _simStepThreadCv;
+    bool _simulationTimeUpdatePending{false};
+    bool _simStepThreadStopping{false};
+    std::thread _simStepThread;
 };
 
 TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService)
+                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                                 bool enableSimStepThread)
     : _participant{participant}
     , _lifecycleService{lifecycleService}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _timeConfiguration{participant->GetLogger()}
     , _watchDog{healthCheckConfig}
+    , _enableSimStepThread{enableSimStepThread}
 {
     _watchDog.SetWarnHandler([logger = _logger](std::chrono::milliseconds timeout) {
         Warn(logger, "SimStep did not finish within soft time limit. Timeout detected after {} ms",
@@ -330,6 +422,27 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
     });
 }
 
+TimeSyncService::~TimeSyncService()
+{
+    // the sim step thread must not outlive the members it uses
+    StopSimStepThread();
+}
+
+void TimeSyncService::StopSimStepThread()
+{
+    std::shared_ptr<ITimeSyncPolicy> timeSyncPolicy;
+    {
+        std::unique_lock<decltype(_timeSyncPolicyMx)> lock{_timeSyncPolicyMx};
+        timeSyncPolicy = _timeSyncPolicy;
+    }
+
+    // NB: the running sim step might access the policy, do not hold the lock while waiting for it
+    if (timeSyncPolicy)
+    {
+        timeSyncPolicy->StopSimStepThread();
+    }
+}
+
 bool TimeSyncService::IsSynchronizingVirtualTime()
 {
     return _isSynchronizingVirtualTime;
@@ -386,7 +499,8 @@ bool TimeSyncService::SetupTimeSyncPolicy(bool isSynchronizingVirtualTime)
     _timeSyncConfigured = true;
     if (isSynchronizingVirtualTime)
     {
-        _timeSyncPolicy = std::make_shared<SynchronizedPolicy>(*this, _participant, &_timeConfiguration);
+        _timeSyncPolicy =
+            std::make_shared<SynchronizedPolicy>(*this, _participant, &_timeConfiguration, _enableSimStepThread);
     }
     else
     {
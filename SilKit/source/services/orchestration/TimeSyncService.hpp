@@ -61,7 +61,9 @@ public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
     TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService);
+                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                    bool enableSimStepThread = false);
+    ~TimeSyncService();
 
 public:
     // ----------------------------------------
@@ -103,6 +105,10 @@ public:
 
     void RequestNextStep();
 
+    //! Waits for a running sim step and stops the dedicated sim step thread, if it is enabled. Sim steps are not
+    //! executed anymore afterwards. Must be called before the connection of the participant is destroyed.
+    void StopSimStepThread();
+
 private:
     // ----------------------------------------
     // private methods
@@ -138,6 +144,9 @@ private:
     Util::PerformanceMonitor _execTimeMonitor;
     Util::PerformanceMonitor _waitTimeMonitor;
     WatchDog _watchDog;
+
+    //! Execute the sim steps of a synchronized participant on a dedicated thread instead of the I/O thread
+    bool _enableSimStepThread{false};
 };
 
 // ================================================================================
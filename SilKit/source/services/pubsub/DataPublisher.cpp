@@ -23,12 +23,28 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "DataMessageDatatypeUtils.hpp"
 #include "WireDataMessages.hpp"
+#include "DataSerdes.hpp"
 #include "silkit/util/Span.hpp"
 
 namespace SilKit {
 namespace Services {
 namespace PubSub {
 
+namespace {
+
+// The handle of a DataPublisherLoan: the serialized message, whose payload is written by the application
+struct LoanedMessage
+{
+    std::shared_ptr<std::vector<uint8_t>> serialized;
+};
+
+void ReleaseLoanedMessage(void* handle)
+{
+    delete static_cast<LoanedMessage*>(handle);
+}
+
+} // namespace
+
 DataPublisher::DataPublisher(Core::IParticipantInternal* participant,
                              Services::Orchestration::ITimeProvider* timeProvider,
                              const SilKit::Services::PubSub::PubSubSpec& dataSpec, const std::string& pubUUID,
@@ -59,6 +75,34 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     PublishInternal(data);
 }
 
+auto DataPublisher::Loan(size_t size) -> DataPublisherLoan
+{
+    auto loanedMessage = std::make_unique<LoanedMessage>();
+    loanedMessage->serialized = AllocateLoanedWireDataMessageEvent(size);
+
+    const auto data = GetLoanedPayload(*loanedMessage->serialized);
+    return DataPublisherLoan{data, loanedMessage.release(), &ReleaseLoanedMessage};
+}
+
+void DataPublisher::PublishLoan(DataPublisherLoan loan)
+{
+    std::unique_ptr<LoanedMessage> loanedMessage{static_cast<LoanedMessage*>(loan.ReleaseHandle())};
+    if (loanedMessage == nullptr)
+    {
+        throw SilKitError{"DataPublisher: Publish was called with an empty loan"};
+    }
+
+    if (Tracing::IsReplayEnabledFor(_config.replay, Config::Replay::Direction::Send))
+    {
+        return;
+    }
+
+    // the message refers to the loaned buffer, which is sent as is
+    auto msg = MakeLoanedWireDataMessageEvent(std::move(loanedMessage->serialized), _timeProvider->Now());
+    _tracer.Trace(SilKit::Services::TransmitDirection::TX, msg.timestamp, ToDataMessageEvent(msg));
+    _participant->SendMsg(this, msg);
+}
+
 void DataPublisher::ReplayMessage(const SilKit::IReplayMessage* message)
 {
     using namespace SilKit::Tracing;
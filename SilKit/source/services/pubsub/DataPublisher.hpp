@@ -51,6 +51,8 @@ public:
 
 public: // Methods
     void Publish(Util::Span<const uint8_t> data) override;
+    auto Loan(size_t size) -> DataPublisherLoan override;
+    void PublishLoan(DataPublisherLoan loan) override;
 
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSerdes.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace SilKit {
 namespace Services {
 namespace PubSub {
@@ -48,6 +51,54 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out)
     buffer >> out;
 }
 
+namespace {
+// The serialized WireDataMessageEvent consists of the payload size, the payload, and the timestamp
+constexpr size_t loanedPayloadOffset = sizeof(uint32_t);
+constexpr size_t loanedTimestampSize = sizeof(std::chrono::nanoseconds::rep);
+} // namespace
+
+auto AllocateLoanedWireDataMessageEvent(const size_t payloadSize) -> std::shared_ptr<std::vector<uint8_t>>
+{
+    if (payloadSize > std::numeric_limits<uint32_t>::max())
+    {
+        throw SilKit::LengthError{"DataPublisher: loaned payload size exceeds the maximum message size"};
+    }
+
+    SilKit::Core::MessageBuffer buffer;
+    buffer << static_cast<uint32_t>(payloadSize);
+
+    auto serialized = std::make_shared<std::vector<uint8_t>>(buffer.ReleaseStorage());
+    serialized->resize(loanedPayloadOffset + payloadSize + loanedTimestampSize);
+    return serialized;
+}
+
+auto GetLoanedPayload(std::vector<uint8_t>& serialized) -> Util::Span<uint8_t>
+{
+    return {serialized.data() + loanedPayloadOffset, serialized.size() - loanedPayloadOffset - loanedTimestampSize};
+}
+
+auto MakeLoanedWireDataMessageEvent(std::shared_ptr<std::vector<uint8_t>> serialized,
+                                    const std::chrono::nanoseconds timestamp) -> WireDataMessageEvent
+{
+    SilKit::Core::MessageBuffer buffer;
+    buffer << timestamp;
+    const auto timestampBytes = buffer.ReleaseStorage();
+    std::copy(timestampBytes.begin(), timestampBytes.end(), serialized->end() - loanedTimestampSize);
+
+    const auto payloadSize = serialized->size() - loanedPayloadOffset - loanedTimestampSize;
+
+    WireDataMessageEvent msg;
+    msg.timestamp = timestamp;
+    msg.data = Util::SharedVector<uint8_t>{serialized, loanedPayloadOffset, payloadSize};
+    msg.serialized = std::move(serialized);
+    return msg;
+}
+
+auto GetSerializedBody(const WireDataMessageEvent& msg) -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    return msg.serialized;
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -33,6 +33,19 @@ namespace PubSub {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out);
 
+//! Allocates the serialized representation of a WireDataMessageEvent, whose payload of the given size is written in
+//! place. See GetLoanedPayload and MakeLoanedWireDataMessageEvent.
+auto AllocateLoanedWireDataMessageEvent(size_t payloadSize) -> std::shared_ptr<std::vector<uint8_t>>;
+//! The payload of a buffer allocated by AllocateLoanedWireDataMessageEvent
+auto GetLoanedPayload(std::vector<uint8_t>& serialized) -> Util::Span<uint8_t>;
+//! Completes a buffer allocated by AllocateLoanedWireDataMessageEvent with the timestamp. The returned message refers
+//! to the payload in the buffer and is sent without serializing it again.
+auto MakeLoanedWireDataMessageEvent(std::shared_ptr<std::vector<uint8_t>> serialized,
+                                    std::chrono::nanoseconds timestamp) -> WireDataMessageEvent;
+
+//! The serialized representation carried by the message itself, or nullptr. Used by SerializedMessage.
+auto GetSerializedBody(const WireDataMessageEvent& msg) -> std::shared_ptr<const std::vector<uint8_t>>;
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
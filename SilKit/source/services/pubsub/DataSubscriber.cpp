@@ -21,7 +21,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriber.hpp"
 #include "IServiceDiscovery.hpp"
-#include "YamlParser.hpp"
 #include "LabelMatching.hpp"
 
 #include "silkit/services/logging/ILogger.hpp"
@@ -47,8 +46,9 @@ DataSubscriber::DataSubscriber(Core::IParticipantInternal* participant, Config::
 void DataSubscriber::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
-        auto getVal = [serviceDescriptor](const std::string& key) {
+                               const SilKit::Core::ServiceDescriptor& serviceDescriptor,
+                               const std::vector<SilKit::Services::MatchingLabel>& publisherLabels) {
+        auto getVal = [&serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
             {
@@ -72,9 +72,6 @@ void DataSubscriber::RegisterServiceDiscovery()
             const std::string pubMediaType{getVal(Core::Discovery::supplKeyDataPublisherMediaType)};
             if (MatchMediaType(_mediaType, pubMediaType))
             {
-                const std::string labelsStr = getVal(Core::Discovery::supplKeyDataPublisherPubLabels);
-                const std::vector<SilKit::Services::MatchingLabel> publisherLabels =
-                    SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
                 if (Util::MatchLabels(_labels, publisherLabels))
                 {
                     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
@@ -75,4 +75,55 @@ TEST_F(Test_DataPublisher, publish)
     publisher.Publish(sampleData);
 }
 
+TEST_F(Test_DataPublisher, publish_loan)
+{
+    auto loan = publisher.Loan(sampleData.size());
+    ASSERT_EQ(loan.Data().size(), sampleData.size());
+    std::copy(sampleData.begin(), sampleData.end(), loan.Data().begin());
+    const auto* loanedData = loan.Data().data();
+
+    WireDataMessageEvent msg{0ns, sampleData};
+
+    EXPECT_CALL(participant, SendMsg(&publisher, msg))
+        .WillOnce(Invoke([loanedData](const IServiceEndpoint*, const WireDataMessageEvent& sentMsg) {
+        // the payload is sent from the loaned buffer, without copying it
+        EXPECT_EQ(sentMsg.data.AsSpan().data(), loanedData);
+        EXPECT_NE(sentMsg.serialized, nullptr);
+    }));
+
+    publisher.PublishLoan(std::move(loan));
+    EXPECT_EQ(loan.Data().size(), 0u);
+}
+
+TEST_F(Test_DataPublisher, publish_empty_loan_throws)
+{
+    EXPECT_CALL(participant, SendMsg(_, A<const WireDataMessageEvent&>())).Times(0);
+
+    EXPECT_THROW(publisher.PublishLoan(DataPublisherLoan{}), SilKitError);
+}
+
+TEST_F(Test_DataPublisher, default_loan_is_published_as_a_copy)
+{
+    // publishers which only implement Publish(Span) support loans via the default implementations
+    struct SpanOnlyPublisher : SilKit::Services::PubSub::IDataPublisher
+    {
+        void Publish(SilKit::Util::Span<const uint8_t> data) override
+        {
+            published = SilKit::Util::ToStdVector(data);
+        }
+
+        std::vector<uint8_t> published;
+    } spanOnlyPublisher;
+
+    auto loan = spanOnlyPublisher.Loan(sampleData.size());
+    ASSERT_EQ(loan.Data().size(), sampleData.size());
+    std::copy(sampleData.begin(), sampleData.end(), loan.Data().begin());
+
+    spanOnlyPublisher.PublishLoan(std::move(loan));
+    EXPECT_EQ(spanOnlyPublisher.published, sampleData);
+
+    // an unpublished loan releases its buffer
+    spanOnlyPublisher.Loan(sampleData.size());
+}
+
 } // anonymous namespace
@@ -53,3 +53,30 @@ TEST(Test_DataSerdes, SimData_LargeDataMessage)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_DataSerdes, SimData_LoanedDataMessage)
+{
+    using namespace SilKit::Services::PubSub;
+    using namespace SilKit::Core;
+
+    const std::vector<uint8_t> referenceData(114'793, 'D');
+
+    auto serialized = AllocateLoanedWireDataMessageEvent(referenceData.size());
+    auto payload = GetLoanedPayload(*serialized);
+    ASSERT_EQ(payload.size(), referenceData.size());
+    std::copy(referenceData.begin(), referenceData.end(), payload.begin());
+
+    const auto in = MakeLoanedWireDataMessageEvent(serialized, 0xabcdefns);
+    EXPECT_EQ(in.data.AsSpan().data(), payload.data());
+
+    // the loaned buffer is identical to the regular serialization, and is used as is
+    SilKit::Core::MessageBuffer buffer;
+    Serialize(buffer, in);
+    EXPECT_EQ(buffer.ReleaseStorage(), *serialized);
+    EXPECT_EQ(GetSerializedBody(in), serialized);
+
+    SilKit::Core::MessageBuffer received{*serialized};
+    WireDataMessageEvent out;
+    Deserialize(received, out);
+    EXPECT_EQ(in, out);
+}
@@ -57,6 +57,7 @@ RpcClient::RpcClient(Core::IParticipantInternal* participant, Services::Orchestr
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _participant{participant}
+    , _callUuidPrefix{Util::Uuid::GenerateRandom().ab}
 {
 }
 
@@ -71,8 +72,9 @@ RpcClient::~RpcClient()
 void RpcClient::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
-        auto getVal = [serviceDescriptor](const std::string& key) {
+                               const SilKit::Core::ServiceDescriptor& serviceDescriptor,
+                               const std::vector<SilKit::Services::MatchingLabel>& /*serverLabels*/) {
+        auto getVal = [&serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
             {
@@ -119,41 +121,36 @@ void RpcClient::TimeHandler(std::chrono::nanoseconds now, std::chrono::nanosecon
     {
         std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-        for (auto it = _timeoutEntries.begin(); it != _timeoutEntries.end();)
+        _timeoutClock += duration;
+        while (!_timeoutEntries.empty() && _timeoutEntries.top().deadline <= _timeoutClock)
         {
-            it->timeLeft -= duration;
-            if (it->timeLeft <= static_cast<std::chrono::nanoseconds>(0))
-            {
-                timeoutedEntries.insert(timeoutedEntries.end(), std::make_move_iterator(it),
-                                        std::make_move_iterator(it + 1));
-                it = _timeoutEntries.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            timeoutedEntries.push_back(_timeoutEntries.top());
+            _timeoutEntries.pop();
         }
     }
 
     for (auto&& entry : timeoutedEntries)
     {
-        auto uuid = entry.callUuid;
-
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        auto it = _activeCalls.find(uuid);
-        auto userContext = it->second.GetUserContext();
+        auto it = _activeCalls.find(entry.callUuid);
 
         if (it != _activeCalls.end())
         {
+            auto userContext = it->second.GetUserContext();
             _activeCalls.erase(it);
             lock.unlock();
 
             _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
         }
     }
-    timeoutedEntries.clear();
 }
 
+auto RpcClient::NextCallUuid() -> Util::Uuid
+{
+    // Keep the version 4 / variant 8 layout of random Uuids, which the prefix was taken from
+    const auto sequenceNumber = _nextCallSequenceNumber++;
+    return Util::Uuid{_callUuidPrefix, (sequenceNumber & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL};
+}
 
 void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
                             void* userContext)
@@ -168,7 +165,7 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
     }
     else
     {
-        const auto callUuid = Util::Uuid::GenerateRandom();
+        const auto callUuid = NextCallUuid();
 
         FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
 
@@ -182,7 +179,7 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
             {
                 {
                     std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
-                    _timeoutEntries.push_back({timeout, callUuid});
+                    _timeoutEntries.push({_timeoutClock + timeout, callUuid});
                 }
 
                 if (!_isTimeoutHandlerSet)
@@ -212,11 +209,11 @@ void RpcClient::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Functio
 
 void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
 {
-    std::map<SilKit::Util::Uuid, SilKit::Services::Rpc::RpcClient::RpcCallInfo>::iterator it;
+    void* userContext{nullptr};
     {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
 
-        it = _activeCalls.find(msg.callUuid);
+        auto it = _activeCalls.find(msg.callUuid);
 
         if (it == _activeCalls.end())
         {
@@ -225,20 +222,20 @@ void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
             _logger->Warn(warningMsg);
             return;
         }
-    };
 
-    if (_handler)
-    {
-        _handler(this,
-                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data});
+        userContext = it->second.GetUserContext();
+
+        // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
+        //     after all returns have been received.
+        if (it->second.DecrementRemainingReturnCount() <= 0)
+        {
+            _activeCalls.erase(it);
+        }
     }
 
-    // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
-    //     after all returns have been received.
-    if (it->second.DecrementRemainingReturnCount() <= 0)
+    if (_handler)
     {
-        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        _activeCalls.erase(it);
+        _handler(this, RpcCallResultEvent{msg.timestamp, userContext, ToRpcCallStatus(msg.status), msg.data});
     }
 }
 
@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "silkit/services/rpc/IRpcClient.hpp"
 #include "silkit/services/rpc/IRpcCallHandle.hpp"
@@ -77,6 +78,7 @@ private:
     void TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
                      void* userContext);
     void TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration);
+    auto NextCallUuid() -> Util::Uuid;
 
     class RpcCallInfo
     {
@@ -114,18 +116,29 @@ private:
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 
+    // Call ids only have to be unique per client: a random prefix chosen once and a running sequence number
+    const uint64_t _callUuidPrefix;
+    std::atomic<uint64_t> _nextCallSequenceNumber{0};
+
     std::mutex _activeCallsMx;
     std::mutex _timeoutQueueMx;
-    std::map<Util::Uuid, RpcCallInfo> _activeCalls;
+    std::unordered_map<Util::Uuid, RpcCallInfo, Util::UuidHash> _activeCalls;
 
     struct TimeoutEntry
     {
-        std::chrono::nanoseconds timeLeft;
+        std::chrono::nanoseconds deadline;
         Util::Uuid callUuid;
-    };
 
+        bool operator>(const TimeoutEntry& other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
 
-    std::vector<TimeoutEntry> _timeoutEntries{};
+    // Min-heap on the deadline, i.e., the simulation time elapsed since the first call with timeout, so each
+    // simulation step only touches the expired entries. Entries of answered calls are dropped when they expire.
+    std::priority_queue<TimeoutEntry, std::vector<TimeoutEntry>, std::greater<TimeoutEntry>> _timeoutEntries;
+    std::chrono::nanoseconds _timeoutClock{0};
     std::function<void(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)> _timeoutHandler{};
     Services::HandlerId _timeoutHandlerId{};
     std::atomic<bool> _isTimeoutHandlerSet{false};
@@ -25,7 +25,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcServer.hpp"
 #include "RpcDatatypeUtils.hpp"
 #include "Uuid.hpp"
-#include "YamlParser.hpp"
 #include "Assert.hpp"
 #include "LabelMatching.hpp"
 
@@ -46,10 +45,11 @@ RpcServer::RpcServer(Core::IParticipantInternal* participant, Services::Orchestr
 void RpcServer::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
+                               const SilKit::Core::ServiceDescriptor& serviceDescriptor,
+                               const std::vector<SilKit::Services::MatchingLabel>& clientLabels) {
         if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
         {
-            auto getVal = [serviceDescriptor](const std::string& key) {
+            auto getVal = [&serviceDescriptor](const std::string& key) {
                 std::string tmp;
                 if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
                 {
@@ -61,8 +61,6 @@ void RpcServer::RegisterServiceDiscovery()
             auto functionName = getVal(Core::Discovery::supplKeyRpcClientFunctionName);
             auto clientMediaType = getVal(Core::Discovery::supplKeyRpcClientMediaType);
             auto clientUUID = getVal(Core::Discovery::supplKeyRpcClientUUID);
-            std::string labelsStr = getVal(Core::Discovery::supplKeyRpcClientLabels);
-            auto clientLabels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
 
             if (functionName == _dataSpec.FunctionName() && MatchMediaType(clientMediaType, _dataSpec.MediaType())
                 && Util::MatchLabels(_dataSpec.Labels(), clientLabels))
@@ -91,6 +89,9 @@ void RpcServer::SubmitResult(IRpcCallHandle* callHandle, Util::Span<const uint8_
         throw SilKit::StateError{std::move(errorMsg)};
     }
 
+    // NB: Copy the call id, the handle is released by the RpcServerInternal which the call belongs to
+    const auto callUuid = static_cast<const RpcCallHandle*>(callHandle)->GetCallUuid();
+
     // counts the number of RpcServerInternal's living within this RpcServer that returned the FunctionCall
     uint32_t submitResultCounter = 0;
 
@@ -98,7 +99,7 @@ void RpcServer::SubmitResult(IRpcCallHandle* callHandle, Util::Span<const uint8_
         std::unique_lock<decltype(_internalRpcServersMx)> lock{_internalRpcServersMx};
         for (auto* internalRpcServer : _internalRpcServers)
         {
-            submitResultCounter += (internalRpcServer->SubmitResult(callHandle, resultData) ? 1 : 0);
+            submitResultCounter += (internalRpcServer->SubmitResult(callUuid, resultData) ? 1 : 0);
         }
     }
 
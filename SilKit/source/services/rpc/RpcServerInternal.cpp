@@ -26,6 +26,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "RpcDatatypeUtils.hpp"
 
+#include <utility>
+
 namespace SilKit {
 namespace Services {
 namespace Rpc {
@@ -68,7 +70,7 @@ void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
 
     // NB: 'result' has type pair<iterator, bool> where the bool indicates if the call was actually inserted (i.e.
     //     the key was _not_ already present in the map).
-    auto result = _activeCalls.emplace(msg.callUuid, std::make_shared<RpcCallHandle>(msg.callUuid));
+    auto result = _activeCalls.emplace(msg.callUuid, RpcCallHandle{msg.callUuid});
     if (!result.second)
     {
         // Inform the client about the failed (unhandled) call
@@ -82,27 +84,63 @@ void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
         return;
     }
 
-    // NB: Explicitly _copy_ the call handle to keep the handle itself alive even if it gets removed from the map
-    //     due to a call to SubmitResult in the handler.
-    std::shared_ptr<RpcCallHandle> callHandle = result.first->second;
-    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data});
+    // NB: Keep the call handle alive while the handler runs, even if it calls SubmitResult. The previous values are
+    //     restored afterwards, in case the handler caused another call to be received.
+    auto* callHandle = &result.first->second;
+    const auto* outerCallInHandler = std::exchange(_callInHandler, callHandle);
+    const auto outerCallInHandlerSubmitted = std::exchange(_callInHandlerSubmitted, false);
+    // NB: Also called if the handler throws, so a result submitted before the exception does not leave the call active
+    const auto finishCallInHandler = [this, &msg, outerCallInHandler, outerCallInHandlerSubmitted] {
+        const auto submitted = _callInHandlerSubmitted;
+        _callInHandler = outerCallInHandler;
+        _callInHandlerSubmitted = outerCallInHandlerSubmitted;
+        if (submitted)
+        {
+            _activeCalls.erase(msg.callUuid);
+        }
+    };
+
+    try
+    {
+        _handler(_parent, RpcCallEvent{msg.timestamp, callHandle, msg.data});
+    }
+    catch (...)
+    {
+        finishCallInHandler();
+        throw;
+    }
+
+    finishCallInHandler();
 }
 
-bool RpcServerInternal::SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData)
+bool RpcServerInternal::SubmitResult(const Util::Uuid& callUuid, Util::Span<const uint8_t> resultData)
 {
-    const auto& callHandle = static_cast<const RpcCallHandle&>(*callHandlePtr);
-
-    auto it = _activeCalls.find(callHandle.GetCallUuid());
+    auto it = _activeCalls.find(callUuid);
     if (it == _activeCalls.end())
     {
         // The call is not known to this RpcServerInternal, therefore return false
         return false;
     }
 
-    _participant->SendMsg(
-        this, FunctionCallResponse{_timeProvider->Now(), callHandle.GetCallUuid(), Util::ToStdVector(resultData),
-                                   FunctionCallResponse::Status::Success});
-    _activeCalls.erase(it);
+    const auto isCallInHandler = (&it->second == _callInHandler);
+    if (isCallInHandler && _callInHandlerSubmitted)
+    {
+        // The result of the call currently being handled was already submitted
+        return false;
+    }
+
+    _participant->SendMsg(this, FunctionCallResponse{_timeProvider->Now(), callUuid, Util::ToStdVector(resultData),
+                                                     FunctionCallResponse::Status::Success});
+
+    if (isCallInHandler)
+    {
+        _callInHandlerSubmitted = true;
+    }
+    else
+    {
+        // NB: Sending the result may have caused further calls to be received, which invalidates the iterator
+        _activeCalls.erase(callUuid);
+    }
 
     // The call was handled, therefore return true
     return true;
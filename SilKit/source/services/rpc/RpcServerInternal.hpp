@@ -22,7 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include "ITimeConsumer.hpp"
 #include "silkit/services/rpc/IRpcServer.hpp"
@@ -49,11 +49,11 @@ public:
 
     void SetRpcHandler(RpcCallHandler handler);
 
-    //! \brief Tries to submit the result to the call associated with the call handle.
-    //! \param callHandlePtr The call handle identifying the call to submit a result for
+    //! \brief Tries to submit the result to the call with the given id.
+    //! \param callUuid The id of the call to submit a result for, taken from its call handle
     //! \param resultData The result of the call
     //! \returns True if the call was handled, false if the call was unknown to this RpcServerInternal
-    bool SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData);
+    bool SubmitResult(const Util::Uuid& callUuid, Util::Span<const uint8_t> resultData);
 
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCall& msg) override;
@@ -75,7 +75,11 @@ private:
     IRpcServer* _parent;
 
     Core::ServiceDescriptor _serviceDescriptor{};
-    std::map<Util::Uuid, std::shared_ptr<RpcCallHandle>> _activeCalls;
+    // NB: The call handles live in the nodes of the map, so their addresses stay valid until the call is erased
+    std::unordered_map<Util::Uuid, RpcCallHandle, Util::UuidHash> _activeCalls;
+    // The call currently passed to the handler; it is only erased once the handler returned
+    const RpcCallHandle* _callInHandler{nullptr};
+    bool _callInHandlerSubmitted{false};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 };
@@ -100,6 +100,11 @@ struct MockConnection
         Mock_SendMsg(from, std::move(msg));
     }
 
+    template <typename SilKitMessageT>
+    void SendMsgs(const SilKit::Core::IServiceEndpoint* /*from*/, std::vector<SilKitMessageT>&& /*msgs*/)
+    {
+    }
+
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCall /*msg*/));
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallResponse /*msg*/));
 
@@ -109,6 +114,11 @@ struct MockConnection
     {
     }
 
+    template <typename SilKitMessageT>
+    void SendMsg(std::vector<SilKit::Core::MessageTarget> /*targets*/, SilKitMessageT&& /*msg*/)
+    {
+    }
+
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
@@ -121,6 +131,8 @@ struct MockConnection
 
     void RegisterPeerShutdownCallback(std::function<void(SilKit::Core::IVAsioPeer* peer)> /*callback*/) {}
 
+    void DeferServiceRegistrations() {}
+
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/){};
 
     void Test_SetTimeProvider(SilKit::Services::Orchestration::ITimeProvider* timeProvider)
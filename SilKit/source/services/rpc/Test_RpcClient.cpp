@@ -124,4 +124,44 @@ TEST_F(Test_RpcClient, rpc_client_call_receives_internal_server_error_when_serve
     iRpcClient->Call(sampleData, userContext);
 }
 
+TEST_F(Test_RpcClient, rpc_client_calls_time_out_in_deadline_order)
+{
+    testing::NiceMock<SilKit::Core::Tests::MockTimeProvider> fixedTimeProvider;
+
+    // The server never submits a result, so all calls run into their timeout
+    IRpcServer* iRpcServer = CreateRpcServer();
+    iRpcServer->SetCallHandler([](IRpcServer* /*rpcServer*/, const RpcCallEvent& /*event*/) {});
+
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->SetCallResultHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallResultHandler));
+
+    // HACK: Change the time provider for the captured services. Must happen _after_ the RpcServer and RpcClient (and
+    //       therefore the RpcServerInternal) have been created.
+    participant->GetSilKitConnection().Test_SetTimeProvider(&fixedTimeProvider);
+
+    const auto firstContext = reinterpret_cast<void*>(uintptr_t(1));
+    const auto secondContext = reinterpret_cast<void*>(uintptr_t(2));
+    const auto thirdContext = reinterpret_cast<void*>(uintptr_t(3));
+
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{3}, thirdContext);
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{1}, firstContext);
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{2}, secondContext);
+
+    const auto timeoutMatcher = [](void* userContext) {
+        return testing::Matcher<RpcCallResultEvent>{
+            testing::AllOf(testing::Field(&RpcCallResultEvent::userContext, userContext),
+                           testing::Field(&RpcCallResultEvent::callStatus, RpcCallStatus::Timeout))};
+    };
+
+    testing::InSequence sequence;
+    EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, timeoutMatcher(firstContext))).Times(1);
+    EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, timeoutMatcher(secondContext))).Times(1);
+    EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, timeoutMatcher(thirdContext))).Times(1);
+
+    for (auto now = std::chrono::milliseconds{1}; now <= std::chrono::milliseconds{4}; ++now)
+    {
+        fixedTimeProvider._handlers.InvokeAll(now, std::chrono::milliseconds{1});
+    }
+}
+
 } // anonymous namespace
@@ -20,9 +20,11 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "RpcClient.hpp"
+#include "RpcCallHandle.hpp"
 
 #include <chrono>
 #include <functional>
+#include <stdexcept>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -71,4 +73,40 @@ TEST_F(Test_RpcServer, rpc_server_call_response_sends_message_with_timestamp_and
     iRpcClient->Call(sampleData);
 }
 
+TEST_F(Test_RpcServer, rpc_server_releases_call_when_handler_throws_after_submitting_result)
+{
+    IRpcServer* iRpcServer = CreateRpcServer();
+
+    // The first invocation submits the result and throws afterwards
+    int handlerCalls = 0;
+    SilKit::Util::Uuid callUuid{};
+    iRpcServer->SetCallHandler([&handlerCalls, &callUuid](IRpcServer* iRpcServer, RpcCallEvent event) {
+        callUuid = static_cast<const RpcCallHandle*>(event.callHandle)->GetCallUuid();
+        iRpcServer->SubmitResult(event.callHandle, event.argumentData);
+        if (handlerCalls++ == 0)
+        {
+            throw std::runtime_error{"handler failed after submitting the result"};
+        }
+    });
+
+    auto& connection = participant->GetSilKitConnection();
+
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCallResponse>()))
+        .Times(2)
+        .WillRepeatedly([](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCallResponse& msg) {
+        EXPECT_EQ(msg.status, FunctionCallResponse::Status::Success);
+    });
+
+    IRpcClient* iRpcClient = CreateRpcClient();
+    EXPECT_THROW(iRpcClient->Call(sampleData), std::runtime_error);
+
+    // A call with the same id is only handled again if the first one is no longer active
+    for (auto* rpcServerInternal : connection.services.rpcServerInternal)
+    {
+        rpcServerInternal->ReceiveMsg(nullptr, FunctionCall{std::chrono::nanoseconds{0}, callUuid, sampleData});
+    }
+
+    EXPECT_EQ(handlerCalls, 2);
+}
+
 } // anonymous namespace
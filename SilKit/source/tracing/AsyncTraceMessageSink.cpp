@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "AsyncTraceMessageSink.hpp"
+
+#include <algorithm>
+
+#include "silkit/participant/exception.hpp"
+
+#include "ILogger.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+namespace Detail {
+
+//! \brief Owning counterpart of the non-owning TraceMessage, so records can outlive the traced message.
+class OwnedTraceMessage
+{
+public:
+    virtual ~OwnedTraceMessage() = default;
+    virtual auto Get() const -> const TraceMessage& = 0;
+
+    static auto Copy(const TraceMessage& message) -> std::unique_ptr<OwnedTraceMessage>;
+};
+
+} // namespace Detail
+
+namespace {
+
+void RetainBytes(Util::Span<const uint8_t>& bytes, std::vector<uint8_t>& storage)
+{
+    storage.assign(bytes.begin(), bytes.end());
+    bytes = Util::Span<const uint8_t>{storage.data(), storage.size()};
+}
+
+void RetainPayload(Services::Ethernet::EthernetFrame& message, std::vector<uint8_t>& storage)
+{
+    RetainBytes(message.raw, storage);
+}
+
+void RetainPayload(Services::Can::CanFrameEvent& message, std::vector<uint8_t>& storage)
+{
+    RetainBytes(message.frame.dataField, storage);
+}
+
+void RetainPayload(Services::Flexray::FlexrayFrameEvent& message, std::vector<uint8_t>& storage)
+{
+    RetainBytes(message.frame.payload, storage);
+}
+
+void RetainPayload(Services::PubSub::DataMessageEvent& message, std::vector<uint8_t>& storage)
+{
+    RetainBytes(message.data, storage);
+}
+
+void RetainPayload(Services::Lin::LinFrame& /*message*/, std::vector<uint8_t>& /*storage*/)
+{
+    // LIN frames carry their data inline
+}
+
+template <typename MsgT>
+class OwnedTraceMessageImpl final : public Detail::OwnedTraceMessage
+{
+public:
+    explicit OwnedTraceMessageImpl(const MsgT& message)
+        : _message{message}
+        , _traceMessage{_message}
+    {
+        RetainPayload(_message, _payload);
+    }
+
+    auto Get() const -> const TraceMessage& override
+    {
+        return _traceMessage;
+    }
+
+private:
+    MsgT _message;
+    std::vector<uint8_t> _payload;
+    TraceMessage _traceMessage;
+};
+
+template <typename MsgT>
+auto MakeOwned(const TraceMessage& message) -> std::unique_ptr<Detail::OwnedTraceMessage>
+{
+    return std::make_unique<OwnedTraceMessageImpl<MsgT>>(message.Get<MsgT>());
+}
+
+} // namespace
+
+auto Detail::OwnedTraceMessage::Copy(const TraceMessage& message) -> std::unique_ptr<OwnedTraceMessage>
+{
+    switch (message.Type())
+    {
+    case TraceMessageType::EthernetFrame:
+        return MakeOwned<Services::Ethernet::EthernetFrame>(message);
+    case TraceMessageType::CanFrameEvent:
+        return MakeOwned<Services::Can::CanFrameEvent>(message);
+    case TraceMessageType::LinFrame:
+        return MakeOwned<Services::Lin::LinFrame>(message);
+    case TraceMessageType::FlexrayFrameEvent:
+        return MakeOwned<Services::Flexray::FlexrayFrameEvent>(message);
+    case TraceMessageType::DataMessageEvent:
+        return MakeOwned<Services::PubSub::DataMessageEvent>(message);
+    default:
+        throw SilKitError("AsyncTraceMessageSink: unsupported trace message type");
+    }
+}
+
+AsyncTraceMessageSink::AsyncTraceMessageSink(std::unique_ptr<ITraceMessageSink> sink, std::size_t queueSize,
+                                             OverflowPolicy overflowPolicy)
+    : _sink{std::move(sink)}
+    , _queueSize{std::max<std::size_t>(queueSize, 1)}
+    , _overflowPolicy{overflowPolicy}
+{
+    StartWriter();
+}
+
+AsyncTraceMessageSink::~AsyncTraceMessageSink()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+    }
+}
+
+void AsyncTraceMessageSink::Open(SinkType outputType, const std::string& outputPath)
+{
+    // records queued for the previous output must not end up in the new one
+    StopWriter();
+    _sink->Open(outputType, outputPath);
+    StartWriter();
+}
+
+void AsyncTraceMessageSink::Close()
+{
+    if (!StopWriter())
+    {
+        return;
+    }
+
+    _sink->Close();
+
+    const auto droppedRecords = _droppedRecords.load();
+    if (droppedRecords > 0)
+    {
+        Services::Logging::Warn(_sink->GetLogger(), "Sink {}: dropped {} trace records because the queue was full",
+                                _sink->Name(), droppedRecords);
+    }
+}
+
+void AsyncTraceMessageSink::Trace(SilKit::Services::TransmitDirection txRx, const Core::ServiceDescriptor& id,
+                                  std::chrono::nanoseconds timestamp, const TraceMessage& msg)
+{
+    // copy the message outside the lock, producers only contend for the push itself
+    Record record{txRx, id, timestamp, Detail::OwnedTraceMessage::Copy(msg)};
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_queue.size() >= _queueSize)
+        {
+            if (_overflowPolicy == OverflowPolicy::Drop)
+            {
+                ++_droppedRecords;
+                return;
+            }
+
+            _spaceAvailable.wait(lock, [this] { return _stopped || _queue.size() < _queueSize; });
+        }
+
+        if (_stopped)
+        {
+            return;
+        }
+
+        _queue.emplace_back(std::move(record));
+        _queueDepth = _queue.size();
+    }
+
+    _recordsAvailable.notify_one();
+}
+
+auto AsyncTraceMessageSink::GetLogger() const -> Services::Logging::ILogger*
+{
+    return _sink->GetLogger();
+}
+
+auto AsyncTraceMessageSink::Name() const -> const std::string&
+{
+    return _sink->Name();
+}
+
+auto AsyncTraceMessageSink::GetQueueDepth() const -> std::size_t
+{
+    return _queueDepth.load();
+}
+
+auto AsyncTraceMessageSink::GetDroppedRecordCount() const -> std::size_t
+{
+    return _droppedRecords.load();
+}
+
+void AsyncTraceMessageSink::StartWriter()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _stopped = false;
+    }
+
+    _writerThread = std::thread{[this] { WriterLoop(); }};
+}
+
+bool AsyncTraceMessageSink::StopWriter()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_stopped)
+        {
+            return false;
+        }
+        _stopped = true;
+    }
+
+    _recordsAvailable.notify_all();
+    _spaceAvailable.notify_all();
+
+    if (_writerThread.joinable())
+    {
+        _writerThread.join();
+    }
+    return true;
+}
+
+void AsyncTraceMessageSink::WriterLoop()
+{
+    std::vector<Record> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _recordsAvailable.wait(lock, [this] { return _stopped || !_queue.empty(); });
+
+            if (_queue.empty())
+            {
+                // stopped and drained
+                return;
+            }
+
+            // take everything queued so far, the emptied batch storage is reused as the next queue
+            batch.swap(_queue);
+            _queueDepth = 0;
+        }
+
+        _spaceAvailable.notify_all();
+
+        WriteBatch(batch);
+        batch.clear();
+    }
+}
+
+void AsyncTraceMessageSink::WriteBatch(std::vector<Record>& batch)
+{
+    for (const auto& record : batch)
+    {
+        try
+        {
+            _sink->Trace(record.direction, record.address, record.timestamp, record.message->Get());
+        }
+        catch (const std::exception& error)
+        {
+            Services::Logging::Error(_sink->GetLogger(), "Sink {}: failed to write trace record: {}", _sink->Name(),
+                                     error.what());
+        }
+    }
+}
+
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ITraceMessageSink.hpp"
+#include "Configuration.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+namespace Detail {
+class OwnedTraceMessage;
+} // namespace Detail
+
+//! \brief Decouples tracing from writing: records are copied into a bounded queue
+//         and handed to the wrapped sink in batches by a dedicated writer thread.
+class AsyncTraceMessageSink : public ITraceMessageSink
+{
+public:
+    using OverflowPolicy = Config::TraceSink::OverflowPolicy;
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    AsyncTraceMessageSink() = delete;
+    AsyncTraceMessageSink(const AsyncTraceMessageSink&) = delete;
+    AsyncTraceMessageSink(std::unique_ptr<ITraceMessageSink> sink, std::size_t queueSize,
+                          OverflowPolicy overflowPolicy);
+    ~AsyncTraceMessageSink() override;
+
+    // ----------------------------------------
+    // Public methods
+
+    void Open(SinkType outputType, const std::string& outputPath) override;
+
+    //! \brief Writes all queued records, stops the writer thread and closes the wrapped sink.
+    void Close() override;
+
+    void Trace(SilKit::Services::TransmitDirection txRx, const Core::ServiceDescriptor& id,
+               std::chrono::nanoseconds timestamp, const TraceMessage& msg) override;
+
+    auto GetLogger() const -> Services::Logging::ILogger* override;
+
+    auto Name() const -> const std::string& override;
+
+    //! \brief Number of records waiting for the writer thread.
+    auto GetQueueDepth() const -> std::size_t;
+
+    //! \brief Number of records discarded because the queue was full.
+    auto GetDroppedRecordCount() const -> std::size_t;
+
+private:
+    // ----------------------------------------
+    // Private types
+    struct Record
+    {
+        SilKit::Services::TransmitDirection direction;
+        Core::ServiceDescriptor address;
+        std::chrono::nanoseconds timestamp;
+        std::unique_ptr<Detail::OwnedTraceMessage> message;
+    };
+
+private:
+    // ----------------------------------------
+    // Private methods
+    void StartWriter();
+    //! \brief Returns false if the writer was not running.
+    bool StopWriter();
+    void WriterLoop();
+    void WriteBatch(std::vector<Record>& batch);
+
+private:
+    // ----------------------------------------
+    // Private members
+    std::unique_ptr<ITraceMessageSink> _sink;
+    const std::size_t _queueSize;
+    const OverflowPolicy _overflowPolicy;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _recordsAvailable;
+    std::condition_variable _spaceAvailable;
+    std::vector<Record> _queue;
+    bool _stopped{false};
+
+    std::atomic<std::size_t> _queueDepth{0};
+    std::atomic<std::size_t> _droppedRecords{0};
+
+    std::thread _writerThread;
+};
+
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace SilKit {
+
+//! \brief Internal counterpart of IReplayChannelReader for readers which index the timestamps of all their messages.
+//         Messages returned by Read() stay valid after Seek(), so they can be read ahead of the simulation.
+class IIndexedReplayChannelReader
+{
+public:
+    virtual ~IIndexedReplayChannelReader() = default;
+
+    //! Number of consecutive messages, starting at the current position, with a timestamp before end.
+    virtual auto CountMessagesBefore(std::chrono::nanoseconds end) const -> size_t = 0;
+};
+
+} // namespace SilKit
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MappedPcapReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "silkit/participant/exception.hpp"
+
+#include "Pcap.hpp"
+#include "PcapMessage.hpp"
+#include "detail/MappedFile.hpp"
+
+#include "ILogger.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+MappedPcapReader::MappedPcapReader(const std::string& filePath, SilKit::Services::Logging::ILogger* logger)
+    : _filePath{filePath}
+    , _log{logger}
+{
+    try
+    {
+        _file = Detail::MappedFile::Open(_filePath);
+    }
+    catch (const SilKitError& error)
+    {
+        Services::Logging::Error(_log, "{}", error.what());
+        throw;
+    }
+
+    ReadGlobalHeader();
+    IndexPackets();
+}
+
+MappedPcapReader::MappedPcapReader(const MappedPcapReader& other)
+    : _filePath{other._filePath}
+    , _file{other._file}
+    , _index{other._index}
+    , _metaInfos{other._metaInfos}
+    , _log{other._log}
+{
+}
+
+void MappedPcapReader::ReadGlobalHeader()
+{
+    if (_file->Size() < sizeof(Pcap::GlobalHeader))
+    {
+        throw SilKitError("PCAP file cannot be opened: global header short read");
+    }
+
+    Pcap::GlobalHeader hdr{};
+    std::memcpy(&hdr, _file->Data(), sizeof(hdr));
+    if (hdr.magic_number != Pcap::NativeMagic)
+    {
+        throw SilKitError("PCAP file cannot be opened: invalid PCAP valid magic number");
+    }
+    if ((hdr.version_major != Pcap::MajorVersion) && (hdr.version_minor != Pcap::MinorVersion))
+    {
+        throw SilKitError("PCAP file cannot be opened: invalid PCAP version " + std::to_string(hdr.version_major) + "."
+                          + std::to_string(hdr.version_minor));
+    }
+    _metaInfos["pcap/version"] = std::to_string(hdr.version_major) + "." + std::to_string(hdr.version_minor);
+    _metaInfos["pcap/gmt_to_local"] = std::to_string(hdr.thiszone);
+}
+
+void MappedPcapReader::IndexPackets()
+{
+    auto index = std::make_shared<Index>();
+
+    // only the packet headers are touched here, the frames are read when they are replayed
+    const auto fileSize = _file->Size();
+    auto offset = sizeof(Pcap::GlobalHeader);
+    while (offset + sizeof(Pcap::PacketHeader) <= fileSize)
+    {
+        Pcap::PacketHeader hdr{};
+        std::memcpy(&hdr, _file->Data() + offset, sizeof(hdr));
+        offset += sizeof(hdr);
+
+        if (hdr.incl_len > fileSize - offset)
+        {
+            Services::Logging::Warn(_log, "PCAP file: {}: Cannot read packet at offset {}", _filePath, offset);
+            offset = fileSize;
+            break;
+        }
+
+        const std::chrono::nanoseconds timestamp{((uint64_t)hdr.ts_sec * 1000000000u)
+                                                 + ((uint64_t)hdr.ts_usec * 1000u)};
+        if (!index->packets.empty() && timestamp < index->packets.back().timestamp)
+        {
+            index->ordered = false;
+        }
+
+        index->packets.push_back(Packet{timestamp, offset, hdr.incl_len});
+        offset += hdr.incl_len;
+    }
+
+    if (offset != fileSize)
+    {
+        Services::Logging::Warn(_log, "PCAP file: {}: short read on packet header.", _filePath);
+    }
+
+    _index = std::move(index);
+}
+
+auto MappedPcapReader::StartTime() const -> std::chrono::nanoseconds
+{
+    const auto& packets = _index->packets;
+    return packets.empty() ? std::chrono::nanoseconds{0} : packets.front().timestamp;
+}
+
+auto MappedPcapReader::EndTime() const -> std::chrono::nanoseconds
+{
+    const auto& packets = _index->packets;
+    return packets.empty() ? std::chrono::nanoseconds{0} : packets.back().timestamp;
+}
+
+auto MappedPcapReader::NumberOfMessages() const -> uint64_t
+{
+    return _index->packets.size();
+}
+
+auto MappedPcapReader::GetMetaInfos() const -> const std::map<std::string, std::string>&
+{
+    return _metaInfos;
+}
+
+bool MappedPcapReader::Seek(size_t messageNumber)
+{
+    _currentMessage.reset();
+    _position = std::min(_position + messageNumber, _index->packets.size());
+    return _position < _index->packets.size();
+}
+
+auto MappedPcapReader::Read() -> std::shared_ptr<SilKit::IReplayMessage>
+{
+    if (_currentMessage || _position >= _index->packets.size())
+    {
+        return _currentMessage;
+    }
+
+    const auto& packet = _index->packets[_position];
+
+    auto msg = std::make_shared<PcapMessage>();
+    msg->SetTimestamp(packet.timestamp);
+    // the frame refers to the mapping, which is kept alive by the frame
+    msg->raw = Util::SharedVector<uint8_t>{std::shared_ptr<const uint8_t>{_file, _file->Data() + packet.offset},
+                                           packet.size};
+
+    _currentMessage = std::move(msg);
+    return _currentMessage;
+}
+
+auto MappedPcapReader::CountMessagesBefore(std::chrono::nanoseconds end) const -> size_t
+{
+    const auto& packets = _index->packets;
+    const auto begin = packets.begin() + static_cast<std::ptrdiff_t>(_position);
+
+    if (_index->ordered)
+    {
+        const auto last = std::lower_bound(begin, packets.end(), end,
+                                           [](const Packet& packet, auto time) { return packet.timestamp < time; });
+        return static_cast<size_t>(std::distance(begin, last));
+    }
+
+    const auto last =
+        std::find_if(begin, packets.end(), [end](const Packet& packet) { return packet.timestamp >= end; });
+    return static_cast<size_t>(std::distance(begin, last));
+}
+
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IReplay.hpp"
+#include "IIndexedReplayChannelReader.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+namespace Detail {
+class MappedFile;
+} // namespace Detail
+
+//! \brief Reads a PCAP file through a read-only memory mapping.
+//         The packet headers are indexed once, the frames refer to the mapping instead of being copied.
+class MappedPcapReader
+    : public SilKit::IReplayChannelReader
+    , public SilKit::IIndexedReplayChannelReader
+{
+public:
+    // Constructors
+    MappedPcapReader(const std::string& filePath, SilKit::Services::Logging::ILogger* logger);
+    //! Shares the mapping and the index of other, starting at the first message
+    MappedPcapReader(const MappedPcapReader& other);
+
+public:
+    // Methods
+    auto StartTime() const -> std::chrono::nanoseconds;
+    auto EndTime() const -> std::chrono::nanoseconds;
+    auto NumberOfMessages() const -> uint64_t;
+
+    auto GetMetaInfos() const -> const std::map<std::string, std::string>&;
+
+    // Interface IReplayChannelReader
+    bool Seek(size_t messageNumber) override;
+    auto Read() -> std::shared_ptr<SilKit::IReplayMessage> override;
+
+    // Interface IIndexedReplayChannelReader
+    auto CountMessagesBefore(std::chrono::nanoseconds end) const -> size_t override;
+
+private:
+    struct Packet
+    {
+        std::chrono::nanoseconds timestamp;
+        size_t offset; //!< offset of the frame in the file
+        size_t size;
+    };
+
+    struct Index
+    {
+        std::vector<Packet> packets;
+        bool ordered{true}; //!< timestamps are non-decreasing, which allows binary searches
+    };
+
+private:
+    // Methods
+    void ReadGlobalHeader();
+    void IndexPackets();
+
+private:
+    std::string _filePath;
+    std::shared_ptr<const Detail::MappedFile> _file;
+    std::shared_ptr<const Index> _index;
+    std::map<std::string, std::string> _metaInfos;
+    size_t _position{0};
+    std::shared_ptr<IReplayMessage> _currentMessage;
+    SilKit::Services::Logging::ILogger* _log{nullptr};
+};
+
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "IReplay.hpp"
+#include "WireEthernetMessages.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+//! \brief An Ethernet frame read from a PCAP file.
+class PcapMessage
+    : public SilKit::IReplayMessage
+    , public SilKit::Services::Ethernet::WireEthernetFrame
+{
+public:
+    auto Timestamp() const -> std::chrono::nanoseconds override;
+    void SetTimestamp(std::chrono::nanoseconds timeStamp);
+    auto GetDirection() const -> SilKit::Services::TransmitDirection override;
+    auto ServiceDescriptorStr() const -> std::string override;
+    auto EndpointAddress() const -> SilKit::Core::EndpointAddress override;
+    auto Type() const -> SilKit::TraceMessageType override;
+
+private:
+    std::chrono::nanoseconds _timeStamp{0};
+    SilKit::Services::TransmitDirection _direction{SilKit::Services::TransmitDirection::TX};
+    std::string _serviceDescriptorStr;
+};
+
+} // namespace Tracing
+} // namespace SilKit
@@ -19,6 +19,7 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "PcapReader.hpp"
+#include "PcapMessage.hpp"
 
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
@@ -32,27 +33,9 @@ namespace Tracing {
 using namespace SilKit::Services::Logging;
 
 //////////////////////////////////////////////////////////////////////
-// PcapMessage -- internal only
+// PcapMessage
 //////////////////////////////////////////////////////////////////////
 
-class PcapMessage
-    : public SilKit::IReplayMessage
-    , public SilKit::Services::Ethernet::WireEthernetFrame
-{
-public:
-    auto Timestamp() const -> std::chrono::nanoseconds override;
-    void SetTimestamp(std::chrono::nanoseconds timeStamp);
-    auto GetDirection() const -> SilKit::Services::TransmitDirection override;
-    auto ServiceDescriptorStr() const -> std::string override;
-    auto EndpointAddress() const -> SilKit::Core::EndpointAddress override;
-    auto Type() const -> SilKit::TraceMessageType override;
-
-private:
-    std::chrono::nanoseconds _timeStamp{0};
-    SilKit::Services::TransmitDirection _direction{SilKit::Services::TransmitDirection::TX};
-    std::string _serviceDescriptorStr;
-};
-
 void PcapMessage::SetTimestamp(std::chrono::nanoseconds timeStamp)
 {
     _timeStamp = timeStamp;
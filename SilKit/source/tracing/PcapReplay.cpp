@@ -25,7 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
 #include "IReplay.hpp"
-#include "PcapReader.hpp"
+#include "MappedPcapReader.hpp"
 
 namespace {
 
@@ -34,7 +34,7 @@ using namespace SilKit::Tracing;
 
 //////////////////////////////////////////////////////////////////////
 // IReplay: Boilerplate to satisfy interfaces follows.
-//          Actual implementation is in PcapReader.
+//          Actual implementation is in MappedPcapReader.
 //////////////////////////////////////////////////////////////////////
 
 class ReplayPcapChannel : public SilKit::IReplayChannel
@@ -75,13 +75,13 @@ public:
     }
     auto GetReader() -> std::shared_ptr<SilKit::IReplayChannelReader> override
     {
-        // return a copy, which allows caching the internal data structures
-        // for seeking. It is reset to start reading at the beginning.
-        return std::make_shared<PcapReader>(_reader);
+        // return a copy, which shares the file mapping and the packet index.
+        // It is reset to start reading at the beginning.
+        return std::make_shared<MappedPcapReader>(_reader);
     }
 
 private:
-    PcapReader _reader;
+    MappedPcapReader _reader;
     const std::string _channelName{"PcapChannel0"};
 };
 
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "PcapSink.hpp"
 
 #include <string>
+#include <cstring>
 #include <ctime>
 #include <sstream>
 
@@ -40,6 +41,8 @@ using namespace SilKit::Services::Logging;
 
 namespace {
 constexpr Pcap::GlobalHeader g_pcapGlobalHeader{};
+// packets are collected in the stream buffer and reach the file in large writes
+constexpr std::size_t g_fileBufferSize{256 * 1024};
 } // namespace
 
 PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name)
@@ -50,6 +53,8 @@ PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name)
 
 void PcapSink::Open(SinkType outputType, const std::string& outputPath)
 {
+    std::unique_lock<decltype(_lock)> lock{_lock};
+
     if (outputPath.empty())
     {
         throw SilKitError("PcapSink::Open: outputPath must not be empty!");
@@ -62,6 +67,8 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
         {
             _file.close();
         }
+        _fileBuffer.resize(g_fileBufferSize);
+        _file.rdbuf()->pubsetbuf(_fileBuffer.data(), static_cast<std::streamsize>(_fileBuffer.size()));
         _file.open(outputPath, std::ios::out | std::ios::binary);
         _file.write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
         break;
@@ -88,6 +95,8 @@ auto PcapSink::Name() const -> const std::string&
 
 void PcapSink::Close()
 {
+    std::unique_lock<decltype(_lock)> lock{_lock};
+
     if (_file)
     {
         _file.flush();
@@ -120,7 +129,7 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     }
     const auto& message = traceMessage.Get<Services::Ethernet::EthernetFrame>();
 
-    std::unique_lock<decltype(_lock)> lock;
+    std::unique_lock<decltype(_lock)> lock{_lock};
 
     const auto tosec = 1000'000ull;
     const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
@@ -131,11 +140,15 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
     pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
 
+    // header and payload are written as one packet record
+    _packetBuffer.resize(sizeof(pcapPacketHeader) + message.raw.size());
+    memcpy(_packetBuffer.data(), &pcapPacketHeader, sizeof(pcapPacketHeader));
+    memcpy(_packetBuffer.data() + sizeof(pcapPacketHeader), message.raw.data(), message.raw.size());
+
     bool ok = true;
     if (_file.is_open())
     {
-        _file.write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
-        _file.write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
+        _file.write(_packetBuffer.data(), static_cast<std::streamsize>(_packetBuffer.size()));
         ok &= _file.good();
     }
 
@@ -152,8 +165,7 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
             _headerWritten = true;
         }
 
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
+        ok &= _pipe->Write(_packetBuffer.data(), _packetBuffer.size());
     }
 
     if (!ok)
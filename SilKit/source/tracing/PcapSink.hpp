@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <mutex>
 #include <fstream>
 #include <memory>
+#include <vector>
 
 #include "ITraceMessageSink.hpp"
 
@@ -60,7 +61,9 @@ private:
     // ----------------------------------------
     // Private members
     bool _headerWritten{false};
+    std::vector<char> _fileBuffer; //!< stream buffer of _file, must outlive it
     std::ofstream _file;
+    std::vector<char> _packetBuffer;
     std::unique_ptr<Detail::NamedPipe> _pipe;
     std::mutex _lock;
     std::string _name;
@@ -357,10 +357,16 @@ void ReplayScheduler::ConfigureController(const std::string& controllerName, IRe
         }
 
         task.replayReader = replayChannel->GetReader();
+        task.indexedReader = dynamic_cast<IIndexedReplayChannelReader*>(task.replayReader.get());
         task.initialTime = replayChannel->StartTime();
         task.name = replayChannel->Name();
         task.replayFile = std::move(replayFile);
 
+        std::unique_lock<decltype(_prefetchMutex)> lock{_prefetchMutex};
+        if (task.indexedReader != nullptr && !_prefetchThread.joinable())
+        {
+            _prefetchThread = std::thread{[this] { PrefetchLoop(); }};
+        }
         _replayTasks.emplace_back(std::move(task));
     }
     catch (const SilKit::ConfigurationError& ex)
@@ -388,6 +394,17 @@ void ReplayScheduler::CreateReplayFiles(const Config::ParticipantConfiguration&
 ReplayScheduler::~ReplayScheduler()
 {
     _isDone = true;
+
+    {
+        std::unique_lock<decltype(_prefetchMutex)> lock{_prefetchMutex};
+        _stopPrefetching = true;
+    }
+    _prefetchRequest.notify_all();
+
+    if (_prefetchThread.joinable())
+    {
+        _prefetchThread.join();
+    }
 }
 
 void ReplayScheduler::ReplayMessages(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
@@ -411,6 +428,11 @@ void ReplayScheduler::ReplayMessages(std::chrono::nanoseconds now, std::chrono::
     const auto relativeNow = now - _startTime;
     SILKIT_ASSERT(relativeNow.count() >= 0);
     const auto relativeEnd = relativeNow + duration;
+
+    std::unique_lock<decltype(_prefetchMutex)> lock{_prefetchMutex};
+    _prefetchDone.wait(lock, [this] { return !_prefetchRequested; });
+
+    bool prefetch = false;
     for (auto& task : _replayTasks)
     {
         if (task.doneReplaying)
@@ -418,35 +440,132 @@ void ReplayScheduler::ReplayMessages(std::chrono::nanoseconds now, std::chrono::
             continue;
         }
 
-        while (true)
+        if (task.indexedReader != nullptr)
         {
-            auto msg = task.replayReader->Read();
-            if (!msg)
-            {
-                Services::Logging::Trace(_log, "ReplayTask on channel '{}' returned invalid message @{}ns", task.name,
-                                         now.count());
-                task.doneReplaying = true;
-                break;
-            }
+            ReplayIndexedTaskMessages(task, relativeEnd);
+            prefetch |= !task.doneReplaying;
+        }
+        else
+        {
+            ReplayTaskMessages(task, now, relativeEnd);
+        }
+    }
 
-            const auto msgNow = msg->Timestamp();
-            if (msgNow >= relativeEnd)
-            {
-                //message is after the current schedule
-                break;
-            }
+    if (prefetch)
+    {
+        // assume the next step is as long as this one
+        _prefetchEnd = relativeEnd + duration;
+        _prefetchRequested = true;
+        lock.unlock();
+        _prefetchRequest.notify_one();
+    }
+}
+
+void ReplayScheduler::ReplayTaskMessages(ReplayTask& task, std::chrono::nanoseconds now,
+                                         std::chrono::nanoseconds relativeEnd)
+{
+    while (true)
+    {
+        auto msg = task.replayReader->Read();
+        if (!msg)
+        {
+            Services::Logging::Trace(_log, "ReplayTask on channel '{}' returned invalid message @{}ns", task.name,
+                                     now.count());
+            task.doneReplaying = true;
+            break;
+        }
+
+        const auto msgNow = msg->Timestamp();
+        if (msgNow >= relativeEnd)
+        {
+            //message is after the current schedule
+            break;
+        }
+
+        //NB: Currently, the messages are batched at the beginning of the schedule.
+        //    When using wallclock time provider, the message timestamps might be off.
+        task.controller->ReplayMessage(msg.get());
+
+        if (!task.replayReader->Seek(1))
+        {
+            // we're at the end of the replay channel
+            task.doneReplaying = true;
+            break;
+        }
+    }
+}
+
+void ReplayScheduler::ReplayIndexedTaskMessages(ReplayTask& task, std::chrono::nanoseconds relativeEnd)
+{
+    // usually the prefetch thread already read the messages of this step
+    ReadAhead(task, relativeEnd);
+
+    auto& pending = task.pendingMessages;
+    while (!pending.empty() && pending.front()->Timestamp() < relativeEnd)
+    {
+        task.controller->ReplayMessage(pending.front().get());
+        pending.pop_front();
+    }
+
+    if (pending.empty() && task.readerExhausted)
+    {
+        task.doneReplaying = true;
+    }
+}
 
-            //NB: Currently, the messages are batched at the beginning of the schedule.
-            //    When using wallclock time provider, the message timestamps might be off.
-            task.controller->ReplayMessage(msg.get());
+void ReplayScheduler::ReadAhead(ReplayTask& task, std::chrono::nanoseconds end)
+{
+    if (task.readerExhausted)
+    {
+        return;
+    }
+
+    const auto count = task.indexedReader->CountMessagesBefore(end);
+    if (count == 0 && !task.replayReader->Read())
+    {
+        task.readerExhausted = true;
+        return;
+    }
 
-            if (!task.replayReader->Seek(1))
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto msg = task.replayReader->Read();
+        if (!msg)
+        {
+            task.readerExhausted = true;
+            break;
+        }
+        task.pendingMessages.emplace_back(std::move(msg));
+
+        if (!task.replayReader->Seek(1))
+        {
+            task.readerExhausted = true;
+            break;
+        }
+    }
+}
+
+void ReplayScheduler::PrefetchLoop()
+{
+    std::unique_lock<decltype(_prefetchMutex)> lock{_prefetchMutex};
+    while (true)
+    {
+        _prefetchRequest.wait(lock, [this] { return _prefetchRequested || _stopPrefetching; });
+        if (_stopPrefetching)
+        {
+            return;
+        }
+
+        for (auto& task : _replayTasks)
+        {
+            if (task.indexedReader != nullptr && !task.doneReplaying)
             {
-                // we're at the end of the replay channel
-                task.doneReplaying = true;
-                break;
+                ReadAhead(task, _prefetchEnd);
             }
         }
+
+        _prefetchRequested = false;
+        _prefetchDone.notify_all();
     }
 }
 
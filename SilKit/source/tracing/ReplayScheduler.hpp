@@ -22,6 +22,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -29,6 +33,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantConfiguration.hpp"
 #include "ITimeProvider.hpp"
 #include "IReplayDataController.hpp"
+#include "IIndexedReplayChannelReader.hpp"
 #include "ISimulator.hpp"
 
 namespace SilKit {
@@ -62,10 +67,20 @@ private:
         std::string name;
         IReplayDataController* controller{nullptr};
         std::shared_ptr<IReplayChannelReader> replayReader;
+        //! Set if the reader supports reading ahead of the simulation
+        IIndexedReplayChannelReader* indexedReader{nullptr};
+        //! Messages read ahead, which are not replayed yet
+        std::deque<std::shared_ptr<IReplayMessage>> pendingMessages;
+        bool readerExhausted{false};
         std::chrono::nanoseconds initialTime{0};
         bool doneReplaying{false};
     };
 
+    void ReplayTaskMessages(ReplayTask& task, std::chrono::nanoseconds now, std::chrono::nanoseconds relativeEnd);
+    void ReplayIndexedTaskMessages(ReplayTask& task, std::chrono::nanoseconds relativeEnd);
+    void ReadAhead(ReplayTask& task, std::chrono::nanoseconds end);
+    void PrefetchLoop();
+
     std::chrono::nanoseconds _startTime{std::chrono::nanoseconds::min()};
     Services::Logging::ILogger* _log{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
@@ -75,6 +90,16 @@ private:
     std::vector<std::string> _knownSimulators;
 
     std::map<std::string, std::shared_ptr<IReplayFile>> _replayFiles;
+
+    // The prefetch thread reads the messages of the next step window of indexed readers,
+    // while the current simulation step is executed. It holds the mutex while reading.
+    std::mutex _prefetchMutex;
+    std::condition_variable _prefetchRequest;
+    std::condition_variable _prefetchDone;
+    std::chrono::nanoseconds _prefetchEnd{0};
+    bool _prefetchRequested{false};
+    bool _stopPrefetching{false};
+    std::thread _prefetchThread;
 };
 
 } // namespace Tracing
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "AsyncTraceMessageSink.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using namespace SilKit;
+using namespace SilKit::Tracing;
+using namespace SilKit::Services::Ethernet;
+
+// Records the traced frames; writing can be held back to let the queue fill up.
+class RecordingSink : public ITraceMessageSink
+{
+public:
+    void Open(SinkType, const std::string&) override {}
+
+    void Close() override
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        closeCount++;
+    }
+
+    void Trace(Services::TransmitDirection, const Core::ServiceDescriptor&, std::chrono::nanoseconds timestamp,
+               const TraceMessage& message) override
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        writeAllowed.wait(lock, [this] { return !holdWrites; });
+
+        const auto& frame = message.Get<EthernetFrame>();
+        frames.emplace_back(frame.raw.begin(), frame.raw.end());
+        timestamps.push_back(timestamp);
+    }
+
+    auto GetLogger() const -> Services::Logging::ILogger* override
+    {
+        return nullptr;
+    }
+
+    auto Name() const -> const std::string& override
+    {
+        return name;
+    }
+
+    void ReleaseWrites()
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            holdWrites = false;
+        }
+        writeAllowed.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable writeAllowed;
+    bool holdWrites{false};
+    int closeCount{0};
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<std::chrono::nanoseconds> timestamps;
+    const std::string name{"RecordingSink"};
+};
+
+void TraceFrame(ITraceMessageSink& sink, std::vector<uint8_t>& raw, std::chrono::nanoseconds timestamp)
+{
+    EthernetFrame frame{raw};
+    sink.Trace(Services::TransmitDirection::TX, Core::ServiceDescriptor{}, timestamp, TraceMessage{frame});
+}
+
+TEST(Test_AsyncTraceMessageSink, records_are_written_in_order_with_owned_payloads)
+{
+    auto recordingSink = std::make_unique<RecordingSink>();
+    auto* recorder = recordingSink.get();
+    AsyncTraceMessageSink sink{std::move(recordingSink), 16, AsyncTraceMessageSink::OverflowPolicy::Block};
+
+    std::vector<uint8_t> raw{1, 2, 3, 4};
+    for (auto i = 0; i < 100; ++i)
+    {
+        raw[0] = static_cast<uint8_t>(i);
+        TraceFrame(sink, raw, std::chrono::nanoseconds{i});
+    }
+    // the caller's buffer may be reused right after the trace call
+    raw[0] = 0xff;
+
+    sink.Close();
+
+    ASSERT_EQ(recorder->frames.size(), 100u);
+    for (auto i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(recorder->frames[i], (std::vector<uint8_t>{static_cast<uint8_t>(i), 2, 3, 4}));
+        EXPECT_EQ(recorder->timestamps[i], std::chrono::nanoseconds{i});
+    }
+    EXPECT_EQ(sink.GetQueueDepth(), 0u);
+    EXPECT_EQ(sink.GetDroppedRecordCount(), 0u);
+    EXPECT_EQ(recorder->closeCount, 1);
+}
+
+TEST(Test_AsyncTraceMessageSink, full_queue_drops_records_with_drop_policy)
+{
+    auto recordingSink = std::make_unique<RecordingSink>();
+    auto* recorder = recordingSink.get();
+    recorder->holdWrites = true;
+
+    const std::size_t queueSize = 4;
+    AsyncTraceMessageSink sink{std::move(recordingSink), queueSize, AsyncTraceMessageSink::OverflowPolicy::Drop};
+
+    std::vector<uint8_t> raw{1, 2, 3, 4};
+    const std::size_t numRecords = 20;
+    for (std::size_t i = 0; i < numRecords; ++i)
+    {
+        TraceFrame(sink, raw, std::chrono::nanoseconds{i});
+    }
+
+    // the writer holds at most one batch while it is blocked, the queue at most queueSize records
+    EXPECT_LE(sink.GetQueueDepth(), queueSize);
+    EXPECT_GE(sink.GetDroppedRecordCount(), numRecords - 2 * queueSize);
+
+    recorder->ReleaseWrites();
+    sink.Close();
+
+    EXPECT_EQ(recorder->frames.size() + sink.GetDroppedRecordCount(), numRecords);
+}
+
+TEST(Test_AsyncTraceMessageSink, close_is_idempotent)
+{
+    auto recordingSink = std::make_unique<RecordingSink>();
+    auto* recorder = recordingSink.get();
+    AsyncTraceMessageSink sink{std::move(recordingSink), 16, AsyncTraceMessageSink::OverflowPolicy::Block};
+    sink.Close();
+    sink.Close();
+    EXPECT_EQ(recorder->closeCount, 1);
+
+    // tracing after closing is ignored
+    std::vector<uint8_t> raw{1, 2, 3, 4};
+    TraceFrame(sink, raw, std::chrono::nanoseconds{0});
+    EXPECT_TRUE(recorder->frames.empty());
+
+    // reopening restarts the writer
+    sink.Open(SinkType::PcapFile, "unused");
+    TraceFrame(sink, raw, std::chrono::nanoseconds{1});
+    sink.Close();
+    EXPECT_EQ(recorder->frames.size(), 1u);
+    EXPECT_EQ(recorder->closeCount, 2);
+}
+
+} // namespace
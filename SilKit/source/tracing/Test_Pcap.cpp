@@ -20,8 +20,11 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "PcapReader.hpp"
+#include "MappedPcapReader.hpp"
 
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
@@ -107,4 +110,61 @@ TEST(Test_Pcap, read_from_pcap)
     EXPECT_EQ((int)numMessages, 10);
 }
 
+TEST(Test_Pcap, read_from_mapped_pcap)
+{
+    MockLogger log;
+
+    WireEthernetFrame testInput;
+    auto raw = MakePcapTestData(testInput, 10);
+
+    const std::string filePath{"Test_Pcap_read_from_mapped_pcap.pcap"};
+    {
+        std::ofstream file{filePath, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw.data()), raw.size());
+    }
+
+    std::shared_ptr<SilKit::IReplayMessage> firstMessage;
+    {
+        MappedPcapReader channelReader{filePath, &log};
+        EXPECT_EQ(channelReader.NumberOfMessages(), 10u);
+        EXPECT_EQ(channelReader.StartTime(), std::chrono::seconds{0});
+        EXPECT_EQ(channelReader.EndTime(), std::chrono::seconds{9} + std::chrono::microseconds{9});
+
+        // copies share the index and start at the first message
+        MappedPcapReader reader{channelReader};
+
+        // message i has the timestamp i s + i us
+        EXPECT_EQ(reader.CountMessagesBefore(std::chrono::seconds{0}), 0u);
+        EXPECT_EQ(reader.CountMessagesBefore(std::chrono::seconds{3}), 3u);
+        EXPECT_EQ(reader.CountMessagesBefore(std::chrono::seconds{100}), 10u);
+
+        auto numMessages = 0u;
+        while (auto msg = reader.Read())
+        {
+            if (numMessages == 0)
+            {
+                firstMessage = msg;
+            }
+            numMessages++;
+
+            EXPECT_EQ(msg->Timestamp(), std::chrono::seconds{numMessages - 1}
+                                            + std::chrono::microseconds{numMessages - 1});
+            auto& ethMsg = dynamic_cast<WireEthernetFrame&>(*msg);
+            ASSERT_TRUE(ItemsAreEqual(ethMsg.raw.AsSpan(), testInput.raw.AsSpan()));
+
+            const auto seeked = reader.Seek(1);
+            EXPECT_EQ(seeked, numMessages < 10);
+            EXPECT_EQ(reader.CountMessagesBefore(std::chrono::seconds{3}), numMessages < 3 ? 3 - numMessages : 0);
+        }
+        EXPECT_EQ(numMessages, 10u);
+    }
+
+    // frames refer to the mapping, which they keep alive
+    auto& ethMsg = dynamic_cast<WireEthernetFrame&>(*firstMessage);
+    EXPECT_TRUE(ItemsAreEqual(ethMsg.raw.AsSpan(), testInput.raw.AsSpan()));
+
+    firstMessage.reset();
+    std::remove(filePath.c_str());
+}
+
 } // namespace
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <sstream>
 
 #include "CreateMdf4Tracing.hpp"
+#include "AsyncTraceMessageSink.hpp"
 #include "PcapSink.hpp"
 #include "Tracing.hpp"
 #include "PcapReplay.hpp"
@@ -83,34 +84,40 @@ auto CreateTraceMessageSinks(Services::Logging::ILogger* logger,
                 sinkCfg.name, participantConfig.participantName);
         }
 
+        std::unique_ptr<ITraceMessageSink> sink;
         switch (sinkCfg.type)
         {
         case Config::TraceSink::Type::Mdf4File:
         {
             //the `config' contains information about the links, which
             // will be useful when naming the MDF4 channels
-            auto sink = CreateMdf4Tracing(participantConfig, logger, participantConfig.participantName, sinkCfg.name);
+            sink = CreateMdf4Tracing(participantConfig, logger, participantConfig.participantName, sinkCfg.name);
             sink->Open(SinkType::Mdf4File, sinkCfg.outputPath);
-            newSinks.emplace_back(std::move(sink));
             break;
         }
         case Config::TraceSink::Type::PcapFile:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
             sink->Open(SinkType::PcapFile, sinkCfg.outputPath);
-            newSinks.emplace_back(std::move(sink));
             break;
         }
         case Config::TraceSink::Type::PcapPipe:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
             sink->Open(SinkType::PcapNamedPipe, sinkCfg.outputPath);
-            newSinks.emplace_back(std::move(sink));
             break;
         }
         default:
             throw SilKitError("Unknown Sink Type");
         }
+
+        if (sinkCfg.queueSize > 0)
+        {
+            // writing (and waiting for pipe readers) happens on the sink's writer thread, not the tracing thread
+            sink = std::make_unique<AsyncTraceMessageSink>(
+                std::move(sink), static_cast<std::size_t>(sinkCfg.queueSize), sinkCfg.overflowPolicy);
+        }
+        newSinks.emplace_back(std::move(sink));
     }
 
     return newSinks;
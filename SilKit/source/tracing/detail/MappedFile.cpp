@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MappedFile.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+namespace {
+
+auto MakeErrorMessage(const char* operation, const std::string& path, const std::string& reason) -> std::string
+{
+    std::ostringstream ss;
+    ss << "Cannot map file \"" << path << "\": " << operation << " failed: " << reason;
+    return ss.str();
+}
+
+} // namespace
+
+#if defined(_WIN32)
+
+auto MappedFile::Open(const std::string& path) -> std::shared_ptr<MappedFile>
+{
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw SilKitError{MakeErrorMessage("CreateFile", path, std::to_string(::GetLastError()))};
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        ::CloseHandle(file);
+        throw SilKitError{MakeErrorMessage("GetFileSizeEx", path, "file is empty or cannot be accessed")};
+    }
+
+    HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // the mapping keeps the file open
+    ::CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        throw SilKitError{MakeErrorMessage("CreateFileMapping", path, std::to_string(::GetLastError()))};
+    }
+
+    const void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    const auto error = ::GetLastError();
+    // the view keeps the mapping object alive
+    ::CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        throw SilKitError{MakeErrorMessage("MapViewOfFile", path, std::to_string(error))};
+    }
+
+    return std::shared_ptr<MappedFile>{
+        new MappedFile{static_cast<const uint8_t*>(data), static_cast<size_t>(fileSize.QuadPart)}};
+}
+
+MappedFile::~MappedFile()
+{
+    ::UnmapViewOfFile(_data);
+}
+
+#else
+
+auto MappedFile::Open(const std::string& path) -> std::shared_ptr<MappedFile>
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw SilKitError{MakeErrorMessage("open", path, std::strerror(errno))};
+    }
+
+    struct stat status = {};
+    if (::fstat(fd, &status) != 0 || status.st_size == 0)
+    {
+        ::close(fd);
+        throw SilKitError{MakeErrorMessage("fstat", path, "file is empty or cannot be accessed")};
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const auto error = errno;
+    // the mapping keeps the file open
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw SilKitError{MakeErrorMessage("mmap", path, std::strerror(error))};
+    }
+
+    // traces are replayed front to back
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    return std::shared_ptr<MappedFile>{new MappedFile{static_cast<const uint8_t*>(data), size}};
+}
+
+MappedFile::~MappedFile()
+{
+    ::munmap(const_cast<uint8_t*>(_data), _size);
+}
+
+#endif
+
+MappedFile::MappedFile(const uint8_t* data, size_t size)
+    : _data{data}
+    , _size{size}
+{
+}
+
+auto MappedFile::Data() const -> const uint8_t*
+{
+    return _data;
+}
+
+auto MappedFile::Size() const -> size_t
+{
+    return _size;
+}
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
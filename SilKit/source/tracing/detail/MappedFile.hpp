@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+//! \brief A file mapped read-only into memory. The mapping lives as long as the object.
+class MappedFile
+{
+public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    //! \brief Maps the whole file, throws SilKitError if it cannot be opened or mapped.
+    static auto Open(const std::string& path) -> std::shared_ptr<MappedFile>;
+
+    auto Data() const -> const uint8_t*;
+    auto Size() const -> size_t;
+
+private:
+    MappedFile(const uint8_t* data, size_t size);
+
+private:
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+};
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
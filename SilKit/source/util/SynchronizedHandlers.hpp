@@ -23,8 +23,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/util/HandlerId.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -90,43 +96,161 @@ private:
     std::underlying_type_t<HandlerId> _nextHandlerId = 0;
 };
 
+namespace Detail {
+
+/// The handler entries currently invoked by the calling thread, used to detect re-entrant removal.
+inline auto CurrentlyInvokedHandlers() -> std::vector<const void *> &
+{
+    static thread_local std::vector<const void *> currentlyInvokedHandlers;
+    return currentlyInvokedHandlers;
+}
+
+} // namespace Detail
+
+/// Thread-safe container for callables. InvokeAll scans an immutable snapshot of the handlers, which is replaced
+/// (copy-on-write) by Add, Remove and Clear. A replaced snapshot is deleted as soon as the last InvokeAll using it
+/// returns. Handlers may be added and removed from within a handler.
+///
+/// Calls of InvokeAll from different threads are serialized, so the handlers of one container never run concurrently
+/// (e.g., a frame delivered to the sending controller on the user's thread and one received on the I/O thread). Add,
+/// Remove and Clear do not wait for InvokeAll to return, only Remove and Clear wait for the removed handlers.
 template <typename Callable>
 class SynchronizedHandlers
 {
-    using Mutex = std::recursive_mutex;
+    using Mutex = std::mutex;
+
+    struct Entry
+    {
+        template <typename... T>
+        explicit Entry(HandlerId handlerId, T &&...t)
+            : id{handlerId}
+            , callable{std::forward<T>(t)...}
+        {
+        }
+
+        const HandlerId id;
+        Callable callable;
+        std::atomic<bool> removed{false};
+        std::atomic<uint32_t> activeInvocations{0};
+    };
+
+    // NB: the entries are never modified after the snapshot has been published, they are ordered by their handler id
+    struct Snapshot
+    {
+        std::vector<std::shared_ptr<Entry>> entries;
+        // the number of readers using the snapshot, the RETIRED flag is set once it has been replaced
+        std::atomic<size_t> state{0};
+    };
+
+    static constexpr size_t RETIRED = size_t{1} << (sizeof(size_t) * 8 - 1);
 
 public:
-    SynchronizedHandlers() = default;
+    SynchronizedHandlers()
+        : _snapshot{new Snapshot{}}
+    {
+    }
+
+    SynchronizedHandlers(const SynchronizedHandlers &) = delete;
+    SynchronizedHandlers &operator=(const SynchronizedHandlers &) = delete;
+
+    ~SynchronizedHandlers()
+    {
+        delete _snapshot.load();
+    }
 
     template <typename... T>
     auto Add(T &&...t) -> HandlerId
     {
-        const auto lock = MakeUniqueLock();
-        return _handlers.Add(std::forward<T>(t)...);
+        auto lock = MakeUniqueLock();
+
+        const auto handlerId = static_cast<HandlerId>(_nextHandlerId++);
+
+        auto snapshot = CopySnapshot(*_snapshot.load());
+        snapshot->entries.emplace_back(std::make_shared<Entry>(handlerId, std::forward<T>(t)...));
+        Publish(std::move(snapshot), lock);
+
+        return handlerId;
     }
 
     auto Remove(const HandlerId handlerId) -> bool
     {
-        const auto lock = MakeUniqueLock();
-        return _handlers.Remove(handlerId);
+        auto lock = MakeUniqueLock();
+
+        const auto &entries = _snapshot.load()->entries;
+        const auto it = std::find_if(entries.begin(), entries.end(),
+                                     [handlerId](const auto &entry) { return entry->id == handlerId; });
+        if (it == entries.end())
+        {
+            return false;
+        }
+
+        const auto entry = *it;
+        entry->removed = true;
+
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->entries.reserve(entries.size() - 1);
+        std::copy_if(entries.begin(), entries.end(), std::back_inserter(snapshot->entries),
+                     [handlerId](const auto &entry) { return entry->id != handlerId; });
+        Publish(std::move(snapshot), lock);
+
+        WaitUntilNotInvokedByOtherThreads(*entry);
+        return true;
     }
 
     template <typename... T>
     bool InvokeAll(T &&...t)
     {
-        const auto lock = MakeUniqueLock();
-        return _handlers.InvokeAll(std::forward<T>(t)...);
+        // NB: recursive, since handlers may trigger the invocation of the same handlers
+        std::lock_guard<std::recursive_mutex> invokeAllLock{_invokeAllMutex};
+
+        ReaderGuard readerGuard{*this};
+
+        const Snapshot *snapshot = readerGuard.GetSnapshot();
+        size_t index = 0;
+
+        while (true)
+        {
+            for (; index < snapshot->entries.size(); ++index)
+            {
+                Invoke(*snapshot->entries[index], t...);
+            }
+
+            // handlers added by the invoked handlers are invoked as well
+            if (_snapshot.load() == snapshot)
+            {
+                break;
+            }
+
+            const auto lastHandlerId = index == 0 ? HandlerId{} : snapshot->entries[index - 1]->id;
+            snapshot = readerGuard.SwitchToCurrentSnapshot();
+            index = index == 0 ? 0 : FindFirstEntryAfter(*snapshot, lastHandlerId);
+        }
+
+        return !snapshot->entries.empty();
     }
 
     void Clear()
     {
-        const auto lock = MakeUniqueLock();
-        _handlers.Clear();
+        auto lock = MakeUniqueLock();
+
+        const auto entries = _snapshot.load()->entries;
+        for (const auto &entry : entries)
+        {
+            entry->removed = true;
+        }
+
+        Publish(std::make_unique<Snapshot>(), lock);
+
+        for (const auto &entry : entries)
+        {
+            WaitUntilNotInvokedByOtherThreads(*entry);
+        }
     }
 
     auto Size() -> size_t
     {
-        return _handlers.Size();
+        const ReaderGuard readerGuard{*this};
+        return readerGuard.GetSnapshot()->entries.size();
     }
 
 public:
@@ -142,11 +266,194 @@ public:
 
         std::lock(aLock, bLock);
 
+        // readers of either container may still use the current snapshots, so each container publishes a copy of
+        // the other one's snapshot and retires its own
+        auto aSnapshot = CopySnapshot(*b._snapshot.load());
+        auto bSnapshot = CopySnapshot(*a._snapshot.load());
+
         using std::swap;
-        swap(a._handlers, b._handlers);
+        swap(a._nextHandlerId, b._nextHandlerId);
+
+        a.Publish(std::move(aSnapshot), aLock);
+        b.Publish(std::move(bSnapshot), bLock);
     }
 
 private:
+    /// Holds a reference to the current snapshot, which keeps it from being deleted.
+    class ReaderGuard
+    {
+    public:
+        explicit ReaderGuard(SynchronizedHandlers &handlers)
+            : _handlers{handlers}
+            , _snapshot{handlers.AcquireSnapshot()}
+        {
+        }
+
+        ReaderGuard(const ReaderGuard &) = delete;
+        ReaderGuard &operator=(const ReaderGuard &) = delete;
+
+        ~ReaderGuard()
+        {
+            _handlers.ReleaseSnapshot(_snapshot);
+        }
+
+        auto GetSnapshot() const -> const Snapshot *
+        {
+            return _snapshot;
+        }
+
+        auto SwitchToCurrentSnapshot() -> const Snapshot *
+        {
+            Snapshot *previous = _snapshot;
+            _snapshot = _handlers.AcquireSnapshot();
+            _handlers.ReleaseSnapshot(previous);
+            return _snapshot;
+        }
+
+    private:
+        SynchronizedHandlers &_handlers;
+        Snapshot *_snapshot;
+    };
+
+    struct InvocationGuard
+    {
+        InvocationGuard(SynchronizedHandlers &handlers, Entry &entry)
+            : _handlers{handlers}
+            , _entry{entry}
+        {
+            ++_entry.activeInvocations;
+            Detail::CurrentlyInvokedHandlers().push_back(&_entry);
+        }
+
+        ~InvocationGuard()
+        {
+            Detail::CurrentlyInvokedHandlers().pop_back();
+            --_entry.activeInvocations;
+
+            // NB: the flag is checked after the invocation has finished, see WaitUntilNotInvokedByOtherThreads
+            if (_entry.removed)
+            {
+                _handlers.NotifyInvocationFinished();
+            }
+        }
+
+        SynchronizedHandlers &_handlers;
+        Entry &_entry;
+    };
+
+    template <typename... T>
+    void Invoke(Entry &entry, T &...t)
+    {
+        const InvocationGuard invocationGuard{*this, entry};
+
+        // NB: the flag is checked after announcing the invocation, see WaitUntilNotInvokedByOtherThreads
+        if (!entry.removed)
+        {
+            entry.callable(t...);
+        }
+    }
+
+    static auto FindFirstEntryAfter(const Snapshot &snapshot, HandlerId handlerId) -> size_t
+    {
+        const auto it = std::upper_bound(snapshot.entries.begin(), snapshot.entries.end(), handlerId,
+                                         [](HandlerId id, const auto &entry) { return id < entry->id; });
+        return static_cast<size_t>(std::distance(snapshot.entries.begin(), it));
+    }
+
+    /// After returning, the removed handler is neither running nor started by any other thread. Invocations of the
+    /// handler by the calling thread (i.e., the handler removes itself) are not waited for.
+    void WaitUntilNotInvokedByOtherThreads(const Entry &entry)
+    {
+        const auto &currentlyInvokedHandlers = Detail::CurrentlyInvokedHandlers();
+        const auto ownInvocations = static_cast<uint32_t>(
+            std::count(currentlyInvokedHandlers.begin(), currentlyInvokedHandlers.end(), &entry));
+
+        std::unique_lock<Mutex> lock{_invocationMutex};
+        _invocationFinished.wait(lock, [&entry, ownInvocations] {
+            return entry.activeInvocations.load() <= ownInvocations;
+        });
+    }
+
+    void NotifyInvocationFinished()
+    {
+        // NB: the waiter checks the invocation count while holding the mutex, locking it here prevents lost wake-ups
+        {
+            std::lock_guard<Mutex> lock{_invocationMutex};
+        }
+        _invocationFinished.notify_all();
+    }
+
+    /// The snapshot is loaded and its reader count is incremented while _acquiringReaders is non-zero, which keeps a
+    /// snapshot replaced in between from being deleted.
+    auto AcquireSnapshot() -> Snapshot *
+    {
+        ++_acquiringReaders;
+        Snapshot *snapshot = _snapshot.load();
+        ++snapshot->state;
+        --_acquiringReaders;
+        return snapshot;
+    }
+
+    void ReleaseSnapshot(Snapshot *snapshot)
+    {
+        // NB: the snapshot may be deleted by another thread as soon as its reader count is decremented
+        if (snapshot->state.fetch_sub(1) == RETIRED + 1)
+        {
+            ReclaimRetiredSnapshots();
+        }
+    }
+
+    static auto CopySnapshot(const Snapshot &snapshot) -> std::unique_ptr<Snapshot>
+    {
+        auto copy = std::make_unique<Snapshot>();
+        copy->entries = snapshot.entries;
+        return copy;
+    }
+
+    /// Replaces the current snapshot. The previous one is deleted as soon as no InvokeAll is using it.
+    void Publish(std::unique_ptr<Snapshot> snapshot, std::unique_lock<Mutex> &lock)
+    {
+        Snapshot *previous = _snapshot.exchange(snapshot.release());
+        previous->state |= RETIRED;
+        _retiredSnapshots.emplace_back(previous);
+
+        auto garbage = TakeUnusedRetiredSnapshots();
+
+        // the handlers held by the garbage are destroyed without holding the lock
+        lock.unlock();
+    }
+
+    void ReclaimRetiredSnapshots()
+    {
+        std::vector<std::unique_ptr<Snapshot>> garbage;
+
+        {
+            auto lock = MakeUniqueLock();
+            garbage = TakeUnusedRetiredSnapshots();
+        }
+    }
+
+    /// Retired snapshots which are skipped because a reader is being acquired are taken by the next modification or
+    /// release of a retired snapshot.
+    auto TakeUnusedRetiredSnapshots() -> std::vector<std::unique_ptr<Snapshot>>
+    {
+        std::vector<std::unique_ptr<Snapshot>> garbage;
+
+        // NB: a reader which started acquiring before a snapshot was retired may still increment its reader count
+        if (_acquiringReaders.load() != 0)
+        {
+            return garbage;
+        }
+
+        const auto unused =
+            std::stable_partition(_retiredSnapshots.begin(), _retiredSnapshots.end(),
+                                  [](const auto &snapshot) { return snapshot->state.load() != RETIRED; });
+        std::move(unused, _retiredSnapshots.end(), std::back_inserter(garbage));
+        _retiredSnapshots.erase(unused, _retiredSnapshots.end());
+
+        return garbage;
+    }
+
     auto MakeUniqueLock() const -> std::unique_lock<Mutex>
     {
         return std::unique_lock<Mutex>{_mutex};
@@ -158,10 +465,18 @@ private:
     }
 
 private:
+    std::atomic<Snapshot *> _snapshot;
+    std::atomic<size_t> _acquiringReaders{0};
+
+    // NB: only modified while holding the _mutex
     mutable Mutex _mutex;
+    std::vector<std::unique_ptr<Snapshot>> _retiredSnapshots;
+    std::underlying_type_t<HandlerId> _nextHandlerId = 0;
+
+    std::recursive_mutex _invokeAllMutex;
 
-    // NB: access to _handlers must be protected by locking the _mutex
-    Handlers<Callable> _handlers;
+    Mutex _invocationMutex;
+    std::condition_variable _invocationFinished;
 };
 
 } // namespace Util
@@ -92,7 +92,7 @@ auto Uri::Port() const -> uint16_t
         return *_port;
     }
     //return default value if not set
-    if (Type() == UriType::Local)
+    if (Type() == UriType::Local || Type() == UriType::SharedMemory)
     {
         return 0;
     }
@@ -166,8 +166,12 @@ auto Uri::Parse(std::string rawUri) -> Uri
     {
         uri.SetType(UriType::Local);
     }
+    else if (uri.Scheme() == "shm")
+    {
+        uri.SetType(UriType::SharedMemory);
+    }
 
-    if (uri.Type() == UriType::Local)
+    if (uri.Type() == UriType::Local || uri.Type() == UriType::SharedMemory)
     {
         //must be a path, might contain ':' (currently not quoted)
         uri._path = rawUri;
@@ -252,6 +256,8 @@ auto operator<<(std::ostream& ostream, UriType uriType) -> std::ostream&
         return ostream << "UriType::Tcp";
     case UriType::Local:
         return ostream << "UriType::Local";
+    case UriType::SharedMemory:
+        return ostream << "UriType::SharedMemory";
     default:
         return ostream << "UriType(" << static_cast<std::underlying_type_t<UriType>>(uriType) << ")";
     }
@@ -45,6 +45,7 @@ public:
         SilKit,
         Tcp,
         Local,
+        SharedMemory,
     };
 
 public:
@@ -24,8 +24,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <string>
 #include <iosfwd>
 
+#include <cstddef>
 #include <cstdint>
 
+#include "Hash.hpp"
+
 namespace SilKit {
 namespace Util {
 
@@ -47,5 +50,14 @@ auto operator<<(std::ostream& ostream, const Uuid& uuid) -> std::ostream&;
 
 auto to_string(const Uuid& uuid) -> std::string;
 
+//! Hash functor for using Uuid as a key of unordered containers.
+struct UuidHash
+{
+    auto operator()(const Uuid& uuid) const -> std::size_t
+    {
+        return static_cast<std::size_t>(Hash::HashCombine(uuid.ab, uuid.cd));
+    }
+};
+
 } // namespace Util
 } // namespace SilKit
\ No newline at end of file
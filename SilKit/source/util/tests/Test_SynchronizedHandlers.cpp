@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <set>
 #include <mutex>
 #include <atomic>
+#include <future>
 
 namespace {
 
@@ -251,4 +252,135 @@ TEST(Test_SynchronizedHandlers, swap_transfers_handlers)
     ASSERT_EQ(callCounter, 7);
 }
 
+TEST(Test_SynchronizedHandlers, handlers_removed_during_calling_are_not_called)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    Callbacks callbacks;
+
+    SilKit::Util::HandlerId hSelf{};
+    SilKit::Util::HandlerId hC{};
+
+    hSelf = callables.Add([&callables, &callbacks, &hSelf] {
+        callbacks.TestA();
+        // removing the running handler must not wait for itself
+        callables.Remove(hSelf);
+    });
+
+    callables.Add([&callables, &callbacks, &hC] {
+        callbacks.TestB();
+        callables.Remove(hC);
+    });
+
+    hC = callables.Add([&callbacks] { callbacks.TestC(); });
+
+    EXPECT_CALL(callbacks, TestA).Times(1);
+    EXPECT_CALL(callbacks, TestB).Times(2);
+    EXPECT_CALL(callbacks, TestC).Times(0);
+
+    EXPECT_TRUE(callables.InvokeAll());
+    EXPECT_EQ(callables.Size(), 1u);
+    EXPECT_TRUE(callables.InvokeAll());
+}
+
+TEST(Test_SynchronizedHandlers, remove_waits_for_running_handler)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    std::promise<void> handlerStarted;
+    std::promise<void> releaseHandler;
+    auto releaseHandlerFuture = releaseHandler.get_future().share();
+    std::atomic<bool> handlerFinished{false};
+
+    const auto handlerId = callables.Add([&handlerStarted, releaseHandlerFuture, &handlerFinished] {
+        handlerStarted.set_value();
+        releaseHandlerFuture.wait();
+        handlerFinished = true;
+    });
+
+    auto caller = std::thread{[&callables] { callables.InvokeAll(); }};
+    handlerStarted.get_future().wait();
+
+    auto remover = std::async(std::launch::async, [&callables, handlerId, &handlerFinished] {
+        const auto removed = callables.Remove(handlerId);
+        return removed && handlerFinished.load();
+    });
+
+    EXPECT_EQ(remover.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+    releaseHandler.set_value();
+
+    EXPECT_TRUE(remover.get());
+    caller.join();
+
+    EXPECT_FALSE(callables.InvokeAll());
+}
+
+TEST(Test_SynchronizedHandlers, removed_handler_is_destroyed_while_another_handler_is_running)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    std::promise<void> handlerStarted;
+    std::promise<void> releaseHandler;
+    auto releaseHandlerFuture = releaseHandler.get_future().share();
+
+    callables.Add([&handlerStarted, releaseHandlerFuture] {
+        handlerStarted.set_value();
+        releaseHandlerFuture.wait();
+    });
+
+    auto caller = std::thread{[&callables] { callables.InvokeAll(); }};
+    handlerStarted.get_future().wait();
+
+    // the running invocation only uses the handlers which existed when it started
+    auto token = std::make_shared<int>(0);
+    std::weak_ptr<int> weakToken = token;
+    const auto handlerId = callables.Add([token] {});
+    token.reset();
+    callables.Remove(handlerId);
+
+    EXPECT_TRUE(weakToken.expired());
+
+    releaseHandler.set_value();
+    caller.join();
+}
+
+TEST(Test_SynchronizedHandlers, invocations_from_different_threads_are_serialized)
+{
+    SilKit::Util::SynchronizedHandlers<TestFunction> callables;
+
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    std::atomic<int> nestedCalls{0};
+
+    callables.Add([&callables, &running, &maxRunning, &nestedCalls] {
+        const auto nowRunning = ++running;
+        maxRunning = std::max(maxRunning.load(), nowRunning);
+
+        // a handler may trigger the invocation of the same handlers on its own thread
+        if (nestedCalls++ % 2 == 0)
+        {
+            callables.InvokeAll();
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        --running;
+    });
+
+    const auto invokeRepeatedly = [&callables] {
+        for (int i = 0; i < 20; ++i)
+        {
+            callables.InvokeAll();
+        }
+    };
+
+    auto first = std::thread{invokeRepeatedly};
+    auto second = std::thread{invokeRepeatedly};
+    first.join();
+    second.join();
+
+    // the nested invocation runs while its caller is still running
+    EXPECT_EQ(maxRunning.load(), 2);
+    EXPECT_EQ(running.load(), 0);
+}
+
 } // namespace
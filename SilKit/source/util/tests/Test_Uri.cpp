@@ -151,6 +151,16 @@ TEST(Test_Uri, parse_local_scheme_posix_path)
 }
 
 
+TEST(Test_Uri, parse_shm_scheme_posix_path)
+{
+    Uri parsedUri{"shm:///one/two/three.shm"};
+    EXPECT_EQ(parsedUri.Type(), UriType::SharedMemory) << parsedUri.EncodedString();
+    EXPECT_EQ(parsedUri.Host(), "") << parsedUri.EncodedString();
+    EXPECT_EQ(parsedUri.Port(), 0) << parsedUri.EncodedString();
+    EXPECT_EQ(parsedUri.Path(), "/one/two/three.shm") << parsedUri.EncodedString();
+}
+
+
 TEST(Test_Uri, parse_local_scheme_windows_path_slash)
 {
     CheckLocalUri("local:///", "/");
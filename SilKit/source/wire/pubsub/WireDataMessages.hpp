@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SharedVector.hpp"
 
 #include <chrono>
+#include <memory>
 #include <vector>
 
 namespace SilKit {
@@ -37,6 +38,9 @@ struct WireDataMessageEvent
 {
     std::chrono::nanoseconds timestamp;
     Util::SharedVector<uint8_t> data;
+    //! Optional serialized representation of the whole message, which data refers into (see
+    //! MakeLoanedWireDataMessageEvent). It is sent without serializing the message again. Not part of the wire format.
+    std::shared_ptr<const std::vector<uint8_t>> serialized{};
 };
 
 inline auto ToDataMessageEvent(const WireDataMessageEvent& wireDataMessageEvent) -> DataMessageEvent;
@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -45,10 +46,17 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Refers to size elements at offset in the storage, without copying them
+    SharedVector(std::shared_ptr<std::vector<T>> storage, size_t offset, size_t size);
+
+    //! Refers to size elements at data, without copying them; data keeps the underlying storage alive
+    SharedVector(std::shared_ptr<const T> data, size_t size);
+
     auto AsSpan() const& -> Span<const T>;
 
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    std::shared_ptr<const T> _data;
+    size_t _size{0};
 };
 
 template <typename T>
@@ -66,15 +74,37 @@ SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
 
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
+    : _size{vector.size()}
 {
+    auto storage = std::make_shared<std::vector<T>>(std::move(vector));
+    _data = std::shared_ptr<const T>{storage, storage->data()};
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    auto storage = std::make_shared<std::vector<T>>(span.begin(), span.end());
+    storage->resize((std::max)(storage->size(), minimumSize), padValue);
+    _size = storage->size();
+    _data = std::shared_ptr<const T>{storage, storage->data()};
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<std::vector<T>> storage, const size_t offset, const size_t size)
+    : _size{size}
+{
+    if (storage == nullptr || offset + size > storage->size())
+    {
+        throw SilKit::OutOfRangeError{"SharedVector: view exceeds the storage"};
+    }
+    _data = std::shared_ptr<const T>{storage, storage->data() + offset};
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const T> data, const size_t size)
+    : _data{std::move(data)}
+    , _size{size}
+{
 }
 
 template <typename T>
@@ -82,7 +112,7 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
     if (_data)
     {
-        return {_data->data(), _data->size()};
+        return {_data.get(), _size};
     }
     else
     {